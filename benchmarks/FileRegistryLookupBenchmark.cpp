@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <unistd.h>
+#include <wrench-dev.h>
+
+#define NUM_BENCHMARK_FILES 100
+#define NUM_BENCHMARK_LOOKUPS 1000
+
+/**
+ * @brief A WMS that registers increasing numbers of replicas per file in a file
+ *        registry service, and reports the wall-clock cost of looking them up and
+ *        of removing them
+ */
+class FileRegistryLookupBenchmarkWMS : public wrench::WMS {
+
+public:
+    FileRegistryLookupBenchmarkWMS(const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                   std::shared_ptr<wrench::FileRegistryService> file_registry_service,
+                                   std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, storage_services, {}, file_registry_service, hostname,
+                        "file_registry_lookup_benchmark") {
+    }
+
+private:
+
+    int main() override {
+
+        auto frs = this->getAvailableFileRegistryService();
+        auto available_storage_services = this->getAvailableStorageServices();
+        std::vector<std::shared_ptr<wrench::StorageService>> storage_services(
+                available_storage_services.begin(), available_storage_services.end());
+
+        std::vector<wrench::WorkflowFile *> files;
+        for (unsigned long i = 0; i < NUM_BENCHMARK_FILES; i++) {
+            files.push_back(this->getWorkflow()->addFile("file_" + std::to_string(i), 100.0));
+        }
+
+        std::cout << "replicas\tlookups\tlookup wall-clock (us)\tremovals\tremoval wall-clock (us)" << std::endl;
+        for (unsigned long num_replicas : {1, 10, 100, 1000}) {
+
+            // Register num_replicas replicas (in distinct directories) of each file
+            std::vector<std::pair<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>>> entries;
+            for (auto const &file : files) {
+                for (unsigned long j = 0; j < num_replicas; j++) {
+                    entries.push_back(std::make_pair(file, wrench::FileLocation::LOCATION(
+                            storage_services[j % storage_services.size()],
+                            "/" + std::to_string(num_replicas) + "_replica_" + std::to_string(j))));
+                }
+            }
+            frs->addEntries(entries);
+
+            auto begin = std::chrono::steady_clock::now();
+            for (unsigned long i = 0; i < NUM_BENCHMARK_LOOKUPS; i++) {
+                auto locations = frs->lookupEntry(files[i % NUM_BENCHMARK_FILES]);
+                if (locations.size() != num_replicas) {
+                    throw std::runtime_error("Got a wrong number of locations (" + std::to_string(locations.size()) +
+                                             " instead of " + std::to_string(num_replicas) + ")");
+                }
+            }
+            auto lookup_elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - begin);
+
+            // Remove all entries, one replica at a time
+            begin = std::chrono::steady_clock::now();
+            frs->removeEntries(entries);
+            auto removal_elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - begin);
+
+            std::cout << num_replicas << "\t" << NUM_BENCHMARK_LOOKUPS << "\t" << lookup_elapsed.count() << "\t"
+                      << entries.size() << "\t" << removal_elapsed.count() << std::endl;
+        }
+
+        return 0;
+    }
+};
+
+/**
+ * @brief Reports the wall-clock cost of file registry lookups and removals as
+ *        the number of replicas per file grows
+ *
+ * @param argc: argument count
+ * @param argv: argument array ([<num shards>])
+ * @return 0 on success, non-zero otherwise
+ */
+int main(int argc, char **argv) {
+
+    wrench::Simulation simulation;
+    simulation.init(&argc, argv);
+
+    unsigned long num_shards = 1;
+    if (argc > 2) {
+        std::cerr << "Usage: " << argv[0] << " [<num shards>]" << std::endl;
+        exit(1);
+    }
+    if (argc > 1) {
+        num_shards = strtoul(argv[1], nullptr, 10);
+    }
+    if (num_shards == 0) {
+        std::cerr << "The number of shards should be positive" << std::endl;
+        exit(1);
+    }
+
+    // Create the platform (two hosts, each with a disk)
+    std::string xml = "<?xml version='1.0'?>"
+                      "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                      "<platform version=\"4.1\"> "
+                      "   <zone id=\"AS0\" routing=\"Full\"> "
+                      "       <host id=\"Host1\" speed=\"1f\" core=\"10\" > "
+                      "          <disk id=\"large_disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                      "             <prop id=\"size\" value=\"10000000000000B\"/>"
+                      "             <prop id=\"mount\" value=\"/\"/>"
+                      "          </disk>"
+                      "       </host>"
+                      "       <host id=\"Host2\" speed=\"1f\" core=\"10\" > "
+                      "          <disk id=\"large_disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                      "             <prop id=\"size\" value=\"10000000000000B\"/>"
+                      "             <prop id=\"mount\" value=\"/\"/>"
+                      "          </disk>"
+                      "       </host>"
+                      "       <link id=\"1\" bandwidth=\"5000GBps\" latency=\"0us\"/>"
+                      "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+                      "   </zone> "
+                      "</platform>";
+    std::string platform_file_path = "/tmp/wrench_file_registry_lookup_benchmark_" + std::to_string(getpid()) + ".xml";
+    FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+    fprintf(platform_file, "%s", xml.c_str());
+    fclose(platform_file);
+    simulation.instantiatePlatform(platform_file_path);
+    remove(platform_file_path.c_str());
+
+    auto storage_service1 = simulation.add(new wrench::SimpleStorageService("Host1", {"/"}));
+    auto storage_service2 = simulation.add(new wrench::SimpleStorageService("Host2", {"/"}));
+    auto file_registry_service = simulation.add(new wrench::FileRegistryService(
+            "Host1", {{wrench::FileRegistryServiceProperty::NUM_SHARDS, std::to_string(num_shards)}}));
+
+    wrench::Workflow workflow;
+    auto wms = simulation.add(new FileRegistryLookupBenchmarkWMS(
+            {storage_service1, storage_service2}, file_registry_service, "Host1"));
+    wms->addWorkflow(&workflow);
+
+    try {
+        simulation.launch();
+    } catch (std::runtime_error &e) {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+/**
+ ** This benchmark reports the wall-clock time of a simulation that goes through
+ ** hot logging sites (file copies with small buffers, which log each chunk that
+ ** is read from disk). To measure the speed-up with logging disabled, compare
+ ** its output across builds configured with and without -DWRENCH_MIN_LOG_LEVEL=WARN,
+ ** and with and without --wrench-full-log (redirecting stderr to /dev/null).
+ **/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <unistd.h>
+#include <wrench-dev.h>
+
+/**
+ * @brief A WMS that copies all workflow files from one storage service to another
+ */
+class LoggingBenchmarkWMS : public wrench::WMS {
+
+public:
+    LoggingBenchmarkWMS(std::shared_ptr<wrench::StorageService> src_storage_service,
+                        std::shared_ptr<wrench::StorageService> dst_storage_service,
+                        std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {src_storage_service, dst_storage_service}, {}, nullptr, hostname,
+                        "logging_benchmark") {
+        this->src_storage_service = src_storage_service;
+        this->dst_storage_service = dst_storage_service;
+    }
+
+private:
+
+    std::shared_ptr<wrench::StorageService> src_storage_service;
+    std::shared_ptr<wrench::StorageService> dst_storage_service;
+
+    int main() override {
+
+        auto data_movement_manager = this->createDataMovementManager();
+
+        for (auto const &file : this->getWorkflow()->getFiles()) {
+            data_movement_manager->doSynchronousFileCopy(file,
+                                                         wrench::FileLocation::LOCATION(this->src_storage_service),
+                                                         wrench::FileLocation::LOCATION(this->dst_storage_service));
+        }
+
+        return 0;
+    }
+};
+
+/**
+ * @brief Reports the wall-clock time of a simulation that logs heavily, together
+ *        with the compile-time minimum log level it was built with
+ *
+ * @param argc: argument count
+ * @param argv: argument array ([<num files>] [--wrench-full-log])
+ * @return 0 on success, non-zero otherwise
+ */
+int main(int argc, char **argv) {
+
+    wrench::Simulation simulation;
+    simulation.init(&argc, argv);
+
+    unsigned long num_files = 10;
+    if (argc > 2) {
+        std::cerr << "Usage: " << argv[0] << " [<num files>] [--wrench-full-log]" << std::endl;
+        exit(1);
+    }
+    if (argc > 1) {
+        num_files = strtoul(argv[1], nullptr, 10);
+    }
+    if (num_files == 0) {
+        std::cerr << "The number of files should be positive" << std::endl;
+        exit(1);
+    }
+
+    // Create the platform (two hosts, each with a disk)
+    std::string xml = "<?xml version='1.0'?>"
+                      "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                      "<platform version=\"4.1\"> "
+                      "   <zone id=\"AS0\" routing=\"Full\"> "
+                      "       <host id=\"Host1\" speed=\"1f\" core=\"10\" > "
+                      "          <disk id=\"large_disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                      "             <prop id=\"size\" value=\"10000000000000B\"/>"
+                      "             <prop id=\"mount\" value=\"/\"/>"
+                      "          </disk>"
+                      "       </host>"
+                      "       <host id=\"Host2\" speed=\"1f\" core=\"10\" > "
+                      "          <disk id=\"large_disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                      "             <prop id=\"size\" value=\"10000000000000B\"/>"
+                      "             <prop id=\"mount\" value=\"/\"/>"
+                      "          </disk>"
+                      "       </host>"
+                      "       <link id=\"1\" bandwidth=\"100MBps\" latency=\"10us\"/>"
+                      "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+                      "   </zone> "
+                      "</platform>";
+    std::string platform_file_path = "/tmp/wrench_logging_benchmark_" + std::to_string(getpid()) + ".xml";
+    FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+    fprintf(platform_file, "%s", xml.c_str());
+    fclose(platform_file);
+    simulation.instantiatePlatform(platform_file_path);
+    remove(platform_file_path.c_str());
+
+    // Storage services with a small buffer size, so that each copy goes through many chunks
+    auto src_storage_service = simulation.add(new wrench::SimpleStorageService(
+            "Host1", {"/"}, {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "10000"}}));
+    auto dst_storage_service = simulation.add(new wrench::SimpleStorageService(
+            "Host2", {"/"}, {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "10000"}}));
+
+    // 100MB files
+    wrench::Workflow workflow;
+    for (unsigned long i = 0; i < num_files; i++) {
+        simulation.stageFile(workflow.addFile("file_" + std::to_string(i), 100000000), src_storage_service);
+    }
+
+    auto wms = simulation.add(new LoggingBenchmarkWMS(src_storage_service, dst_storage_service, "Host1"));
+    wms->addWorkflow(&workflow);
+
+    auto begin = std::chrono::steady_clock::now();
+    try {
+        simulation.launch();
+    } catch (std::runtime_error &e) {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+
+    std::string min_log_level = (WRENCH_MIN_LOG_LEVEL == WRENCH_LOG_LEVEL_DEBUG ? "DEBUG" :
+                                 (WRENCH_MIN_LOG_LEVEL == WRENCH_LOG_LEVEL_INFO ? "INFO" : "WARN"));
+    std::cout << "Simulated the copy of " << num_files << " files in " << elapsed.count()
+              << " ms (wall-clock, compile-time minimum log level: " << min_log_level << ")" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <unistd.h>
+#include <simgrid/s4u.hpp>
+#include <wrench-dev.h>
+
+/**
+ * @brief A WMS that runs tasks with increasing numbers of cores, one after the
+ *        other, and reports for each of them the number of actors that are alive
+ *        during the computation and the wall-clock cost of the simulation
+ */
+class ManyCoresBenchmarkWMS : public wrench::WMS {
+
+public:
+    ManyCoresBenchmarkWMS(const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                          std::string hostname, unsigned long max_num_cores) :
+            wrench::WMS(nullptr, nullptr, compute_services, {}, {}, nullptr, hostname, "many_cores_benchmark") {
+        this->max_num_cores = max_num_cores;
+    }
+
+private:
+
+    unsigned long max_num_cores;
+
+    int main() override {
+
+        auto job_manager = this->createJobManager();
+        auto cs = *(this->getAvailableComputeServices<wrench::ComputeService>().begin());
+
+        std::cout << "cores\tnew actors\twall-clock (us)" << std::endl;
+        for (unsigned long n = 1; n <= this->max_num_cores; n *= 2) {
+            // A task that computes for 100 seconds on n cores
+            auto task = this->getWorkflow()->addTask("task_" + std::to_string(n), 100.0 * n, n, n, 1.0, 0);
+            auto job = job_manager->createStandardJob(task, {});
+
+            auto begin = std::chrono::steady_clock::now();
+            unsigned long num_actors_before = simgrid::s4u::Engine::get_instance()->get_actor_count();
+            job_manager->submitJob(job, cs, {});
+            wrench::Simulation::sleep(50);
+            unsigned long num_new_actors = simgrid::s4u::Engine::get_instance()->get_actor_count() - num_actors_before;
+            auto event = this->getWorkflow()->waitForNextExecutionEvent();
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+
+            if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+            }
+            std::cout << n << "\t" << num_new_actors << "\t" << elapsed.count() << std::endl;
+        }
+
+        return 0;
+    }
+};
+
+/**
+ * @brief Compares the number of actors and the wall-clock cost of simulating
+ *        the execution of single tasks with increasing numbers of cores
+ *
+ * @param argc: argument count
+ * @param argv: argument array ([<max num cores>])
+ * @return 0 on success, non-zero otherwise
+ */
+int main(int argc, char **argv) {
+
+    wrench::Simulation simulation;
+    simulation.init(&argc, argv);
+
+    unsigned long max_num_cores = 256;
+    if (argc > 2) {
+        std::cerr << "Usage: " << argv[0] << " [<max num cores>]" << std::endl;
+        exit(1);
+    }
+    if (argc > 1) {
+        max_num_cores = strtoul(argv[1], nullptr, 10);
+    }
+    if (max_num_cores == 0) {
+        std::cerr << "The maximum number of cores should be positive" << std::endl;
+        exit(1);
+    }
+
+    // Create the platform (a single host with max_num_cores 1-flop/sec cores)
+    std::string xml = "<?xml version='1.0'?>"
+                      "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                      "<platform version=\"4.1\"> "
+                      "   <zone id=\"AS0\" routing=\"Full\"> "
+                      "       <host id=\"ManyCoreHost\" speed=\"1f\" core=\"" + std::to_string(max_num_cores) + "\"/> "
+                      "   </zone> "
+                      "</platform>";
+    std::string platform_file_path = "/tmp/wrench_many_cores_benchmark_" + std::to_string(getpid()) + ".xml";
+    FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+    fprintf(platform_file, "%s", xml.c_str());
+    fclose(platform_file);
+    simulation.instantiatePlatform(platform_file_path);
+    remove(platform_file_path.c_str());
+
+    auto compute_service = simulation.add(
+            new wrench::BareMetalComputeService("ManyCoreHost", {"ManyCoreHost"}, "", {}, {}));
+
+    wrench::Workflow workflow;
+    auto wms = simulation.add(new ManyCoresBenchmarkWMS({compute_service}, "ManyCoreHost", max_num_cores));
+    wms->addWorkflow(&workflow);
+
+    try {
+        simulation.launch();
+    } catch (std::runtime_error &e) {
+        std::cerr << "Exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
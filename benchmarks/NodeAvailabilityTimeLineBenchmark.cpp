@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <wrench/services/compute/batch/BatchJob.h>
+#include "services/compute/batch/batch_schedulers/homegrown/conservative_bf/NodeAvailabilityTimeLine.h"
+
+/**
+ * @brief Reports the wall-clock cost of scheduling many jobs, with sub-second
+ *        and multi-year durations, in a conservative_bf node availability timeline
+ *
+ * @param argc: argument count
+ * @param argv: argument array ([<num jobs> [<num nodes>]])
+ * @return 0 on success, non-zero otherwise
+ */
+int main(int argc, char **argv) {
+
+    unsigned long num_jobs = 2000;
+    unsigned long num_nodes = 64;
+    if (argc > 3) {
+        std::cerr << "Usage: " << argv[0] << " [<num jobs> [<num nodes>]]" << std::endl;
+        exit(1);
+    }
+    if (argc > 1) {
+        num_jobs = strtoul(argv[1], nullptr, 10);
+    }
+    if (argc > 2) {
+        num_nodes = strtoul(argv[2], nullptr, 10);
+    }
+    if ((num_jobs == 0) or (num_nodes == 0)) {
+        std::cerr << "The number of jobs and the number of nodes should be positive" << std::endl;
+        exit(1);
+    }
+
+    wrench::NodeAvailabilityTimeLine schedule(num_nodes);
+    std::vector<std::shared_ptr<wrench::BatchJob>> batch_jobs;
+
+    srand(42);
+    auto begin = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < num_jobs; i++) {
+        unsigned long job_num_nodes = 1 + rand() % num_nodes;
+        // Mostly sub-second durations, with a few very long (multi-year) ones
+        double duration_in_seconds = (i % 100 == 0) ? 3.0 * 365 * 24 * 3600 : 0.001 * (1 + rand() % 999);
+        auto batch_job = std::shared_ptr<wrench::BatchJob>(
+                new wrench::BatchJob(i + 1, 1, job_num_nodes, 1, duration_in_seconds, 0, 0));
+        batch_jobs.push_back(batch_job);
+
+        auto duration = wrench::BatchScheduleTime::fromDuration(duration_in_seconds);
+        auto est = schedule.findEarliestStartTime(duration, job_num_nodes);
+        schedule.add(est, wrench::BatchScheduleTime::add(est, duration), batch_job);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+
+    std::cout << "Scheduled " << num_jobs << " jobs on " << num_nodes << " nodes in "
+              << elapsed.count() << " ms (wall-clock)" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+# list of benchmarks (not built by default, build them with "make benchmarks")
+set(BENCHMARK_FILES
+        benchmarks/NodeAvailabilityTimeLineBenchmark.cpp
+        benchmarks/ManyCoresBenchmark.cpp
+        benchmarks/FileRegistryLookupBenchmark.cpp
+        benchmarks/LoggingBenchmark.cpp
+        )
+
+add_custom_target(benchmarks)
+
+foreach (benchmark_file ${BENCHMARK_FILES})
+    get_filename_component(benchmark ${benchmark_file} NAME_WE)
+    add_executable(${benchmark} EXCLUDE_FROM_ALL ${benchmark_file})
+    if (ENABLE_BATSCHED)
+        find_library(ZMQ_LIBRARY NAMES zmq)
+        target_link_libraries(${benchmark} wrench ${SimGrid_LIBRARY} ${PUGIXML_LIBRARY} ${ZMQ_LIBRARY})
+    else ()
+        target_link_libraries(${benchmark} wrench ${SimGrid_LIBRARY} ${PUGIXML_LIBRARY})
+    endif ()
+    add_dependencies(benchmarks ${benchmark})
+endforeach ()
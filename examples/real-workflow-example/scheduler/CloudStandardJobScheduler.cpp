@@ -16,6 +16,16 @@ WRENCH_LOG_CATEGORY(cloud_scheduler, "Log category for Cloud Scheduler");
 
 namespace wrench {
 
+    /**
+     * @brief Destructor, which cancels the resource availability subscriptions to the
+     *        compute services running on VMs
+     */
+    CloudStandardJobScheduler::~CloudStandardJobScheduler() {
+        for (auto const &s : this->vm_resource_subscriptions) {
+            s.second->cancel();
+        }
+    }
+
     /**
      * @brief Schedule and run a set of ready tasks on available cloud resources
      *
@@ -41,6 +51,17 @@ namespace wrench {
 
         WRENCH_INFO("There are %ld ready tasks to schedule", tasks.size());
 
+        // Forget the compute services whose VMs are no longer running, cancelling their subscriptions
+        for (auto it = this->compute_services_running_on_vms.begin(); it != this->compute_services_running_on_vms.end();) {
+            if (not (*it)->isUp()) {
+                this->vm_resource_subscriptions[*it]->cancel();
+                this->vm_resource_subscriptions.erase(*it);
+                it = this->compute_services_running_on_vms.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
         for (auto task : tasks) {
 
             WRENCH_INFO("Trying to schedule ready task '%s' on a currently running VM", task->getID().c_str());
@@ -50,7 +71,8 @@ namespace wrench {
             for (auto const &vm_cs : this->compute_services_running_on_vms) {
                 unsigned long num_idle_cores;
                 try {
-                    num_idle_cores = vm_cs->getTotalNumIdleCores();
+                    // Local read of the pushed resource availability view (no RPC)
+                    num_idle_cores = this->vm_resource_subscriptions[vm_cs]->getTotalNumIdleCores();
                 } catch (WorkflowExecutionException &e) {
                     // The service has some problem, forget it
                     throw std::runtime_error("Unable to get the number of idle cores: " + e.getCause()->toString());
@@ -80,6 +102,7 @@ namespace wrench {
                                                           task->getMemoryRequirement());
                         picked_vm_cs = cloud_service->startVM(vm);
                         this->compute_services_running_on_vms.push_back(picked_vm_cs);
+                        this->vm_resource_subscriptions[picked_vm_cs] = picked_vm_cs->subscribeToResourceAvailability();
                     } catch (WorkflowExecutionException &e) {
                         throw std::runtime_error("Unable to create/start a VM: " + e.getCause()->toString());
                     }
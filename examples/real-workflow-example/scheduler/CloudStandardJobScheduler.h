@@ -25,6 +25,8 @@ namespace wrench {
         explicit CloudStandardJobScheduler(std::shared_ptr<StorageService> default_storage_service) :
                 default_storage_service(default_storage_service) {}
 
+        ~CloudStandardJobScheduler() override;
+
         /***********************/
         /** \cond DEVELOPER    */
         /***********************/
@@ -40,6 +42,7 @@ namespace wrench {
         std::vector<std::string> execution_hosts;
         std::shared_ptr<StorageService> default_storage_service;
         std::vector<std::shared_ptr<BareMetalComputeService>> compute_services_running_on_vms;
+        std::map<std::shared_ptr<BareMetalComputeService>, std::shared_ptr<ResourceAvailabilitySubscription>> vm_resource_subscriptions;
     };
 }
 
@@ -63,6 +63,10 @@
 #include "wrench/workflow/job/StandardJob.h"
 #include "wrench/workflow/job/PilotJob.h"
 
+// Helper Services
+#include "wrench/services/helpers/Alarm.h"
+#include "wrench/services/helpers/TimerService.h"
+
 // Simgrid Util
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
 
@@ -20,6 +20,19 @@
 namespace wrench {
 
 
+/* Log levels, from most to least verbose, for use with WRENCH_MIN_LOG_LEVEL */
+#define WRENCH_LOG_LEVEL_DEBUG 0
+#define WRENCH_LOG_LEVEL_INFO 1
+#define WRENCH_LOG_LEVEL_WARN 2
+
+/* The minimum log level compiled in. Calls to WRENCH_* logging macros below that level are
+ * compiled out (their arguments are never evaluated), regardless of runtime log settings.
+ * E.g., compile with -DWRENCH_MIN_LOG_LEVEL=WRENCH_LOG_LEVEL_WARN to remove all INFO and DEBUG logging.
+ */
+#ifndef WRENCH_MIN_LOG_LEVEL
+#define WRENCH_MIN_LOG_LEVEL WRENCH_LOG_LEVEL_DEBUG
+#endif
+
 /* Wrappers around XBT_* macros, using a bit of those macro's internal magic as well
  * to avoid generating useless (but space consuming) color ASCII codes
  */
@@ -27,21 +40,24 @@ namespace wrench {
 #define WRENCH_LOG_CATEGORY(cname, desc) XBT_LOG_NEW_DEFAULT_CATEGORY(cname, desc)
 
 #define WRENCH_INFO(...);  \
-    if (_XBT_LOG_ISENABLEDV((*_simgrid_log_category__default), xbt_log_priority_info)) { \
+    if ((WRENCH_LOG_LEVEL_INFO >= WRENCH_MIN_LOG_LEVEL) && \
+        _XBT_LOG_ISENABLEDV((*_simgrid_log_category__default), xbt_log_priority_info)) { \
       wrench::TerminalOutput::beginThisProcessColor();  \
       XBT_INFO(__VA_ARGS__) ;  \
       wrench::TerminalOutput::endThisProcessColor(); \
     }
 
 #define WRENCH_DEBUG(...);  \
-    if (_XBT_LOG_ISENABLEDV((*_simgrid_log_category__default), xbt_log_priority_debug)) { \
+    if ((WRENCH_LOG_LEVEL_DEBUG >= WRENCH_MIN_LOG_LEVEL) && \
+        _XBT_LOG_ISENABLEDV((*_simgrid_log_category__default), xbt_log_priority_debug)) { \
       wrench::TerminalOutput::beginThisProcessColor();  \
       XBT_DEBUG(__VA_ARGS__) ;  \
       wrench::TerminalOutput::endThisProcessColor(); \
     }
 
 #define WRENCH_WARN(...);  \
-    if (_XBT_LOG_ISENABLEDV((*_simgrid_log_category__default), xbt_log_priority_warning)) { \
+    if ((WRENCH_LOG_LEVEL_WARN >= WRENCH_MIN_LOG_LEVEL) && \
+        _XBT_LOG_ISENABLEDV((*_simgrid_log_category__default), xbt_log_priority_warning)) { \
       wrench::TerminalOutput::beginThisProcessColor();  \
       XBT_WARN(__VA_ARGS__) ;  \
       wrench::TerminalOutput::endThisProcessColor(); \
@@ -101,9 +117,7 @@ namespace wrench {
 
         static const char * color_codes[];
 
-        static std::map<simgrid::s4u::Actor *, std::string> colormap;
-
-        static std::string getThisProcessLoggingColor();
+        static const char *getThisProcessLoggingColor();
 
         static bool color_enabled;
 
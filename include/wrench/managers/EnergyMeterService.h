@@ -11,6 +11,8 @@
 #ifndef WRENCH_ENERGYMETERSERVICE_H
 #define WRENCH_ENERGYMETERSERVICE_H
 
+#include <unordered_map>
+#include <simgrid/s4u.hpp>
 #include "wrench/services/Service.h"
 
 namespace wrench {
@@ -18,7 +20,9 @@ namespace wrench {
     class WMS;
 
     /**
-     * @brief A service that measures and records energy consumption on a set of hosts at regular time intervals
+     * @brief A service that measures and records energy consumption on a set of hosts, either at regular time intervals,
+     *        or each time the power consumption of a host may change (pstate change, host turned on/off,
+     *        computation started/completed/aborted)
      */
     class EnergyMeterService : public Service {
 
@@ -26,6 +30,7 @@ namespace wrench {
 
         EnergyMeterService(std::string hostname, const std::vector<std::string> &hostnames, double period);
         EnergyMeterService(std::string hostname, const std::map<std::string, double> &measurement_periods);
+        EnergyMeterService(std::string hostname, const std::vector<std::string> &hostnames);
 
         /***********************/
         /** \cond DEVELOPER    */
@@ -44,6 +49,23 @@ namespace wrench {
         std::map<std::string, double> measurement_periods;
         std::map<std::string, double> time_to_next_measurement;
 
+        // Event-driven mode: metered hosts, with the date of their last recorded measurement
+        bool event_driven = false;
+        std::unordered_map<simgrid::s4u::Host *, double> last_measurement_dates;
+
+        unsigned int on_state_change_call_back_id;
+        unsigned int on_speed_change_call_back_id;
+        unsigned int on_exec_start_call_back_id;
+        unsigned int on_exec_completion_call_back_id;
+        unsigned int on_actor_termination_call_back_id;
+        bool call_backs_connected = false;
+
+        void cleanup(bool has_returned_from_main, int return_value) override;
+
+        void connectCallBacks();
+        void disconnectCallBacks();
+        void takeMeasurement(simgrid::s4u::Host *host);
+
     };
 
 };
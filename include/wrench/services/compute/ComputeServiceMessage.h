@@ -262,6 +262,63 @@ namespace wrench {
         std::map<std::string, std::map<std::string, double>> info;
     };
 
+    /**
+     * @brief A message sent to a ComputeService to subscribe to (pushed) resource availability updates
+     */
+    class ComputeServiceResourceAvailabilitySubscriptionRequestMessage : public ComputeServiceMessage {
+    public:
+        ComputeServiceResourceAvailabilitySubscriptionRequestMessage(std::string answer_mailbox,
+                                                                     std::string subscriber_mailbox,
+                                                                     double payload);
+
+        /** @brief The mailbox to which the answer should be sent */
+        std::string answer_mailbox;
+        /** @brief The mailbox to which resource availability updates should be pushed */
+        std::string subscriber_mailbox;
+    };
+
+    /**
+     * @brief A message sent by a ComputeService in answer to a resource availability subscription request,
+     *        with its current resource availability
+     */
+    class ComputeServiceResourceAvailabilitySubscriptionAnswerMessage : public ComputeServiceMessage {
+    public:
+        ComputeServiceResourceAvailabilitySubscriptionAnswerMessage(std::map<std::string, unsigned long> num_idle_cores,
+                                                                    std::map<std::string, double> available_ram,
+                                                                    double payload);
+
+        /** @brief The number of idle cores of each host */
+        std::map<std::string, unsigned long> num_idle_cores;
+        /** @brief The available RAM of each host */
+        std::map<std::string, double> available_ram;
+    };
+
+    /**
+     * @brief A message sent to a ComputeService to unsubscribe from resource availability updates
+     */
+    class ComputeServiceResourceAvailabilityUnsubscriptionRequestMessage : public ComputeServiceMessage {
+    public:
+        ComputeServiceResourceAvailabilityUnsubscriptionRequestMessage(std::string subscriber_mailbox, double payload);
+
+        /** @brief The mailbox to which resource availability updates were pushed */
+        std::string subscriber_mailbox;
+    };
+
+    /**
+     * @brief A message pushed by a ComputeService to a subscriber with changes in its resource availability
+     */
+    class ComputeServiceResourceAvailabilityUpdateMessage : public ComputeServiceMessage {
+    public:
+        ComputeServiceResourceAvailabilityUpdateMessage(std::map<std::string, long> num_idle_cores_deltas,
+                                                        std::map<std::string, double> available_ram_deltas,
+                                                        double payload);
+
+        /** @brief The changes in the number of idle cores of each host (positive: cores were freed) */
+        std::map<std::string, long> num_idle_cores_deltas;
+        /** @brief The changes in the available RAM of each host (positive: RAM was freed) */
+        std::map<std::string, double> available_ram_deltas;
+    };
+
     /***********************/
     /** \endcond           */
     /***********************/
@@ -56,6 +56,14 @@ namespace wrench {
         DECLARE_MESSAGEPAYLOAD_NAME(RESOURCE_DESCRIPTION_REQUEST_MESSAGE_PAYLOAD);
         /** @brief The number of bytes in the control message sent by the daemon to state information on its resources **/
         DECLARE_MESSAGEPAYLOAD_NAME(RESOURCE_DESCRIPTION_ANSWER_MESSAGE_PAYLOAD);
+        /** @brief The number of bytes in the control message sent to the daemon to subscribe to resource availability updates **/
+        DECLARE_MESSAGEPAYLOAD_NAME(RESOURCE_AVAILABILITY_SUBSCRIPTION_REQUEST_MESSAGE_PAYLOAD);
+        /** @brief The number of bytes in the control message sent by the daemon to state its current resource availability to a new subscriber **/
+        DECLARE_MESSAGEPAYLOAD_NAME(RESOURCE_AVAILABILITY_SUBSCRIPTION_ANSWER_MESSAGE_PAYLOAD);
+        /** @brief The number of bytes in the control message sent to the daemon to unsubscribe from resource availability updates **/
+        DECLARE_MESSAGEPAYLOAD_NAME(RESOURCE_AVAILABILITY_UNSUBSCRIPTION_REQUEST_MESSAGE_PAYLOAD);
+        /** @brief The number of bytes in the control message sent by the daemon to push resource availability changes to a subscriber **/
+        DECLARE_MESSAGEPAYLOAD_NAME(RESOURCE_AVAILABILITY_UPDATE_MESSAGE_PAYLOAD);
     };
 };
 
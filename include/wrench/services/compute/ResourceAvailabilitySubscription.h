@@ -0,0 +1,78 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_RESOURCEAVAILABILITYSUBSCRIPTION_H
+#define WRENCH_RESOURCEAVAILABILITYSUBSCRIPTION_H
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace wrench {
+
+    class ComputeService;
+
+    /***********************/
+    /** \cond DEVELOPER   **/
+    /***********************/
+
+    /**
+     * @brief A subscription to the resource availability of a compute service, i.e., a local
+     *        view of the numbers of idle cores and of the available RAM of the service's hosts,
+     *        which the service keeps up to date by pushing changes to the subscriber. Queries are
+     *        answered locally, after applying the changes pushed since the previous query.
+     *        The subscription is cancelled when it is destroyed, if it hasn't been already.
+     */
+    class ResourceAvailabilitySubscription {
+
+    public:
+
+        std::map<std::string, unsigned long> getPerHostNumIdleCores();
+
+        unsigned long getTotalNumIdleCores();
+
+        std::map<std::string, double> getPerHostAvailableMemoryCapacity();
+
+        void cancel();
+
+        /***********************/
+        /** \cond INTERNAL    **/
+        /***********************/
+
+        ResourceAvailabilitySubscription(std::shared_ptr<ComputeService> compute_service,
+                                         std::string mailbox_name,
+                                         std::map<std::string, unsigned long> num_idle_cores,
+                                         std::map<std::string, double> available_ram);
+
+        ~ResourceAvailabilitySubscription();
+
+        /***********************/
+        /** \endcond          **/
+        /***********************/
+
+    private:
+
+        void applyPendingUpdates();
+
+        std::shared_ptr<ComputeService> compute_service;
+        std::string mailbox_name;
+        bool cancelled = false;
+
+        std::map<std::string, unsigned long> num_idle_cores;
+        unsigned long total_num_idle_cores = 0;
+        std::map<std::string, double> available_ram;
+    };
+
+    /***********************/
+    /** \endcond          **/
+    /***********************/
+
+};
+
+#endif //WRENCH_RESOURCEAVAILABILITYSUBSCRIPTION_H
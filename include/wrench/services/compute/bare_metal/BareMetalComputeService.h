@@ -14,11 +14,14 @@
 #include <queue>
 
 #include "wrench/services/compute/ComputeService.h"
+#include "wrench/services/compute/ResourceAvailabilitySubscription.h"
 #include "wrench/services/compute/standard_job_executor/StandardJobExecutor.h"
 #include "BareMetalComputeServiceProperty.h"
 #include "BareMetalComputeServiceMessagePayload.h"
 #include "wrench/services/compute/workunit_executor/Workunit.h"
+#include "wrench/services/compute/workunit_executor/ReadyWorkunitQueue.h"
 #include "wrench/services/helpers/HostStateChangeDetector.h"
+#include "wrench/services/helpers/ServiceLivenessMonitor.h"
 
 
 
@@ -57,6 +60,8 @@ namespace wrench {
                 {BareMetalComputeServiceProperty::SUPPORTS_PILOT_JOBS,                            "false"},
                 {BareMetalComputeServiceProperty::TASK_STARTUP_OVERHEAD,                          "0.0"},
                 {BareMetalComputeServiceProperty::TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN,      "false"},
+                {BareMetalComputeServiceProperty::SIMULATE_JOBS_ANALYTICALLY,                     "false"},
+                {BareMetalComputeServiceProperty::ANALYTICAL_IO_BANDWIDTH,                        "infinity"},
         };
 
         std::map<std::string, double> default_messagepayload_values = {
@@ -79,6 +84,10 @@ namespace wrench {
                 {BareMetalComputeServiceMessagePayload::TERMINATE_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD,     1024},
                 {BareMetalComputeServiceMessagePayload::RESOURCE_DESCRIPTION_REQUEST_MESSAGE_PAYLOAD,     1024},
                 {BareMetalComputeServiceMessagePayload::RESOURCE_DESCRIPTION_ANSWER_MESSAGE_PAYLOAD,      1024},
+                {BareMetalComputeServiceMessagePayload::RESOURCE_AVAILABILITY_SUBSCRIPTION_REQUEST_MESSAGE_PAYLOAD,   1024},
+                {BareMetalComputeServiceMessagePayload::RESOURCE_AVAILABILITY_SUBSCRIPTION_ANSWER_MESSAGE_PAYLOAD,    1024},
+                {BareMetalComputeServiceMessagePayload::RESOURCE_AVAILABILITY_UNSUBSCRIPTION_REQUEST_MESSAGE_PAYLOAD, 1024},
+                {BareMetalComputeServiceMessagePayload::RESOURCE_AVAILABILITY_UPDATE_MESSAGE_PAYLOAD,                 1024},
         };
 
     public:
@@ -99,6 +108,15 @@ namespace wrench {
                                 std::map<std::string, double> messagepayload_list = {}
         );
 
+        /***********************/
+        /** \cond DEVELOPER    */
+        /***********************/
+
+        std::shared_ptr<ResourceAvailabilitySubscription> subscribeToResourceAvailability();
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
 
         /***********************/
         /** \cond INTERNAL     */
@@ -155,6 +173,23 @@ namespace wrench {
         std::map<std::string, double> ram_availabilities;
         std::map<std::string, unsigned long> running_thread_counts;
 
+        // Host index used to pick allocations: hosts are partitioned into classes of identical
+        // numbers of cores and flop rates, within which they are ordered by number of running
+        // threads (and then by name), i.e., by load
+        struct HostClass {
+            unsigned long num_cores;
+            double flop_rate;
+            std::set<std::pair<unsigned long, std::string>> hosts_by_load;
+        };
+        std::vector<HostClass> host_classes;
+        std::map<std::string, unsigned long> host_class_indices;
+
+        // Resource availability subscribers, and the changes in resource availability that
+        // have not been pushed to them yet
+        std::set<std::string> resource_availability_subscriber_mailboxes;
+        std::map<std::string, long> pending_num_idle_cores_deltas;
+        std::map<std::string, double> pending_available_ram_deltas;
+
         unsigned long total_num_cores;
 
         double ttl;
@@ -175,13 +210,34 @@ namespace wrench {
         // Map of all Workunits
         std::map<StandardJob *, std::set<std::shared_ptr<Workunit>>> all_workunits;
 
-        std::deque<std::shared_ptr<Workunit>> ready_workunits;
+        // Ready Workunits (FIFO policy: Workunits without a computational task first, then insertion order)
+        ReadyWorkunitQueue ready_workunits;
 //        std::map<StandardJob *, std::set<Workunit *>> running_workunits;
         std::map<StandardJob *, std::set<std::shared_ptr<Workunit>>> completed_workunits;
 
         // Set of running WorkunitExecutors
         std::map<StandardJob *, std::set<std::shared_ptr<WorkunitExecutor>>> workunit_executors;
 
+        // Analytical job execution (SIMULATE_JOBS_ANALYTICALLY): the dated events of running
+        // analytical jobs, which the daemon processes itself as they come due, and the
+        // allocations and computed dates of their tasks that have not completed
+        enum AnalyticalEventType {
+            ANALYTICAL_TASK_START,
+            ANALYTICAL_TASK_END,
+            ANALYTICAL_JOB_END
+        };
+        struct AnalyticalTaskExecution {
+            std::string hostname;
+            unsigned long num_cores;
+            bool running;
+            double start_date;
+            double read_input_end_date;
+            double computation_end_date;
+            double end_date;
+        };
+        std::multimap<double, std::tuple<AnalyticalEventType, StandardJob *, WorkflowTask *>> analytical_events;
+        std::map<StandardJob *, std::map<WorkflowTask *, AnalyticalTaskExecution>> analytical_task_executions;
+
         // Add the scratch files of one standardjob to the list of all the scratch files of all the standard jobs inside the pilot job
         void storeFilesStoredInScratch(std::set<WorkflowFile*> scratch_files);
 
@@ -227,8 +283,22 @@ namespace wrench {
 
         void failRunningStandardJob(StandardJob *job, std::shared_ptr<FailureCause> cause);
 
+        bool startAnalyticalStandardJob(StandardJob *job,
+                                        std::map<WorkflowTask *, std::tuple<std::string, unsigned long>> &task_run_specs);
+
+        bool processAnalyticalEvents();
+
+        void terminateAnalyticalStandardJob(StandardJob *job, JobTerminationCause termination_cause);
+
+        void failAnalyticalStandardJobsOnHost(const std::string &hostname);
+
         void processGetResourceInformation(const std::string &answer_mailbox);
 
+        void processResourceAvailabilitySubscription(const std::string &answer_mailbox,
+                                                     const std::string &subscriber_mailbox);
+
+        void pushResourceAvailabilityUpdates();
+
         void processSubmitPilotJob(const std::string &answer_mailbox, PilotJob *job, std::map<std::string, std::string> service_specific_args);
 
         void processSubmitStandardJob(const std::string &answer_mailbox, StandardJob *job,
@@ -238,6 +308,12 @@ namespace wrench {
                                                               std::string required_host, unsigned long required_num_cores, double required_ram,
                                                               std::set<std::string> &hosts_to_avoid);
 
+        void buildHostIndex();
+        void indexHost(const std::string &hostname);
+        void updateRunningThreadCount(const std::string &hostname, long delta);
+        void updateRamAvailability(const std::string &hostname, double delta);
+        unsigned long getNumIdleCores(const std::string &hostname);
+
         bool jobCanRun(StandardJob *job, std::map<std::string, std::string> &service_specific_arguments);
 
         bool isThereAtLeastOneHostWithResources(unsigned long num_cores, double ram);
@@ -250,6 +326,7 @@ namespace wrench {
         int exit_code = 0;
 
         std::shared_ptr<HostStateChangeDetector> host_state_change_monitor;
+        std::shared_ptr<ServiceLivenessMonitor> workunit_executor_monitor;
 
     };
 };
@@ -28,6 +28,24 @@ namespace wrench {
         DECLARE_PROPERTY_NAME(TASK_STARTUP_OVERHEAD);
         /** @brief Whether the service should terminate when all hosts are down **/
         DECLARE_PROPERTY_NAME(TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN);
+        /**
+         * @brief Whether standard jobs should be simulated analytically rather than executed:
+         *    - "false": tasks are executed by work unit executors, which perform actual file
+         *               reads/writes/copies and computations (default)
+         *    - "true": each task's host and completion date are computed when the job is admitted
+         *              (based on the task's flops, number of cores, parallel efficiency, and host speed,
+         *              on the startup overhead, and on the job's file sizes and the ANALYTICAL_IO_BANDWIDTH),
+         *              and the service updates task states when these dates are reached, without
+         *              starting any actor. A task only holds its cores while it runs. Storage services
+         *              are not involved (input files are not read, and output files are not created),
+         *              RAM requirements are ignored, and resource contention between tasks does not
+         *              delay them. A job whose tasks cannot all be placed upon admission (e.g., because
+         *              hosts are down) is executed normally. A job with a task that has not completed on a
+         *              host that turns off fails (with a HostError), rather than having that task re-executed.
+         **/
+        DECLARE_PROPERTY_NAME(SIMULATE_JOBS_ANALYTICALLY);
+        /** @brief The I/O bandwidth, in bytes/sec, used to compute file read/write/copy durations when SIMULATE_JOBS_ANALYTICALLY is true ("infinity": I/O takes zero time) **/
+        DECLARE_PROPERTY_NAME(ANALYTICAL_IO_BANDWIDTH);
 
     };
 
@@ -14,15 +14,17 @@
 #include "wrench/services/compute/ComputeService.h"
 #include "wrench/services/compute/standard_job_executor/StandardJobExecutor.h"
 #include "wrench/services/compute/batch/BatchJob.h"
+#include "wrench/services/compute/batch/BatchJobLog.h"
 #include "wrench/services/compute/batch/BatschedNetworkListener.h"
 #include "wrench/services/compute/batch/BatchComputeServiceProperty.h"
 #include "wrench/services/compute/batch/BatchComputeServiceMessagePayload.h"
-#include "wrench/services/helpers/Alarm.h"
+#include "wrench/services/helpers/TimerService.h"
 #include "wrench/workflow/job/StandardJob.h"
 #include "wrench/workflow/job/WorkflowJob.h"
 #include "wrench/services/compute/batch/batch_schedulers/BatchScheduler.h"
 
 #include <deque>
+#include <map>
 #include <queue>
 #include <set>
 #include <tuple>
@@ -73,7 +75,9 @@ namespace wrench {
                 {BatchComputeServiceProperty::USE_REAL_RUNTIMES_AS_REQUESTED_RUNTIMES_IN_WORKLOAD_TRACE_FILE,     "false"},
                 {BatchComputeServiceProperty::IGNORE_INVALID_JOBS_IN_WORKLOAD_TRACE_FILE,     "false"},
                 {BatchComputeServiceProperty::SUBMIT_TIME_OF_FIRST_JOB_IN_WORKLOAD_TRACE_FILE,                          "-1"},
+                {BatchComputeServiceProperty::WORKLOAD_TRACE_FILE_LOADING_THREADS,         "0"},
                 {BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG,                          ""},
+                {BatchComputeServiceProperty::OUTPUT_BINARY_JOB_LOG,                       ""},
                 {BatchComputeServiceProperty::SIMULATE_COMPUTATION_AS_SLEEP,               "false"},
                 {BatchComputeServiceProperty::BATSCHED_LOGGING_MUTED,                      "true"},
                 {BatchComputeServiceProperty::BATSCHED_CONTIGUOUS_ALLOCATION,              "false"}
@@ -111,6 +115,8 @@ namespace wrench {
         /***********************/
         std::map<std::string,double> getStartTimeEstimates(std::set<std::tuple<std::string,unsigned long,unsigned long, double>> resources);
 
+        const BatchJobLog &getJobLog();
+
         /***********************/
         /** \endcond          **/
         /***********************/
@@ -161,7 +167,10 @@ namespace wrench {
         // terminate a pilot job
         void terminatePilotJob(PilotJob *job) override;
 
-        std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> workload_trace;
+        std::string workload_trace_file;
+        unsigned long workload_trace_num_jobs = 0;
+        // End dates of running background jobs (i.e., jobs from the workload trace)
+        std::multimap<double, std::shared_ptr<BatchJob>> background_job_end_dates;
         std::shared_ptr<WorkloadTraceFileReplayer> workload_trace_replayer;
 
         bool clean_exit = false;
@@ -169,11 +178,11 @@ namespace wrench {
         //Configuration to create randomness in measurement period initially
         unsigned long random_interval = 10;
 
-        //create alarms for standard jobs
-        std::map<std::string,std::shared_ptr<Alarm>> standard_job_alarms;
+        //timers for standard jobs
+        std::map<std::string,std::shared_ptr<Timer>> standard_job_alarms;
 
-        //alarms for pilot jobs (only one pilot job alarm)
-        std::map<std::string,std::shared_ptr<Alarm>> pilot_job_alarms;
+        //timers for pilot jobs (only one pilot job timer)
+        std::map<std::string,std::shared_ptr<Timer>> pilot_job_alarms;
 
         /* Resources information in BatchService */
         unsigned long total_num_of_nodes;
@@ -207,6 +216,9 @@ namespace wrench {
         // Scheduler
         std::unique_ptr<BatchScheduler> scheduler;
 
+        // Log of the jobs that have left the service
+        std::unique_ptr<BatchJobLog> job_log;
+
 
 #ifdef ENABLE_BATSCHED
 
@@ -252,6 +264,8 @@ namespace wrench {
 
         void processStandardJobCompletion(std::shared_ptr<StandardJobExecutor> executor, StandardJob *job);
 
+        bool processBackgroundJobCompletions();
+
         void processStandardJobFailure(std::shared_ptr<StandardJobExecutor> executor,
                                        StandardJob *job,
                                        std::shared_ptr<FailureCause> cause);
@@ -108,16 +108,33 @@ namespace wrench {
         DECLARE_PROPERTY_NAME(SUBMIT_TIME_OF_FIRST_JOB_IN_WORKLOAD_TRACE_FILE);
 
         /**
-         * @brief Path to a to-be-generated Batsim-style CSV trace file (e.g. for b3atch schedule visualization purposes).
-         *      - If ENABLE_BATSCHED is set to off or not set: ignored
-         *      - If ENABLE_BATSCHED is set to on: The trace file is generated in CVS format as follows:
+         * @brief The number of threads used to validate an SWF workload trace file
+         *        (see BatchComputeServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE) when the service is created:
+         *          - "0": one thread per hardware thread (default)
+         *          - A strictly positive number: that number of threads
+         */
+        DECLARE_PROPERTY_NAME(WORKLOAD_TRACE_FILE_LOADING_THREADS);
+
+        /**
+         * @brief Path to a to-be-generated Batsim-style CSV trace file (e.g. for batch schedule visualization purposes),
+         *        to which a line is appended each time a job leaves the service (regardless of the scheduling algorithm).
+         *        The trace file is generated in CVS format as follows:
          *          allocated_processors,consumed_energy,execution_time,finish_time,job_id,metadata,
          *          requested_number_of_processors,requested_time,starting_time,stretch,submission_time,success,
          *          turnaround_time,waiting_time,workload_name
-
+         *      - "" means "no CSV trace file"
          */
         DECLARE_PROPERTY_NAME(OUTPUT_CSV_JOB_LOG);
 
+        /**
+         * @brief Path to a to-be-generated binary job log file, i.e., a compact version of
+         *        the CSV trace file (see BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG) with
+         *        one fixed-size record per job (job ID, submit/start/end dates, requested time,
+         *        number of nodes, number of cores per node, and status). See BatchJobLog for the format.
+         *      - "" means "no binary job log file"
+         */
+        DECLARE_PROPERTY_NAME(OUTPUT_BINARY_JOB_LOG);
+
 
         /**
          * @brief Integral number of seconds that the Batch Scheduler adds to the runtime of each incoming
@@ -2,6 +2,7 @@
 #define WRENCH_BATCHJOB_H
 
 #include "wrench/workflow/job/StandardJob.h"
+#include "wrench/services/compute/batch/batch_schedulers/homegrown/BatchScheduleTime.h"
 
 namespace wrench {
 
@@ -19,6 +20,10 @@ namespace wrench {
         BatchJob(WorkflowJob* job, unsigned long job_id, unsigned long time_in_minutes, unsigned long number_nodes,
                  unsigned long cores_per_node, double ending_time_stamp, double arrival_time_stamp);
 
+        //jobid, -t, -N, -c, runtime, ram, arrival s4u_timestamp
+        BatchJob(unsigned long job_id, unsigned long time_in_minutes, unsigned long number_nodes,
+                 unsigned long cores_per_node, double runtime, double memory_requirement, double arrival_time_stamp);
+
 
         unsigned long getJobID();
         unsigned long getRequestedTime();
@@ -34,22 +39,26 @@ namespace wrench {
         void setEndingTimestamp(double time_stamp);
         std::map<std::string, std::tuple<unsigned long, double>> getResourcesAllocated();
         void setAllocatedResources(std::map<std::string, std::tuple<unsigned long, double>> resources);
+        bool isBackgroundJob();
+        double getBackgroundJobRuntime();
 
     private:
 
         friend class CONSERVATIVEBFBatchScheduler;
-        u_int32_t conservative_bf_start_date;           // Field used by CONSERVATIVE_BF
-        u_int32_t conservative_bf_expected_end_date;    // Field used by CONSERVATIVE_BF
+        BatchScheduleTime::ticks conservative_bf_start_date;           // Field used by CONSERVATIVE_BF
+        BatchScheduleTime::ticks conservative_bf_expected_end_date;    // Field used by CONSERVATIVE_BF
 
         unsigned long job_id;
         unsigned long requested_num_nodes;
         unsigned long  requested_time;
         WorkflowJob* job;
         unsigned long requested_cores_per_node;
-        double begin_time_stamp;
+        double begin_time_stamp = -1;
         double ending_time_stamp;
         double arrival_time_stamp;
         std::map<std::string, std::tuple<unsigned long, double>> resources_allocated;
+        double background_job_runtime = -1;             // Field used by background jobs only
+        double background_job_memory_requirement = 0;   // Field used by background jobs only
 
     public:
         // Variables below are for the BatSim-style CVS output log file (only ifdef ENABLED_BATSCHED)
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_BATCHJOBLOG_H
+#define WRENCH_BATCHJOBLOG_H
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "wrench/services/compute/batch/BatchJob.h"
+
+namespace wrench {
+
+    /***********************/
+    /** \cond DEVELOPER   */
+    /***********************/
+
+    /**
+     * @brief A columnar, in-memory log of the batch jobs that have left a BatchComputeService
+     *        (with submit, start, and end dates, and allocated nodes), along with aggregate
+     *        metrics (wait time, bounded slowdown, utilization) that are updated as
+     *        jobs are recorded. Records can also be streamed to a Batsim-style CSV file
+     *        and/or to a compact binary file.
+     */
+    class BatchJobLog {
+
+    public:
+
+        /** @brief Job exit statuses (with the same values as the "success" column of Batsim-style CSV files) */
+        enum JobStatus {
+            /** @brief The job failed (e.g., it timed out) **/
+            FAILED = 0,
+            /** @brief The job completed **/
+            COMPLETED = 1,
+            /** @brief The job was terminated **/
+            TERMINATED = 2
+        };
+
+        /** @brief The threshold (in seconds) used to compute bounded slowdowns **/
+        static constexpr double BOUNDED_SLOWDOWN_THRESHOLD = 10.0;
+
+        /***********************/
+        /** \cond INTERNAL    */
+        /***********************/
+
+        BatchJobLog(const std::vector<std::string> &hosts, unsigned long num_cores_per_host,
+                    std::string csv_file_path, std::string binary_file_path);
+
+        void recordJob(const std::shared_ptr<BatchJob> &batch_job, JobStatus status, double end_date);
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+        unsigned long getNumJobs() const;
+        unsigned long getJobID(unsigned long index) const;
+        double getSubmitDate(unsigned long index) const;
+        double getStartDate(unsigned long index) const;
+        double getEndDate(unsigned long index) const;
+        double getWaitTime(unsigned long index) const;
+        double getRequestedTime(unsigned long index) const;
+        unsigned long getNumNodes(unsigned long index) const;
+        unsigned long getNumCoresPerNode(unsigned long index) const;
+        JobStatus getStatus(unsigned long index) const;
+        std::vector<std::string> getAllocatedNodes(unsigned long index) const;
+
+        unsigned long getNumStartedJobs() const;
+        double getAverageWaitTime() const;
+        double getMaxWaitTime() const;
+        double getAverageBoundedSlowdown() const;
+        double getMaxBoundedSlowdown() const;
+        double getUtilization() const;
+
+    private:
+
+        void writeCSVRecord(unsigned long index);
+        void writeBinaryRecord(unsigned long index);
+
+        // Hosts
+        std::vector<std::string> hosts;
+        std::unordered_map<std::string, unsigned long> host_indices;
+        unsigned long num_cores_per_host;
+
+        // Columns (one entry per recorded job)
+        std::vector<unsigned long> job_ids;
+        std::vector<double> submit_dates;
+        std::vector<double> start_dates;  // -1 for jobs that never started
+        std::vector<double> end_dates;
+        std::vector<double> requested_times;
+        std::vector<unsigned long> num_nodes;
+        std::vector<unsigned long> num_cores_per_node;
+        std::vector<unsigned char> statuses;
+        std::vector<unsigned long> metadata_indices;
+        // Allocated host indices of job i are allocated_host_indices[allocation_offsets[i]..allocation_offsets[i+1]-1]
+        std::vector<unsigned long> allocated_host_indices;
+        std::vector<unsigned long> allocation_offsets = {0};
+
+        // Distinct metadata strings (typically only a handful)
+        std::vector<std::string> metadata_values;
+        std::unordered_map<std::string, unsigned long> metadata_value_indices;
+
+        // Aggregates (over jobs that have started)
+        unsigned long num_started_jobs = 0;
+        double total_wait_time = 0.0;
+        double max_wait_time = 0.0;
+        double total_bounded_slowdown = 0.0;
+        double max_bounded_slowdown = 0.0;
+        double total_core_seconds = 0.0;
+        double first_submit_date = -1.0;
+        double last_end_date = -1.0;
+
+        // Output files
+        std::ofstream csv_file;
+        std::ofstream binary_file;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+}
+
+#endif //WRENCH_BATCHJOBLOG_H
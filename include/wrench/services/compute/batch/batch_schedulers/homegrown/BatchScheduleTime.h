@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_BATCHSCHEDULETIME_H
+#define WRENCH_BATCHSCHEDULETIME_H
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+ * @brief The number of ticks per second used by the homegrown batch schedulers (i.e., the
+ *        resolution of their schedules), which can be overridden at compile time
+ */
+#ifndef WRENCH_BATCH_SCHEDULE_TICKS_PER_SECOND
+#define WRENCH_BATCH_SCHEDULE_TICKS_PER_SECOND 1000
+#endif
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A fixed-resolution time representation for batch schedules, in which dates and
+     *        durations are integral numbers of ticks (each tick is 1/TICKS_PER_SECOND seconds).
+     *        Dates are rounded down and durations are rounded up, so that a job with a
+     *        positive duration never gets a zero-length reservation. Arithmetic saturates
+     *        at INFINITE_DATE.
+     *
+     * @tparam T: the tick type (an unsigned integral type)
+     * @tparam TICKS_PER_SECOND: the number of ticks per second
+     */
+    template<typename T, T TICKS_PER_SECOND>
+    class BatchScheduleTimeResolution {
+
+        static_assert(std::is_integral<T>::value and std::is_unsigned<T>::value,
+                      "BatchScheduleTimeResolution: the tick type must be an unsigned integral type");
+        static_assert(TICKS_PER_SECOND > 0,
+                      "BatchScheduleTimeResolution: the number of ticks per second must be positive");
+
+    public:
+
+        /** @brief The tick type **/
+        typedef T ticks;
+
+        /** @brief The date that stands for "never" (and the upper bound of all schedules) **/
+        static constexpr T INFINITE_DATE = std::numeric_limits<T>::max();
+
+        /**
+         * @brief Convert a date in seconds to ticks (rounding down)
+         * @param date: a date in seconds
+         * @return a date in ticks
+         */
+        static T fromDate(double date) {
+            return toTicks(std::floor(date * (double) TICKS_PER_SECOND));
+        }
+
+        /**
+         * @brief Convert a duration in seconds to ticks (rounding up)
+         * @param duration: a duration in seconds
+         * @return a duration in ticks
+         */
+        static T fromDuration(double duration) {
+            return toTicks(std::ceil(duration * (double) TICKS_PER_SECOND));
+        }
+
+        /**
+         * @brief Convert ticks to seconds
+         * @param t: a date or duration in ticks
+         * @return a date or duration in seconds
+         */
+        static double toSeconds(T t) {
+            return (double) t / (double) TICKS_PER_SECOND;
+        }
+
+        /**
+         * @brief Add a duration to a date, saturating at INFINITE_DATE
+         * @param date: a date in ticks
+         * @param duration: a duration in ticks
+         * @return a date in ticks
+         */
+        static T add(T date, T duration) {
+            return (date >= INFINITE_DATE - duration) ? INFINITE_DATE : date + duration;
+        }
+
+    private:
+
+        static T toTicks(double t) {
+            if (not (t > 0)) {
+                return 0;
+            }
+            if (t >= (double) INFINITE_DATE) {
+                return INFINITE_DATE;
+            }
+            return (T) t;
+        }
+
+    };
+
+    template<typename T, T TICKS_PER_SECOND>
+    constexpr T BatchScheduleTimeResolution<T, TICKS_PER_SECOND>::INFINITE_DATE;
+
+    /** @brief The time representation used by the homegrown batch schedulers **/
+    typedef BatchScheduleTimeResolution<uint64_t, WRENCH_BATCH_SCHEDULE_TICKS_PER_SECOND> BatchScheduleTime;
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+}
+
+#endif //WRENCH_BATCHSCHEDULETIME_H
@@ -12,6 +12,9 @@
 #define WRENCH_CLOUDSERVICE_H
 
 #include <map>
+#include <set>
+#include <tuple>
+#include <unordered_map>
 #include <simgrid/s4u/VirtualMachine.hpp>
 
 #include "wrench/simulation/Simulation.h"
@@ -91,6 +94,12 @@ namespace wrench {
                                      std::map<std::string, std::string> property_list = {},
                                      std::map<std::string, double> messagepayload_list = {});
 
+        virtual std::vector<std::string> createVMs(unsigned long num_vms,
+                                                   unsigned long num_cores,
+                                                   double ram_memory,
+                                                   std::map<std::string, std::string> property_list = {},
+                                                   std::map<std::string, double> messagepayload_list = {});
+
         virtual void shutdownVM(const std::string &vm_name);
 
         virtual std::shared_ptr<BareMetalComputeService> startVM(const std::string &vm_name);
@@ -156,6 +165,12 @@ namespace wrench {
                                      std::map<std::string, double> messagepayload_list
         );
 
+        virtual void processCreateVMs(const std::string &answer_mailbox,
+                                      unsigned long num_vms,
+                                      unsigned long requested_num_cores,
+                                      double requested_ram,
+                                      std::map<std::string, std::string> property_list,
+                                      std::map<std::string, double> messagepayload_list);
 
         virtual void processStartVM(const std::string &answer_mailbox, const std::string &vm_name, const std::string &pm_name);
 
@@ -177,6 +192,12 @@ namespace wrench {
 
         void stopAllVMs();
 
+        void indexExecutionHosts();
+
+        void allocateVMResources(const std::string &vm_name, const std::string &pm_name);
+
+        void releaseVMResources(const std::string &vm_name);
+
         /** \cond */
         static unsigned long VM_ID;
         /** \endcond */
@@ -190,6 +211,19 @@ namespace wrench {
         /** @brief Map of number of used cores at the hosts */
         std::map<std::string, unsigned long> used_cores_per_execution_host;
 
+        /** @brief The total capacity of an execution host */
+        struct HostCapacity {
+            /** @brief The host's position in the execution host list */
+            unsigned long position;
+            /** @brief The host's number of cores */
+            unsigned long num_cores;
+            /** @brief The host's RAM capacity */
+            double ram;
+        };
+
+        /** @brief Map of execution host capacities (filled in by indexExecutionHosts()) */
+        std::unordered_map<std::string, HostCapacity> execution_host_capacities;
+
         /** @brief A map of VMs */
         std::map<std::string, std::pair<std::shared_ptr<S4U_VirtualMachine>, std::shared_ptr<BareMetalComputeService>>> vm_list;
 
@@ -200,6 +234,36 @@ namespace wrench {
     private:
         std::string findHost(unsigned long desired_num_cores, double desired_ram, std::string desired_host);
 
+        std::string findFirstFitHost(unsigned long node, unsigned long desired_num_cores, double desired_ram);
+
+        bool isHostUsable(const std::string &host);
+
+        bool canAccommodateVM(unsigned long num_cores, double ram);
+
+        std::string pickVMName(const std::string &desired_vm_name);
+
+        void updateHostResourceUsage(const std::string &host, unsigned long num_cores, double ram, bool allocate);
+
+        /** @brief Execution hosts ordered by available RAM, then available cores, then name */
+        std::set<std::tuple<double, unsigned long, std::string>> hosts_by_available_ram;
+
+        /** @brief Execution hosts ordered by available cores, then available RAM, then name */
+        std::set<std::tuple<unsigned long, double, std::string>> hosts_by_available_cores;
+
+        /** @brief A segment tree over the execution host list, in which each node holds the largest
+         *         available RAM and the largest number of available cores in its subtree (for first-fit) */
+        std::vector<std::pair<double, unsigned long>> first_fit_tree;
+
+        /** @brief The number of leaves in the first-fit segment tree */
+        unsigned long first_fit_tree_num_leaves = 0;
+
+        /** @brief Total host RAM capacities in increasing order, each with the largest number of cores
+         *         of any host with at least that much RAM */
+        std::vector<std::pair<double, unsigned long>> largest_host_capacities;
+
+        /** @brief Map of VM names to the names of the hosts whose resources they hold */
+        std::map<std::string, std::string> vm_resource_allocations;
+
     };
 }
 
@@ -24,11 +24,19 @@ namespace wrench {
         DECLARE_PROPERTY_NAME(VM_BOOT_OVERHEAD_IN_SECONDS);
         /** @brief The VM resource allocation algorithm by which VMs are started on physical hosts. Possible values are:
          *      - best-fit-ram-first (default): Start VMs on hosts using a best-fit algorithm,
-         *        considering first the RAM and then the number of cores
+         *        considering first the available RAM and then the number of available cores
          *      - best-fit-cores-first: Start VMs on hosts using a best-fit algorithm,
-         *        considering first the number of cores and then then RAM
+         *        considering first the number of available cores and then the available RAM
          *      - first-fit: a first-fit algorithm based on the order of the physical host list
          *
+         *    The best-fit searches start at the first host with enough of the first resource, and then
+         *    skip hosts that lack the second resource or are turned off, which takes time linear in the
+         *    number of hosts in the worst case (e.g., many hosts with plenty of RAM but few available cores).
+         *    The first-fit search descends a tree of per-host-range maximum available RAM and cores, which
+         *    is logarithmic in the number of hosts when it does not backtrack. It is also linear in the worst
+         *    case, since a range whose maxima fit may contain no single host that fits (e.g., one host with
+         *    plenty of RAM and another with plenty of cores) or only hosts that are turned off.
+         *
          **/
         DECLARE_PROPERTY_NAME(VM_RESOURCE_ALLOCATION_ALGORITHM);
     };
@@ -14,6 +14,8 @@
 #include <deque>
 #include "wrench/services/compute/ComputeService.h"
 #include "wrench/services/compute/htcondor/HTCondorCentralManagerServiceMessagePayload.h"
+#include "wrench/services/compute/htcondor/HTCondorComputeServiceProperty.h"
+#include "wrench/services/compute/htcondor/HTCondorNegotiatorService.h"
 
 namespace wrench {
 
@@ -22,7 +24,9 @@ namespace wrench {
      */
     class HTCondorCentralManagerService : public ComputeService {
     private:
-        std::map<std::string, std::string> default_property_values = {};
+        std::map<std::string, std::string> default_property_values = {
+                {HTCondorComputeServiceProperty::NEGOTIATOR_INTERVAL, "0"}
+        };
 
         std::map<std::string, double> default_messagepayload_values = {
                 {HTCondorCentralManagerServiceMessagePayload::STOP_DAEMON_MESSAGE_PAYLOAD,                  1024},
@@ -35,7 +39,8 @@ namespace wrench {
                 {HTCondorCentralManagerServiceMessagePayload::RESOURCE_DESCRIPTION_ANSWER_MESSAGE_PAYLOAD,  196000000},
                 {HTCondorCentralManagerServiceMessagePayload::STANDARD_JOB_DONE_MESSAGE_PAYLOAD,            512000000},
                 {HTCondorCentralManagerServiceMessagePayload::PILOT_JOB_STARTED_MESSAGE_PAYLOAD,            1024},
-                {HTCondorCentralManagerServiceMessagePayload::PILOT_JOB_EXPIRED_MESSAGE_PAYLOAD,            1024}
+                {HTCondorCentralManagerServiceMessagePayload::PILOT_JOB_EXPIRED_MESSAGE_PAYLOAD,            1024},
+                {HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_CYCLE_REQUEST_MESSAGE_PAYLOAD, 1024}
         };
 
     public:
@@ -89,20 +94,18 @@ namespace wrench {
 
         void processStandardJobCompletion(StandardJob *job);
 
-        void processNegotiatorCompletion(std::vector<WorkflowJob *> &pending_jobs);
+        void processNegotiatorCompletion(std::vector<WorkflowJob *> &scheduled_jobs, double cycle_time);
 
         void terminate();
 
         /** set of compute resources **/
         std::set<ComputeService *> compute_resources;
-        /** queue of pending jobs **/
-        std::vector<std::tuple<WorkflowJob *, std::map<std::string, std::string>>> pending_jobs;
+        /** the negotiator, which holds the pending jobs and the numbers of idle cores of compute resources **/
+        std::shared_ptr<HTCondorNegotiatorService> negotiator;
         /** whether a negotiator is dispatching jobs **/
         bool dispatching_jobs = false;
         /** whether a negotiator could not dispatch jobs **/
         bool resources_unavailable = false;
-        /** **/
-        std::map<std::shared_ptr<ComputeService>, unsigned long> compute_resources_map;
         /** running workflow jobs **/
         std::map<WorkflowJob *, std::shared_ptr<ComputeService>> running_jobs;
     };
@@ -36,10 +36,20 @@ namespace wrench {
      */
     class NegotiatorCompletionMessage : public HTCondorCentralManagerServiceMessage {
     public:
-        NegotiatorCompletionMessage(std::vector<WorkflowJob *> scheduled_jobs, double payload);
+        NegotiatorCompletionMessage(std::vector<WorkflowJob *> scheduled_jobs, double cycle_time, double payload);
 
         /** @brief List of scheduled jobs */
         std::vector<WorkflowJob *> scheduled_jobs;
+        /** @brief The duration of the negotiation cycle, in seconds */
+        double cycle_time;
+    };
+
+    /**
+     * @brief A message received by a HTCondorNegotiatorService so that it starts a negotiation cycle
+     */
+    class NegotiatorCycleRequestMessage : public HTCondorCentralManagerServiceMessage {
+    public:
+        NegotiatorCycleRequestMessage(double payload);
     };
 
     /***********************/
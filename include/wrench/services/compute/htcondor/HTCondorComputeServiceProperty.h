@@ -20,7 +20,11 @@ namespace wrench {
     class HTCondorComputeServiceProperty : public ComputeServiceProperty {
 
     public:
-
+        /** @brief The minimum time, in seconds, between the starts of two consecutive negotiation cycles of the
+         *         HTCondor negotiator (default: "0", i.e., a negotiation cycle starts as soon as there are pending jobs
+         *         and resources may have become available)
+         **/
+        DECLARE_PROPERTY_NAME(NEGOTIATOR_INTERVAL);
     };
 }
 
@@ -10,6 +10,7 @@
 #ifndef WRENCH_HTCONDORNEGOTIATORSERVICE_H
 #define WRENCH_HTCONDORNEGOTIATORSERVICE_H
 
+#include <set>
 #include "wrench/services/Service.h"
 #include "wrench/services/compute/ComputeService.h"
 #include "wrench/services/compute/htcondor/HTCondorCentralManagerServiceMessagePayload.h"
@@ -21,41 +22,91 @@ namespace wrench {
     /** \cond DEVELOPER    */
     /***********************/
     /**
-     * @brief A HTCondor negotiator service
+     * @brief A HTCondor negotiator service, which runs for as long as its central manager and
+     *        performs matchmaking cycles (at most one per negotiation interval) between pending jobs,
+     *        considered in priority order, and compute resources, indexed by their numbers of idle cores
      */
     class HTCondorNegotiatorService : public Service {
     private:
         std::map<std::string, double> default_messagepayload_values = {
-                {HTCondorCentralManagerServiceMessagePayload::STOP_DAEMON_MESSAGE_PAYLOAD,              1024},
-                {HTCondorCentralManagerServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD,           1024},
-                {HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_DONE_MESSAGE_PAYLOAD, 1024},
+                {HTCondorCentralManagerServiceMessagePayload::STOP_DAEMON_MESSAGE_PAYLOAD,                       1024},
+                {HTCondorCentralManagerServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD,                    1024},
+                {HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_DONE_MESSAGE_PAYLOAD,          1024},
+                {HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_CYCLE_REQUEST_MESSAGE_PAYLOAD, 1024},
         };
 
     public:
 
         HTCondorNegotiatorService(std::string &hostname,
-                                  std::map<std::shared_ptr<ComputeService>, unsigned long> &compute_resources,
+                                  double negotiator_interval,
                                   std::map<WorkflowJob *, std::shared_ptr<ComputeService>> &running_jobs,
-                                  std::vector<std::tuple<WorkflowJob *, std::map<std::string, std::string>>> &pending_jobs,
                                   std::string &reply_mailbox);
 
         ~HTCondorNegotiatorService();
 
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        void addComputeResource(const std::shared_ptr<ComputeService> &compute_resource, unsigned long num_idle_cores);
+
+        void releaseCores(const std::shared_ptr<ComputeService> &compute_resource, unsigned long num_cores);
+
+        void addPendingJob(WorkflowJob *job, const std::map<std::string, std::string> &service_specific_args);
+
+        unsigned long getNumPendingJobs();
+
+        void clear();
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
     private:
         int main() override;
 
-        struct JobPriorityComparator {
-            bool operator()(std::tuple<WorkflowJob *, std::map<std::string, std::string>> &lhs,
-                            std::tuple<WorkflowJob *, std::map<std::string, std::string>> &rhs);
+        bool processNextMessage(double timeout);
+
+        void runNegotiationCycle();
+
+        void setNumIdleCores(const std::shared_ptr<ComputeService> &compute_resource, unsigned long num_idle_cores);
+
+        /** @brief A pending job, along with its priority and submission order (which breaks priority ties) */
+        struct PendingJob {
+            /** @brief The job priority **/
+            unsigned long priority;
+            /** @brief The job submission sequence number **/
+            unsigned long sequence_number;
+            /** @brief The job **/
+            WorkflowJob *job;
+            /** @brief The service-specific arguments **/
+            std::map<std::string, std::string> service_specific_args;
+        };
+
+        struct PendingJobComparator {
+            bool operator()(const PendingJob &lhs, const PendingJob &rhs) const;
         };
 
         /** mailbox to reply **/
         std::string reply_mailbox;
-        /** set of compute resources **/
-        std::map<std::shared_ptr<ComputeService>, unsigned long> *compute_resources;
+        /** minimum time between the starts of two negotiation cycles **/
+        double negotiator_interval;
+        /** date at which the next negotiation cycle may start **/
+        double next_cycle_date = 0;
+        /** whether a negotiation cycle has been requested **/
+        bool cycle_requested = false;
+        /** running jobs (owned by the central manager) **/
         std::map<WorkflowJob *, std::shared_ptr<ComputeService>> *running_jobs;
-        /** queue of pending jobs **/
-        std::vector<std::tuple<WorkflowJob *, std::map<std::string, std::string>>> pending_jobs;
+        /** pending jobs, in decreasing priority order (and in submission order for equal priorities) **/
+        std::set<PendingJob, PendingJobComparator> pending_jobs;
+        /** number of jobs submitted so far **/
+        unsigned long num_submitted_jobs = 0;
+        /** number of idle cores of each compute resource **/
+        std::map<std::shared_ptr<ComputeService>, unsigned long> num_idle_cores;
+        /** compute resources that support standard jobs, indexed by their numbers of idle cores **/
+        std::set<std::pair<unsigned long, std::shared_ptr<ComputeService>>> idle_cores_index;
+        /** compute resources that support pilot jobs **/
+        std::vector<std::shared_ptr<ComputeService>> pilot_job_compute_resources;
     };
 
     /***********************/
@@ -19,7 +19,9 @@
 #include "wrench/services/compute/standard_job_executor/StandardJobExecutorProperty.h"
 #include "wrench/services/compute/standard_job_executor/StandardJobExecutorMessagePayload.h"
 #include "wrench/services/compute/workunit_executor/Workunit.h"
+#include "wrench/services/compute/workunit_executor/ReadyWorkunitQueue.h"
 #include "wrench/services/helpers/HostStateChangeDetector.h"
+#include "wrench/services/helpers/ServiceLivenessMonitor.h"
 
 
 namespace wrench {
@@ -102,7 +104,7 @@ namespace wrench {
 
         // Work units
         std::set<std::shared_ptr<Workunit>> non_ready_workunits;
-        std::set<std::shared_ptr<Workunit>> ready_workunits;
+        ReadyWorkunitQueue ready_workunits;
         std::set<std::shared_ptr<Workunit>> running_workunits;
         std::set<std::shared_ptr<Workunit>> completed_workunits;
 
@@ -123,6 +125,7 @@ namespace wrench {
         };
 
         std::shared_ptr<HostStateChangeDetector> host_state_monitor;
+        std::shared_ptr<ServiceLivenessMonitor> workunit_executor_monitor;
 
         int main() override;
 
@@ -145,7 +148,6 @@ namespace wrench {
 
 //        void createWorkunits();
 
-        std::vector<std::shared_ptr<Workunit>> sortReadyWorkunits();
 
         //Clean up scratch
         void cleanUpScratch();
@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_READYWORKUNITQUEUE_H
+#define WRENCH_READYWORKUNITQUEUE_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace wrench {
+
+    class Workunit;
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A queue of ready Workunits ordered by a task selection policy, with
+     *        logarithmic-time insertion and removal (of any Workunit). Non-computational
+     *        Workunits always come first (in insertion order). Priority keys are computed when
+     *        a Workunit is inserted, so that later changes to its task do not corrupt the queue.
+     */
+    class ReadyWorkunitQueue {
+
+    private:
+
+        struct Key {
+            bool has_task;
+            double priority;    // lower comes first
+            std::string task_id;   // higher comes first (among equal priorities)
+            uint64_t sequence_number;   // lower comes first
+
+            bool operator<(const Key &other) const;
+        };
+
+        typedef std::map<Key, std::shared_ptr<Workunit>> EntryMap;
+
+    public:
+
+        /** @brief Task selection policies */
+        enum Policy {
+            /** @brief Computational Workunits are selected in insertion order */
+            FIFO,
+            /** @brief Workunits with the most flops are selected first */
+            MAXIMUM_FLOPS,
+            /** @brief Workunits with the largest minimum number of cores are selected first */
+            MAXIMUM_MINIMUM_CORES,
+            /** @brief Workunits with the lowest top level are selected first */
+            MINIMUM_TOP_LEVEL
+        };
+
+        static Policy parsePolicy(const std::string &name);
+
+        /**
+         * @brief An iterator over the queue's Workunits, in priority order
+         */
+        class const_iterator {
+        public:
+            /** @brief Dereference operator @return a Workunit */
+            const std::shared_ptr<Workunit> &operator*() const { return this->it->second; }
+            /** @brief Member access operator @return a Workunit */
+            const std::shared_ptr<Workunit> *operator->() const { return &(this->it->second); }
+            /** @brief Increment operator @return the iterator */
+            const_iterator &operator++() { ++(this->it); return *this; }
+            /** @brief Equality operator @param other: an iterator @return true if equal */
+            bool operator==(const const_iterator &other) const { return this->it == other.it; }
+            /** @brief Inequality operator @param other: an iterator @return true if not equal */
+            bool operator!=(const const_iterator &other) const { return this->it != other.it; }
+
+        private:
+            friend class ReadyWorkunitQueue;
+            explicit const_iterator(EntryMap::const_iterator it) : it(it) {}
+            EntryMap::const_iterator it;
+        };
+
+        explicit ReadyWorkunitQueue(Policy policy = FIFO);
+
+        void insert(const std::shared_ptr<Workunit> &workunit);
+        bool erase(const std::shared_ptr<Workunit> &workunit);
+        const_iterator erase(const_iterator position);
+        bool contains(const std::shared_ptr<Workunit> &workunit) const;
+        void clear();
+
+        /** @brief Get the number of Workunits in the queue @return a number of Workunits */
+        size_t size() const { return this->entries.size(); }
+        /** @brief Check whether the queue is empty @return true or false */
+        bool empty() const { return this->entries.empty(); }
+        /** @brief Get an iterator to the highest-priority Workunit @return an iterator */
+        const_iterator begin() const { return const_iterator(this->entries.cbegin()); }
+        /** @brief Get the past-the-end iterator @return an iterator */
+        const_iterator end() const { return const_iterator(this->entries.cend()); }
+
+    private:
+
+        Policy policy;
+        uint64_t next_sequence_number = 0;
+        EntryMap entries;
+        std::unordered_map<Workunit *, EntryMap::iterator> index;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_READYWORKUNITQUEUE_H
@@ -44,6 +44,14 @@ namespace wrench {
                 std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation>>> post_file_copies,
                 std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>>> cleanup_file_deletions);
 
+        Workunit(
+                StandardJob *job,
+                std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation>>> pre_file_copies,
+                WorkflowTask *task,
+                std::shared_ptr<const std::map<WorkflowFile *, std::shared_ptr<FileLocation>>> file_locations,
+                std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation>>> post_file_copies,
+                std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>>> cleanup_file_deletions);
+
         static void addDependency(std::shared_ptr<Workunit> parent, std::shared_ptr<Workunit> child);
 
         static std::set<std::shared_ptr<Workunit>> createWorkunits(StandardJob *job);
@@ -62,8 +70,8 @@ namespace wrench {
         std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation>>> pre_file_copies;
         /** @brief Computational task to perform */
         WorkflowTask *task = nullptr;
-        /** @brief Locations where computational tasks should read/write files */
-        std::map<WorkflowFile *, std::shared_ptr<FileLocation>> file_locations;
+        /** @brief Locations where computational tasks should read/write files (an immutable table, shared by all task Workunits of a job) */
+        std::shared_ptr<const std::map<WorkflowFile *, std::shared_ptr<FileLocation>>> file_locations;
         /** @brief File copies to perform after computational tasks completes */
         std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation>>> post_file_copies;
         /** @brief File deletions to perform last */
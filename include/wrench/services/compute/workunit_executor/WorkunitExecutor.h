@@ -26,7 +26,6 @@ namespace wrench {
     class StandardJob;
     class WorkerThreadWork;
     class Workunit;
-    class ComputeThread;
     class WorkflowJob;
     class SimulationTimestampTaskFailure;
 
@@ -87,7 +86,8 @@ namespace wrench {
         std::shared_ptr<StorageService> scratch_space;
 
         std::set<WorkflowFile* > files_stored_in_scratch;
-        std::vector<std::shared_ptr<ComputeThread>> compute_threads;
+        // The (asynchronous) per-core executions of the current computation, if any
+        std::vector<simgrid::s4u::ExecPtr> compute_activities;
 
         // a reference to the job it is a part of (currently required for creating the /tmp directory in scratch space)
         StandardJob* job;
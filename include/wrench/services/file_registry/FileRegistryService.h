@@ -12,6 +12,8 @@
 #define WRENCH_FILEREGISTRYSERVICE_H
 
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include <wrench/services/Service.h>
 #include <wrench/services/network_proximity/NetworkProximityService.h>
@@ -31,7 +33,9 @@ namespace wrench {
      * @brief A file registry service (a.k.a. replica catalog) that holds a database
      *        of which files are available at which storage services. More specifically,
      *        the database holds a set of <file, storage service> entries. A WMS can add,
-     *        lookup, and remove entries at will from this database.
+     *        lookup, and remove entries at will from this database. The database can be
+     *        sharded (by file) over several daemons (see FileRegistryServiceProperty::NUM_SHARDS),
+     *        in which case each request is routed to the shard responsible for its file(s).
      */
     class FileRegistryService : public Service {
 
@@ -44,6 +48,7 @@ namespace wrench {
                 {FileRegistryServiceProperty::LOOKUP_COMPUTE_COST,                      "0.0"},
                 {FileRegistryServiceProperty::ADD_ENTRY_COMPUTE_COST,                   "0.0"},
                 {FileRegistryServiceProperty::REMOVE_ENTRY_COMPUTE_COST,                "0.0"},
+                {FileRegistryServiceProperty::NUM_SHARDS,                               "1"},
         };
 
         std::map<std::string, double> default_messagepayload_values = {
@@ -79,6 +84,16 @@ namespace wrench {
 
         void removeEntry(WorkflowFile *file, std::shared_ptr<FileLocation> location);
 
+        std::map<WorkflowFile *, std::set<std::shared_ptr<FileLocation>>> lookupEntries(std::vector<WorkflowFile *> files);
+
+        std::map<WorkflowFile *, std::vector<std::pair<double, std::shared_ptr<FileLocation>>>>
+        lookupEntries(std::vector<WorkflowFile *> files, std::string reference_host,
+                      std::shared_ptr<NetworkProximityService> network_proximity_service);
+
+        void addEntries(std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> entries);
+
+        void removeEntries(std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> entries);
+
         /****************************/
         /** \endcond                */
         /****************************/
@@ -97,15 +112,48 @@ namespace wrench {
 
         friend class Simulation;
 
+        unsigned long getShardIndex(WorkflowFile *file);
+
+        FileRegistryService *getShard(unsigned long shard_index);
+
         void addEntryToDatabase(WorkflowFile *file, std::shared_ptr<FileLocation> location);
 
         bool removeEntryFromDatabase(WorkflowFile *file, std::shared_ptr<FileLocation> location);
 
+        std::set<std::shared_ptr<FileLocation>> lookupEntryInDatabase(WorkflowFile *file);
+
+        unsigned long internLocation(const std::shared_ptr<FileLocation> &location);
+
+        void releaseLocation(unsigned long id);
+
+        std::vector<std::pair<double, std::shared_ptr<FileLocation>>>
+        rankEntriesByProximity(WorkflowFile *file, const std::string &reference_host,
+                               const std::shared_ptr<NetworkProximityService> &network_proximity_service);
+
+        NetworkProximitySnapshot *getNetworkProximitySnapshot(
+                const std::shared_ptr<NetworkProximityService> &network_proximity_service);
+
         int main() override;
 
         bool processNextMessage();
 
-        std::map<WorkflowFile *, std::set<std::shared_ptr<FileLocation>>> entries;
+        // The other shards (this service is shard #0), which are started by main()
+        std::vector<std::shared_ptr<FileRegistryService>> shards;
+
+        // The database: file ID -> IDs of the file's locations
+        std::unordered_map<std::string, std::vector<unsigned long>> entries;
+
+        // Interned locations (indexed by location ID), the number of entries each of them is in (a location
+        // is released when that number drops to zero), the IDs of released locations (for reuse), and
+        // location IDs by storage service and full path
+        std::vector<std::shared_ptr<FileLocation>> locations;
+        std::vector<unsigned long> location_num_entries;
+        std::vector<unsigned long> free_location_ids;
+        std::unordered_map<StorageService *, std::unordered_map<std::string, unsigned long>> location_ids;
+
+        // Proximity data pushed by the network proximity services used for ranked lookups
+        std::map<NetworkProximityService *, NetworkProximitySnapshot> network_proximity_snapshots;
+        std::set<std::shared_ptr<NetworkProximityService>> subscribed_network_proximity_services;
     };
 
 
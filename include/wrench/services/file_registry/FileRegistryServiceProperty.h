@@ -38,6 +38,12 @@ namespace wrench {
          * removing an entry for a file
          */
         DECLARE_PROPERTY_NAME(REMOVE_ENTRY_COMPUTE_COST);
+
+        /**
+         * @brief The number of daemons (all on the service's host) over which
+         * the database is sharded, by file (default: 1)
+         */
+        DECLARE_PROPERTY_NAME(NUM_SHARDS);
         
     };
 
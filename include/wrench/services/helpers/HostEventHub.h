@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_HOSTEVENTHUB_H
+#define WRENCH_HOSTEVENTHUB_H
+
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace simgrid {
+    namespace s4u {
+        class Host;
+    }
+}
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    class HostStateChangeDetector;
+
+    /**
+     * @brief A simulation-wide hub that connects to the SimGrid host state/speed change signals
+     *        once, and dispatches each host event only to the HostStateChangeDetector instances
+     *        that monitor that host (using per-host subscriber lists indexed by a dense host ID)
+     */
+    class HostEventHub {
+
+    public:
+
+        static void subscribe(HostStateChangeDetector *detector, const std::vector<std::string> &hostnames,
+                              bool state_changes, bool speed_changes);
+
+        static void unsubscribe(HostStateChangeDetector *detector);
+
+    private:
+
+        static unsigned long getHostId(const std::string &hostname);
+
+        static void connectCallBacks();
+        static void disconnectCallBacks();
+
+        static void hostStateChangeCallback(simgrid::s4u::Host const &host);
+        static void hostSpeedChangeCallback(simgrid::s4u::Host const &host);
+
+        static void removeSubscriber(std::vector<std::vector<HostStateChangeDetector *>> &subscribers,
+                                     HostStateChangeDetector *detector, const std::vector<unsigned long> &host_ids);
+
+        /** @brief Dense host IDs, indexed by hostname */
+        static std::unordered_map<std::string, unsigned long> host_ids;
+        /** @brief Detectors subscribed to state changes, indexed by host ID */
+        static std::vector<std::vector<HostStateChangeDetector *>> state_change_subscribers;
+        /** @brief Detectors subscribed to speed changes, indexed by host ID */
+        static std::vector<std::vector<HostStateChangeDetector *>> speed_change_subscribers;
+        /** @brief The IDs of the hosts each detector is subscribed to, and the kinds of events it is subscribed to */
+        static std::unordered_map<HostStateChangeDetector *, std::tuple<std::vector<unsigned long>, bool, bool>> subscriptions;
+
+        static bool call_backs_connected;
+        static unsigned int on_state_change_call_back_id;
+        static unsigned int on_speed_change_call_back_id;
+
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_HOSTEVENTHUB_H
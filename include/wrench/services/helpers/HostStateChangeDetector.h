@@ -10,9 +10,9 @@
 #ifndef WRENCH_HOSTSTATECHANGEDETECTOR_H
 #define WRENCH_HOSTSTATECHANGEDETECTOR_H
 
+#include <deque>
 #include <wrench/services/Service.h>
 #include "wrench/simgrid_S4U_util/S4U_Daemon.h"
-#include "HostStateChangeDetectorProperty.h"
 
 namespace wrench {
 
@@ -20,15 +20,16 @@ namespace wrench {
     /** \cond INTERNAL     */
     /***********************/
 
+    class HostStateChangeDetectorMessage;
+
     /**
      * @brief A service that detects and reports on host state changes (turned on, turned off)
+     *        and host speed changes. Host events are dispatched to it by the HostEventHub as
+     *        they happen, and it forwards them to a mailbox.
      */
     class HostStateChangeDetector : public Service {
 
-    private:
-        std::map<std::string, std::string> default_property_values = {
-                {HostStateChangeDetectorProperty::MONITORING_PERIOD,                            "1.0"}
-        };
+        friend class HostEventHub;
 
     public:
 
@@ -42,32 +43,33 @@ namespace wrench {
                                          std::map<std::string, std::string> property_list = {}
         );
 
+        ~HostStateChangeDetector() override;
+
         void kill();
 
 
     private:
 
         void cleanup(bool has_terminated_cleanly, int return_value) override;
-        void hostStateChangeCallback(std::string const &hostname);
-        void hostSpeedChangeCallback(std::string const &hostname);
+        void hostStateHasChanged(std::string const &hostname, bool is_on);
+        void hostSpeedHasChanged(std::string const &hostname, double speed);
+        void creatorHasExited();
 
-        std::vector<std::string> hosts_to_monitor;
         bool notify_when_turned_on;
         bool notify_when_turned_off;
         bool notify_when_speed_change;
         std::string mailbox_to_notify;
         int main() override;
 
-        std::vector<std::pair<std::string, bool>> hosts_that_have_recently_changed_state;
-        std::vector<std::pair<std::string, double>> hosts_that_have_recently_changed_speed;
+        // Host changes that haven't been reported on yet, in the order in which they happened
+        // (protected by the mutex, as is creator_has_exited)
+        std::deque<HostStateChangeDetectorMessage *> pending_notifications;
+        bool creator_has_exited = false;
 
         std::shared_ptr<S4U_Daemon> creator;
 
-        std::vector<std::string> hosts_that_have_recently_turned_on;
-        std::vector<std::string> hosts_that_have_recently_turned_off;
-
-        unsigned int on_state_change_call_back_id;
-        unsigned int on_speed_change_call_back_id;
+        simgrid::s4u::MutexPtr mutex;
+        simgrid::s4u::ConditionVariablePtr condition;
 
     };
 
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SERVICELIVENESSMONITOR_H
+#define WRENCH_SERVICELIVENESSMONITOR_H
+
+#include <deque>
+#include <tuple>
+
+#include "wrench/services/Service.h"
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A service that monitors any number of services and notifies some mailbox when
+     *        they crash and/or terminate (it sends the same messages as ServiceTerminationDetector).
+     *        Terminations are detected by lightweight watcher actors (with no mailbox) that join the
+     *        monitored services, and notifications are sent from the monitor's host. The monitor
+     *        terminates when its creator terminates.
+     */
+    class ServiceLivenessMonitor : public Service {
+
+    public:
+
+        explicit ServiceLivenessMonitor(std::string host_on_which_to_run,
+                                        std::shared_ptr<S4U_Daemon> creator,
+                                        std::string mailbox_to_notify,
+                                        bool notify_on_crash,
+                                        bool notify_on_termination);
+
+        void monitor(std::shared_ptr<Service> service);
+
+        void kill();
+
+    private:
+
+        int main() override;
+        void cleanup(bool has_returned_from_main, int return_value) override;
+
+        void serviceHasExited(std::shared_ptr<Service> service, bool has_returned_from_main, int return_value);
+        void creatorHasExited();
+
+        std::shared_ptr<S4U_Daemon> creator;
+        std::string mailbox_to_notify;
+        bool notify_on_crash;
+        bool notify_on_termination;
+
+        // Services that have exited but haven't been reported on yet: <service, has_returned_from_main, return_value>
+        // (protected by the mutex, as is creator_has_exited)
+        std::deque<std::tuple<std::shared_ptr<Service>, bool, int>> exited_services;
+        bool creator_has_exited = false;
+
+        simgrid::s4u::MutexPtr mutex;
+        simgrid::s4u::ConditionVariablePtr condition;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_SERVICELIVENESSMONITOR_H
@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_TIMERSERVICE_H
+#define WRENCH_TIMERSERVICE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <wrench/services/Service.h>
+#include "wrench/simulation/SimulationMessage.h"
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    class TimerService;
+
+    /**
+     * @brief A cancellable handle to a deadline registered with a TimerService
+     */
+    class Timer {
+
+        friend class TimerService;
+
+    public:
+
+        ~Timer();
+
+        void cancel();
+
+        bool isPending();
+
+        double getDate();
+
+    private:
+
+        Timer(std::shared_ptr<TimerService> timer_service, double date, const std::string &reply_mailbox_name,
+              SimulationMessage *msg);
+
+        /** @brief The timer service with which the deadline is registered */
+        std::weak_ptr<TimerService> timer_service;
+        /** @brief The date at which the message should be sent */
+        double date;
+        /** @brief The mailbox to which the message should be sent */
+        std::string reply_mailbox_name;
+        /** @brief The message to send (nullptr once sent or cancelled) */
+        SimulationMessage *msg;
+
+    };
+
+    /**
+     * @brief A service that sends messages to mailboxes at registered dates. A single
+     *        daemon, driven by a heap of deadlines, replaces one Alarm actor per deadline.
+     *        There is at most one such service per host in a simulation (see Simulation::getTimerService()),
+     *        so that messages are sent from the host on which deadlines were registered.
+     */
+    class TimerService : public Service {
+
+        friend class Timer;
+
+    public:
+
+        explicit TimerService(std::string hostname);
+
+        std::shared_ptr<Timer> setTimer(double date, const std::string &reply_mailbox_name, SimulationMessage *msg);
+
+        unsigned long getNumPendingTimers();
+
+    private:
+
+        /** @brief An entry in the heap of deadlines */
+        struct Deadline {
+            /** @brief The deadline's date */
+            double date;
+            /** @brief A sequence number, so that deadlines with the same date go off in registration order */
+            unsigned long sequence_number;
+            /** @brief The timer (which may have been cancelled since its registration) */
+            std::shared_ptr<Timer> timer;
+        };
+
+        /** @brief A comparator that puts the earliest deadline at the top of the heap */
+        struct DeadlineComparator {
+            /**
+             * @brief Compare two deadlines
+             * @param lhs: a deadline
+             * @param rhs: a deadline
+             * @return true if lhs goes off after rhs
+             */
+            bool operator()(const Deadline &lhs, const Deadline &rhs) const {
+                if (lhs.date != rhs.date) {
+                    return lhs.date > rhs.date;
+                }
+                return lhs.sequence_number > rhs.sequence_number;
+            }
+        };
+
+        /** @brief The deadlines, organized as a heap (cancelled deadlines are removed lazily) */
+        std::vector<Deadline> deadlines;
+        unsigned long sequence_number = 0;
+        unsigned long num_cancelled_deadlines = 0;
+        bool wake_up_message_pending = false;
+
+        void timerHasBeenCancelled();
+        void compactDeadlines();
+        void discardCancelledDeadlines();
+        void sendExpiredTimerMessages(double date);
+
+        int main() override;
+        void cleanup(bool has_returned_from_main, int return_value) override;
+
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+}
+
+#endif //WRENCH_TIMERSERVICE_H
@@ -0,0 +1,43 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_TIMERSERVICEMESSAGE_H
+#define WRENCH_TIMERSERVICEMESSAGE_H
+
+#include <wrench/simulation/SimulationMessage.h>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief Top-level class for messages received/sent by a TimerService
+     */
+    class TimerServiceMessage : public SimulationMessage {
+    protected:
+        explicit TimerServiceMessage(std::string name);
+    };
+
+    /**
+     * @brief A message sent to a TimerService so that it reconsiders its earliest deadline
+     */
+    class TimerServiceWakeUpMessage : public TimerServiceMessage {
+    public:
+        TimerServiceWakeUpMessage();
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_TIMERSERVICEMESSAGE_H
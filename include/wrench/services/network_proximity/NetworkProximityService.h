@@ -10,7 +10,9 @@
 #ifndef WRENCH_NETWORKPROXIMITYSERVICE_H
 #define WRENCH_NETWORKPROXIMITYSERVICE_H
 
-#include <complex>
+#include <map>
+#include <unordered_map>
+#include <set>
 #include <random>
 #include <cfloat>
 #include "wrench/services/Service.h"
@@ -19,6 +21,49 @@
 
 namespace wrench{
 
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A snapshot of (part of) the proximity data of a NetworkProximityService, which the
+     *        service pushes to subscribers so that they can compute distances locally
+     */
+    class NetworkProximitySnapshot {
+
+    public:
+        /** @brief Whether the snapshot holds Vivaldi coordinates (true) or all-to-all measurements (false) */
+        bool vivaldi = false;
+        /** @brief Whether the snapshot holds the parameters of analytical estimates (in which case
+         *         the vivaldi, entries, and coordinates fields are not used) */
+        bool analytical = false;
+        /** @brief Analytical estimates: the message size used to compute the transfer time */
+        double analytical_message_size = 0.0;
+        /** @brief Analytical estimates: the maximum relative noise */
+        double analytical_noise = 0.0;
+        /** @brief Analytical estimates: the noise seed */
+        unsigned long analytical_seed = 0;
+        /** @brief All-to-all measurements: <proximity value, timestamp> values indexed by host pairs */
+        std::map<std::pair<std::string, std::string>, std::pair<double, double>> entries;
+        /** @brief The number of dimensions of the Vivaldi coordinate space */
+        unsigned long vivaldi_dimensions = 2;
+        /** @brief Whether Vivaldi coordinates include a height component (stored after the other components) */
+        bool vivaldi_height = false;
+        /** @brief Vivaldi coordinates: <coordinate components, timestamp> values indexed by hostnames */
+        std::map<std::string, std::pair<std::vector<double>, double>> coordinates;
+
+        void update(const NetworkProximitySnapshot &update);
+
+        double getHostPairDistance(const std::string &host1, const std::string &host2) const;
+
+    private:
+        mutable std::map<std::pair<std::string, std::string>, double> analytical_cache;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
     /**
      * @brief A network proximity service that continuously estimates inter-host latencies
      *        and can be queried for such estimates
@@ -33,7 +78,10 @@ namespace wrench{
                 {NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD,       "60"},
                 {NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD_MAX_NOISE, "20"},
                 {NetworkProximityServiceProperty::NETWORK_DAEMON_COMMUNICATION_COVERAGE,    "1.0"},
-                {NetworkProximityServiceProperty::NETWORK_PROXIMITY_PEER_LOOKUP_SEED, "1"}
+                {NetworkProximityServiceProperty::NETWORK_PROXIMITY_PEER_LOOKUP_SEED, "1"},
+                {NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_DIMENSIONS, "2"},
+                {NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_HEIGHT, "false"},
+                {NetworkProximityServiceProperty::NETWORK_PROXIMITY_ANALYTICAL_NOISE, "0.0"}
         };
 
         std::map<std::string, double> default_messagepayload_values = {
@@ -96,6 +144,7 @@ namespace wrench{
         std::vector<std::string> hosts_in_network;
 
         std::default_random_engine master_rng;
+        std::uniform_int_distribution<unsigned long> peer_udist;
 
         int main() override;
 
@@ -105,14 +154,42 @@ namespace wrench{
 
         std::map<std::pair<std::string,std::string>,std::pair<double,double>> entries;
 
-        std::map<std::string, std::pair<std::complex<double>, double>> coordinate_lookup_table;
+        // Per-daemon pre-computed subsets of candidate measurement peers (indices into network_daemons)
+        std::unordered_map<const NetworkProximityDaemon *, unsigned long> daemon_indices;
+        std::vector<std::vector<unsigned long>> peer_subsets;
+
+        // Vivaldi coordinates, stored contiguously with vivaldi_stride components per host
+        bool vivaldi = false;
+        unsigned long vivaldi_dimensions = 2;
+        bool vivaldi_height = false;
+        unsigned long vivaldi_stride = 2;
+        std::unordered_map<std::string, unsigned long> vivaldi_host_indices;
+        std::vector<double> vivaldi_coordinates;
+        std::vector<double> vivaldi_timestamps;
+        std::vector<double> vivaldi_direction;
+
+        void computePeerSubsets();
 
         std::shared_ptr<NetworkProximityDaemon> getCommunicationPeer(const std::shared_ptr<NetworkProximityDaemon>  sender_daemon);
 
-        void vivaldiUpdate(double proximityValue, std::string sender_hostname, std::string peer_hostname);
+        void vivaldiUpdate(double proximityValue, const std::string &sender_hostname, const std::string &peer_hostname);
+
+        double getVivaldiDistance(const std::string &host1, const std::string &host2, double *timestamp);
+
+        // Analytical estimates, computed lazily from the platform's routes
+        bool analytical = false;
+        std::map<std::pair<std::string, std::string>, double> analytical_cache;
+
+        double getAnalyticalDistance(const std::string &host1, const std::string &host2);
 
         void validateProperties();
 
+        NetworkProximitySnapshot getSnapshot();
+
+        void pushSnapshotUpdate(std::pair<std::string, std::string> hosts);
+
+        std::set<std::string> snapshot_subscriber_mailboxes;
+
     };
 }
 
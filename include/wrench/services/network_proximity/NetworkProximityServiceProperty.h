@@ -27,6 +27,9 @@ namespace wrench {
         /** @brief The type of network proximity implementation to be used:
          *   - ALLTOALL: a simple all-to-all algorithm (default)
          *   - VIVALDI: The Vivaldi network coordinate-based approach
+         *   - ANALYTICAL: Estimates computed from the platform's network routes (route latency plus
+         *     NETWORK_PROXIMITY_MESSAGE_SIZE divided by the route's bottleneck bandwidth), without any
+         *     network proximity daemon or measurement traffic
          */
         DECLARE_PROPERTY_NAME(NETWORK_PROXIMITY_SERVICE_TYPE);
 
@@ -45,6 +48,18 @@ namespace wrench {
 
         /** @brief The random (integer) number generator seed used by the service to pick RTT measurement peers (default: 1) **/
         DECLARE_PROPERTY_NAME(NETWORK_PROXIMITY_PEER_LOOKUP_SEED);
+
+        /** @brief The number of dimensions of the Vivaldi coordinate space (only for VIVALDI, default: 2) **/
+        DECLARE_PROPERTY_NAME(NETWORK_PROXIMITY_VIVALDI_DIMENSIONS);
+
+        /** @brief Whether Vivaldi coordinates include a height component that models
+         *         the latency of a host's access link ("true" or "false", only for VIVALDI, default: "false") **/
+        DECLARE_PROPERTY_NAME(NETWORK_PROXIMITY_VIVALDI_HEIGHT);
+
+        /** @brief The maximum relative noise applied to ANALYTICAL estimates: each estimate is multiplied by a factor drawn
+         *         uniformly in [1 - noise, 1 + noise], once per host pair (seeded by NETWORK_PROXIMITY_PEER_LOOKUP_SEED)
+         *         (must be in [0,1), only for ANALYTICAL, default: 0) **/
+        DECLARE_PROPERTY_NAME(NETWORK_PROXIMITY_ANALYTICAL_NOISE);
     };
 }
 
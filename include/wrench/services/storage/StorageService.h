@@ -12,6 +12,7 @@
 #define WRENCH_STORAGESERVICE_H
 
 
+#include <functional>
 #include <string>
 #include <set>
 
@@ -76,9 +77,26 @@ namespace wrench {
                                       std::shared_ptr<FileLocation> src_location,
                                       std::shared_ptr<FileLocation> dst_location);
 
-        static void readFiles(std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations);
+        /** @brief Events reported, for each file, by readFiles() and writeFiles() */
+        enum FileOperationEvent {
+            /** @brief The file read/write has started */
+            FILE_OPERATION_STARTED,
+            /** @brief The file read/write has completed */
+            FILE_OPERATION_COMPLETED,
+            /** @brief The file read/write has failed */
+            FILE_OPERATION_FAILED
+        };
+
+        /** @brief A callback invoked, for each file, by readFiles() and writeFiles() */
+        typedef std::function<void(WorkflowFile *, std::shared_ptr<FileLocation>, FileOperationEvent)> FileOperationCallback;
+
+        static void readFiles(std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations,
+                              unsigned long max_num_concurrent_operations = 1,
+                              const FileOperationCallback &callback = nullptr);
 
-        static void writeFiles(std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations);
+        static void writeFiles(std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations,
+                               unsigned long max_num_concurrent_operations = 1,
+                               const FileOperationCallback &callback = nullptr);
 
 
         StorageService(const std::string &hostname,
@@ -114,7 +132,15 @@ namespace wrench {
         };
 
         static void writeOrReadFiles(FileOperation action,
-                                     std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations);
+                                     std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations,
+                                     unsigned long max_num_concurrent_operations,
+                                     const FileOperationCallback &callback);
+
+        static void writeOrReadFilesConcurrently(FileOperation action,
+                                                 const std::map<std::string, WorkflowFile *> &sorted_files,
+                                                 std::map<WorkflowFile *, std::shared_ptr<FileLocation>> &locations,
+                                                 unsigned long max_num_concurrent_operations,
+                                                 const FileOperationCallback &callback);
 
         void stageFile(WorkflowFile *file , std::string mountpoint, std::string directory);
 
@@ -10,6 +10,7 @@
 #ifndef WRENCH_SIM4U_DAEMON_H
 #define WRENCH_SIM4U_DAEMON_H
 
+#include <functional>
 #include <string>
 
 #include <simgrid/s4u.hpp>
@@ -79,6 +80,9 @@ namespace wrench {
 
         std::pair<bool, int> join();
 
+        static void startExitWatcher(std::shared_ptr<S4U_Daemon> daemon, const std::string &hostname,
+                                     std::function<void(bool has_returned_from_main, int return_value)> callback);
+
         void suspendActor();
 
         void resumeActor();
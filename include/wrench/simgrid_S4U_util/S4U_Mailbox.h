@@ -39,6 +39,7 @@ namespace wrench {
 				static void dputMessage(std::string mailbox_name, SimulationMessage *msg);
 				static std::shared_ptr<S4U_PendingCommunication> iputMessage(std::string mailbox_name, SimulationMessage *msg);
 				static std::shared_ptr<S4U_PendingCommunication> igetMessage(std::string mailbox_name);
+				static bool hasPendingMessage(std::string mailbox_name);
 //				static void clear_dputs();
 
 				static std::string generateUniqueMailboxName(std::string);
@@ -47,6 +47,8 @@ namespace wrench {
         static bool isLinkOn(std::string linkname);
         static void turnOffLink(std::string linkname);
         static void turnOnLink(std::string linkname);
+        static std::pair<double, double> getRouteLatencyAndBandwidth(const std::string &src_hostname,
+                                                                     const std::string &dst_hostname);
         static double getFlopRate();
         static double getHostMemoryCapacity(std::string hostname);
         static double getMemoryCapacity();
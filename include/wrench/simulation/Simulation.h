@@ -31,6 +31,7 @@ namespace wrench {
     class BareMetalComputeService;
     class CloudComputeService;
     class VirtualizedClusterComputeService;
+    class TimerService;
     class WMS;
     class WorkflowFile;
     class SimulationOutput;
@@ -135,6 +136,8 @@ namespace wrench {
         static unsigned long getNumCores();
         static double getFlopRate();
         static std::string getHostName();
+
+        std::shared_ptr<TimerService> getTimerService(const std::string &hostname);
         /***********************/
         /** \endcond           */
         /***********************/
@@ -156,6 +159,8 @@ namespace wrench {
 
         std::set<std::shared_ptr<StorageService>> storage_services;
 
+        std::map<std::string, std::shared_ptr<TimerService>> timer_services;
+
         static int unique_disk_sequence_number;
 
         void stageFile(WorkflowFile *file, std::shared_ptr<FileLocation> location);
@@ -58,7 +58,7 @@ namespace wrench {
 
         void dumpWorkflowExecutionJSON(Workflow *workflow, std::string file_path, bool generate_host_utilization_layout = false, bool writing_file = true);
         void dumpWorkflowGraphJSON(wrench::Workflow *workflow, std::string file_path, bool writing_file = true);
-        void dumpHostEnergyConsumptionJSON(std::string file_path, bool writing_file = true);
+        void dumpHostEnergyConsumptionJSON(std::string file_path, bool writing_file = true, double sampling_period = 0.0);
         void dumpPlatformGraphJSON(std::string file_path, bool writing_file = true);
         void dumpDiskOperationsJSON(std::string file_path, bool writing_file = true);
         void dumpUnifiedJSON(Workflow *workflow, std::string file_path, bool include_platform = false, bool include_workflow_exec = true,
@@ -127,6 +127,9 @@ namespace wrench {
 
         std::map<std::type_index, bool> enabledStatus;
 
+        static std::vector<std::pair<double, double>> resampleEnergyConsumptionTrace(
+                const std::vector<std::pair<double, double>> &trace, double sampling_period);
+
         /**
         * @brief Append a simulation timestamp to a simulation output trace
         *
@@ -19,6 +19,7 @@ namespace wrench {
     /** \cond INTERNAL     */
     /***********************/
 
+    class TraceFileReader;
 
     /**
      * @brief A class that can load a job submission trace (a.k.a. supercomputer workload) in the SWF format
@@ -28,14 +29,60 @@ namespace wrench {
     class TraceFileLoader {
     public:
         static std::vector<std::tuple<std::string, double, double, double, double, unsigned int>>
-           loadFromTraceFile(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job);
+           loadFromTraceFile(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job,
+                             unsigned long num_threads = 1);
+
+        static unsigned long
+           checkTraceFile(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job,
+                          unsigned long num_threads = 1);
+
     private:
-        static std::vector<std::tuple<std::string, double, double, double, double, unsigned int>>
-        loadFromTraceFileSWF(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job);
+        friend class TraceFileReader;
+
+        static std::string getTraceFileExtension(const std::string &filename);
+
+        static unsigned long
+        loadFromTraceFileSWF(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job,
+                             unsigned long num_threads,
+                             std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> *trace_file_jobs);
         static std::vector<std::tuple<std::string, double, double, double, double, unsigned int>>
         loadFromTraceFileJSON(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job);
     };
 
+    /**
+     * @brief A class that reads a job submission trace (in the SWF or JSON format) one job at
+     *        a time, so that jobs can be consumed lazily (SWF files are memory-mapped and parsed
+     *        on demand, while JSON files are loaded upfront). Jobs are returned in file order,
+     *        which for valid SWF files is submit-time order.
+     */
+    class TraceFileReader {
+    public:
+        TraceFileReader(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job);
+
+        ~TraceFileReader();
+
+        TraceFileReader(const TraceFileReader &) = delete;
+        TraceFileReader &operator=(const TraceFileReader &) = delete;
+
+        bool getNextJob(std::tuple<std::string, double, double, double, double, unsigned int> &job);
+
+    private:
+        std::string filename;
+        bool ignore_invalid_jobs;
+        double desired_submit_time_of_first_job;
+        double original_submit_time_of_first_job = -1;
+
+        // SWF files: the memory-mapped file and the current position in it
+        void *mapping = nullptr;
+        size_t mapping_size = 0;
+        const char *cursor = nullptr;
+        const char *end = nullptr;
+
+        // JSON files: the loaded jobs and the index of the next one
+        std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> json_jobs;
+        size_t next_json_job = 0;
+    };
+
     /***********************/
     /** \endcond           */
     /***********************/
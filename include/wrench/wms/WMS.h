@@ -35,6 +35,7 @@ namespace wrench {
     class StorageService;
     class NetworkProximityService;
     class FileRegistryService;
+    class Timer;
 
     /**
      * @brief A workflow management system (WMS)
@@ -70,12 +71,13 @@ namespace wrench {
 
         void checkDeferredStart();
 
-        void setTimer(double date, std::string message);
+        std::shared_ptr<Timer> setTimer(double date, std::string message);
 
         std::shared_ptr<JobManager> createJobManager();
         std::shared_ptr<DataMovementManager> createDataMovementManager();
         std::shared_ptr<EnergyMeterService> createEnergyMeter(const std::map<std::string, double> &measurement_periods);
         std::shared_ptr<EnergyMeterService> createEnergyMeter(const std::vector<std::string> &hostnames, double measurement_period);
+        std::shared_ptr<EnergyMeterService> createEventDrivenEnergyMeter(const std::vector<std::string> &hostnames);
 
         void runDynamicOptimizations();
 
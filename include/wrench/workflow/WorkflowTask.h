@@ -97,6 +97,10 @@ namespace wrench {
 
         unsigned long getBytesWritten() const;
 
+        void setMaxNumConcurrentFileOperations(unsigned long);
+
+        unsigned long getMaxNumConcurrentFileOperations() const;
+
         std::vector<WorkflowFile *> getInputFiles();
 
         std::vector<WorkflowFile *> getOutputFiles();
@@ -165,6 +169,10 @@ namespace wrench {
 
         WorkflowTask::InternalState getInternalState() const;
 
+        unsigned long getNumberOfNotCompletedParents() const;
+
+        unsigned long getNumberOfVisiblyNotCompletedParents(bool count_upcoming_state) const;
+
         void setJob(WorkflowJob *job);
 
         void setStartDate(double date);
@@ -250,6 +258,7 @@ namespace wrench {
         double parallel_efficiency;
         double memory_requirement;
         unsigned long priority = 0;        // Task priority
+        unsigned long max_num_concurrent_file_operations = 1;  // Max number of input (or output) files read (or written) concurrently
         unsigned long toplevel;            // 0 if entry task
         unsigned int failure_count = 0;    // Number of times the tasks has failed
         std::string execution_host;        // Host on which the task executed ("" if not executed successfully - yet)
@@ -257,6 +266,15 @@ namespace wrench {
         State upcoming_visible_state;      // A visible state that will become active once a WMS has process a previously sent workflow execution event
         InternalState internal_state;      // Not to be exposed to developer level
 
+        // Numbers of parents (one per DAG edge) that are not completed, maintained as states and edges change
+        unsigned long num_not_completed_parents = 0;                  // internal state isn't TASK_COMPLETED
+        unsigned long num_visibly_not_completed_parents = 0;          // visible state isn't COMPLETED
+        unsigned long num_visibly_or_upcoming_not_completed_parents = 0;  // neither visible nor upcoming state is COMPLETED
+
+        void updateNotCompletedParentCounts(const WorkflowTask *parent, bool add);
+        void updateChildrenNotCompletedParentCounts(bool was_completed, bool was_visibly_completed,
+                                                    bool was_visibly_or_upcoming_completed);
+
         Workflow *workflow;                                   // Containing workflow
 
         std::map<std::string, WorkflowFile *> output_files;   // List of output files
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <simgrid/s4u.hpp>
+
+#include "wrench/services/helpers/HostEventHub.h"
+#include "wrench/services/helpers/HostStateChangeDetector.h"
+
+namespace wrench {
+
+    std::unordered_map<std::string, unsigned long> HostEventHub::host_ids;
+    std::vector<std::vector<HostStateChangeDetector *>> HostEventHub::state_change_subscribers;
+    std::vector<std::vector<HostStateChangeDetector *>> HostEventHub::speed_change_subscribers;
+    std::unordered_map<HostStateChangeDetector *, std::tuple<std::vector<unsigned long>, bool, bool>> HostEventHub::subscriptions;
+    bool HostEventHub::call_backs_connected = false;
+    unsigned int HostEventHub::on_state_change_call_back_id;
+    unsigned int HostEventHub::on_speed_change_call_back_id;
+
+    /**
+     * @brief Subscribe a detector to the events of a set of hosts (a detector can only
+     *        have one subscription at a time, so any previous subscription is replaced)
+     *
+     * @param detector: the detector
+     * @param hostnames: the names of the hosts to monitor
+     * @param state_changes: whether the detector should be notified of host state changes
+     * @param speed_changes: whether the detector should be notified of host speed changes
+     */
+    void HostEventHub::subscribe(HostStateChangeDetector *detector, const std::vector<std::string> &hostnames,
+                                 bool state_changes, bool speed_changes) {
+        HostEventHub::unsubscribe(detector);
+
+        std::vector<unsigned long> ids;
+        for (auto const &hostname : hostnames) {
+            unsigned long id = HostEventHub::getHostId(hostname);
+            // Ignore duplicates, so that a detector is notified once per event
+            if (std::find(ids.begin(), ids.end(), id) != ids.end()) {
+                continue;
+            }
+            ids.push_back(id);
+            if (state_changes) {
+                HostEventHub::state_change_subscribers[id].push_back(detector);
+            }
+            if (speed_changes) {
+                HostEventHub::speed_change_subscribers[id].push_back(detector);
+            }
+        }
+        HostEventHub::subscriptions[detector] = std::make_tuple(ids, state_changes, speed_changes);
+
+        if (not HostEventHub::call_backs_connected) {
+            HostEventHub::connectCallBacks();
+        }
+    }
+
+    /**
+     * @brief Cancel the subscription of a detector (does nothing if the detector isn't subscribed)
+     *
+     * @param detector: the detector
+     */
+    void HostEventHub::unsubscribe(HostStateChangeDetector *detector) {
+        auto it = HostEventHub::subscriptions.find(detector);
+        if (it == HostEventHub::subscriptions.end()) {
+            return;
+        }
+        if (std::get<1>(it->second)) {
+            HostEventHub::removeSubscriber(HostEventHub::state_change_subscribers, detector, std::get<0>(it->second));
+        }
+        if (std::get<2>(it->second)) {
+            HostEventHub::removeSubscriber(HostEventHub::speed_change_subscribers, detector, std::get<0>(it->second));
+        }
+        HostEventHub::subscriptions.erase(it);
+
+        if (HostEventHub::subscriptions.empty()) {
+            HostEventHub::disconnectCallBacks();
+        }
+    }
+
+    /**
+     * @brief Remove a detector from per-host subscriber lists
+     *
+     * @param subscribers: the per-host subscriber lists
+     * @param detector: the detector
+     * @param host_ids: the IDs of the hosts whose subscriber lists contain the detector
+     */
+    void HostEventHub::removeSubscriber(std::vector<std::vector<HostStateChangeDetector *>> &subscribers,
+                                        HostStateChangeDetector *detector, const std::vector<unsigned long> &host_ids) {
+        for (auto const &id : host_ids) {
+            auto &host_subscribers = subscribers[id];
+            auto it = std::find(host_subscribers.begin(), host_subscribers.end(), detector);
+            if (it != host_subscribers.end()) {
+                // Order doesn't matter, so swap with the last element
+                *it = host_subscribers.back();
+                host_subscribers.pop_back();
+            }
+        }
+    }
+
+    /**
+     * @brief Get the dense ID of a host, assigning one if need be (hosts are known by name, since
+     *        virtual machine hosts come and go during the simulation)
+     *
+     * @param hostname: the hostname
+     * @return the host's ID
+     */
+    unsigned long HostEventHub::getHostId(const std::string &hostname) {
+        auto it = HostEventHub::host_ids.find(hostname);
+        if (it != HostEventHub::host_ids.end()) {
+            return it->second;
+        }
+        unsigned long id = HostEventHub::state_change_subscribers.size();
+        HostEventHub::host_ids[hostname] = id;
+        HostEventHub::state_change_subscribers.emplace_back();
+        HostEventHub::speed_change_subscribers.emplace_back();
+        return id;
+    }
+
+    /**
+     * @brief Connect to the SimGrid host signals
+     */
+    void HostEventHub::connectCallBacks() {
+        HostEventHub::on_state_change_call_back_id = simgrid::s4u::Host::on_state_change.connect(
+                [](simgrid::s4u::Host const &h) {
+                    HostEventHub::hostStateChangeCallback(h);
+                });
+        HostEventHub::on_speed_change_call_back_id = simgrid::s4u::Host::on_speed_change.connect(
+                [](simgrid::s4u::Host const &h) {
+                    HostEventHub::hostSpeedChangeCallback(h);
+                });
+        HostEventHub::call_backs_connected = true;
+    }
+
+    /**
+     * @brief Disconnect from the SimGrid host signals
+     */
+    void HostEventHub::disconnectCallBacks() {
+        if (not HostEventHub::call_backs_connected) {
+            return;
+        }
+        simgrid::s4u::Host::on_state_change.disconnect(HostEventHub::on_state_change_call_back_id);
+        simgrid::s4u::Host::on_speed_change.disconnect(HostEventHub::on_speed_change_call_back_id);
+        HostEventHub::call_backs_connected = false;
+    }
+
+    /**
+     * @brief Callback invoked by SimGrid when a host's state changes
+     *
+     * @param host: the host
+     */
+    void HostEventHub::hostStateChangeCallback(simgrid::s4u::Host const &host) {
+        auto it = HostEventHub::host_ids.find(host.get_name());
+        if (it == HostEventHub::host_ids.end()) {
+            return;
+        }
+        bool is_on = host.is_on();
+        for (auto const &detector : HostEventHub::state_change_subscribers[it->second]) {
+            detector->hostStateHasChanged(host.get_name(), is_on);
+        }
+    }
+
+    /**
+     * @brief Callback invoked by SimGrid when a host's speed changes
+     *
+     * @param host: the host
+     */
+    void HostEventHub::hostSpeedChangeCallback(simgrid::s4u::Host const &host) {
+        auto it = HostEventHub::host_ids.find(host.get_name());
+        if (it == HostEventHub::host_ids.end()) {
+            return;
+        }
+        double speed = host.get_speed();
+        for (auto const &detector : HostEventHub::speed_change_subscribers[it->second]) {
+            detector->hostSpeedHasChanged(host.get_name(), speed);
+        }
+    }
+
+};
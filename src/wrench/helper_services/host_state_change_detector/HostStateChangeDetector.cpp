@@ -7,6 +7,7 @@
  * (at your optioff) any later versioff.
  */
 
+#include "wrench/services/helpers/HostEventHub.h"
 #include "wrench/services/helpers/HostStateChangeDetector.h"
 #include "wrench/services/helpers/HostStateChangeDetectorMessage.h"
 #include "wrench/simgrid_S4U_util/S4U_VirtualMachine.h"
@@ -26,10 +27,10 @@ WRENCH_LOG_CATEGORY(wrench_core_host_state_change_detector, "Log category for Ho
  * @param return_value: the return value (if main() returned)
  */
 void wrench::HostStateChangeDetector::cleanup(bool has_returned_from_main, int return_value) {
-    // Unregister the callback!
-    simgrid::s4u::Host::on_state_change.disconnect(this->on_state_change_call_back_id);
-    simgrid::s4u::Host::on_speed_change.disconnect(this->on_speed_change_call_back_id);
-
+    // Unsubscribe from the hub! (notifications that haven't been sent are deleted along with
+    // this service, since the mutex cannot be acquired here)
+    HostEventHub::unsubscribe(this);
+    this->creator = nullptr;
 }
 
 
@@ -42,7 +43,7 @@ void wrench::HostStateChangeDetector::cleanup(bool has_returned_from_main, int r
  * @param notify_when_speed_change: whether to send a notification when hosts change speed
  * @param creator: the service that created this service (when its creator dies, so does this service)
  * @param mailbox_to_notify: the mailbox to notify
- * @param property_list: a property list
+ * @param property_list: a property list (there are currently no HostStateChangeDetector-specific properties)
  *
  */
 wrench::HostStateChangeDetector::HostStateChangeDetector(std::string host_on_which_to_run,
@@ -52,113 +53,122 @@ wrench::HostStateChangeDetector::HostStateChangeDetector(std::string host_on_whi
                                                          std::string mailbox_to_notify,
                                                          std::map<std::string, std::string> property_list) :
         Service(host_on_which_to_run, "host_state_change_detector", "host_state_change_detector") {
-    this->hosts_to_monitor = hosts_to_monitor;
     this->notify_when_turned_on = notify_when_turned_on;
     this->notify_when_turned_off = notify_when_turned_off;
     this->notify_when_speed_change = notify_when_speed_change;
     this->mailbox_to_notify = mailbox_to_notify;
     this->creator = creator;
+    this->mutex = simgrid::s4u::Mutex::create();
+    this->condition = simgrid::s4u::ConditionVariable::create();
 
-    // Set default and specified properties
-    this->setProperties(this->default_property_values, std::move(property_list));
-
-    // Connect my member method to the on_state_change signal from SimGrid regarding Hosts
-    this->on_state_change_call_back_id = simgrid::s4u::Host::on_state_change.connect(
-            [this](simgrid::s4u::Host const &h) {
-                this->hostStateChangeCallback(h.get_name());
-            });
+    // Set specified properties
+    this->setProperties({}, std::move(property_list));
 
-    // Connect my member method to the on_speed_change signal from SimGrid regarding Hosts
-    this->on_speed_change_call_back_id = simgrid::s4u::Host::on_speed_change.connect(
-            [this](simgrid::s4u::Host const &h) {
-                this->hostSpeedChangeCallback(h.get_name());
-            });
+    // Subscribe to the events of the monitored hosts (from now on, so that no event is missed
+    // before this service starts)
+    HostEventHub::subscribe(this, hosts_to_monitor,
+                            notify_when_turned_on or notify_when_turned_off, notify_when_speed_change);
+}
 
+/**
+ * @brief Destructor
+ */
+wrench::HostStateChangeDetector::~HostStateChangeDetector() {
+    HostEventHub::unsubscribe(this);
+    // No lock needed: once unsubscribed, nothing else can reach this detector
+    for (auto const &msg : this->pending_notifications) {
+        delete msg;
+    }
 }
 
-void wrench::HostStateChangeDetector::hostStateChangeCallback(std::string const &hostname) {
-    if (std::find(this->hosts_to_monitor.begin(), this->hosts_to_monitor.end(), hostname) !=
-        this->hosts_to_monitor.end()) {
-        auto host = simgrid::s4u::Host::by_name(hostname);
-        this->hosts_that_have_recently_changed_state.push_back(std::make_pair(hostname, host->is_on()));
+/**
+ * @brief Method called by the HostEventHub when a monitored host's state has changed (this is called
+ *        by SimGrid's maestro, which cannot block, when the host change happens; this is fine since the
+ *        detector never holds the mutex while it is blocked, so the mutex is always free at that point)
+ * @param hostname: the host's name
+ * @param is_on: whether the host is now on
+ */
+void wrench::HostStateChangeDetector::hostStateHasChanged(std::string const &hostname, bool is_on) {
+    HostStateChangeDetectorMessage *msg;
+    if (this->notify_when_turned_on and is_on) {
+        msg = new HostHasTurnedOnMessage(hostname);
+    } else if (this->notify_when_turned_off and (not is_on)) {
+        msg = new HostHasTurnedOffMessage(hostname);
+    } else {
+        return;
     }
+    this->mutex->lock();
+    this->pending_notifications.push_back(msg);
+    this->condition->notify_all();
+    this->mutex->unlock();
 }
 
-void wrench::HostStateChangeDetector::hostSpeedChangeCallback(std::string const &hostname) {
-    if (std::find(this->hosts_to_monitor.begin(), this->hosts_to_monitor.end(), hostname) !=
-        this->hosts_to_monitor.end()) {
-        auto host = simgrid::s4u::Host::by_name(hostname);
-        double speed = host->get_speed();
-        this->hosts_that_have_recently_changed_speed.push_back(std::make_pair(hostname, speed));
+/**
+ * @brief Method called by the HostEventHub when a monitored host's speed has changed (this is called
+ *        by SimGrid's maestro, as for hostStateHasChanged())
+ * @param hostname: the host's name
+ * @param speed: the host's new speed
+ */
+void wrench::HostStateChangeDetector::hostSpeedHasChanged(std::string const &hostname, double speed) {
+    if (not this->notify_when_speed_change) {
+        return;
     }
+    this->mutex->lock();
+    this->pending_notifications.push_back(new HostHasChangedSpeedMessage(hostname, speed));
+    this->condition->notify_all();
+    this->mutex->unlock();
+}
+
+/**
+ * @brief Record that the creator has exited and wake up the detector (this is called by
+ *        the creator's watcher actor)
+ */
+void wrench::HostStateChangeDetector::creatorHasExited() {
+    this->mutex->lock();
+    this->creator_has_exited = true;
+    this->condition->notify_all();
+    this->mutex->unlock();
 }
 
 
 int wrench::HostStateChangeDetector::main() {
 
     WRENCH_INFO("Starting");
+
+    // Get woken up when my creator terminates/dies (right away if it is already down)
+    std::weak_ptr<HostStateChangeDetector> detector = this->getSharedPtr<HostStateChangeDetector>();
+    S4U_Daemon::startExitWatcher(this->creator, this->hostname,
+                                 [detector](bool has_returned_from_main, int return_value) {
+                                     if (auto d = detector.lock()) {
+                                         d->creatorHasExited();
+                                     }
+                                 });
+
     while (true) {
-        if (creator->getState() == State::DOWN) {
+        // Wait for something to happen
+        this->mutex->lock();
+        while (this->pending_notifications.empty() and (not this->creator_has_exited)) {
+            this->condition->wait(this->mutex);
+        }
+        std::deque<HostStateChangeDetectorMessage *> to_send;
+        to_send.swap(this->pending_notifications);
+        bool done = this->creator_has_exited;
+        this->mutex->unlock();
+
+        if (done) {
+            for (auto const &msg : to_send) {
+                delete msg;
+            }
             WRENCH_INFO("My Creator has terminated/died, so must I...");
             break;
         }
-        // Sleeping for my monitoring period
-        Simulation::sleep(this->getPropertyValueAsDouble(HostStateChangeDetectorProperty::MONITORING_PERIOD));
-
-        // State Changes
-        while (not this->hosts_that_have_recently_changed_state.empty()) {
-            auto host_info = this->hosts_that_have_recently_changed_state.at(0);
-            std::string hostname = std::get<0>(host_info);
-            bool new_state_is_on = std::get<1>(host_info);
-            bool new_state_is_off = not new_state_is_on;
-            this->hosts_that_have_recently_changed_state.erase(this->hosts_that_have_recently_changed_state.begin());
-
-            HostStateChangeDetectorMessage *msg;
-
-            if (this->notify_when_turned_on && new_state_is_on) {
-                msg = new HostHasTurnedOnMessage(hostname);
-            } else if (this->notify_when_turned_off && new_state_is_off) {
-                msg = new HostHasTurnedOffMessage(hostname);
-            } else {
-                continue;
-            }
 
-            WRENCH_INFO("Notifying mailbox '%s' that host '%s' has changed state", this->mailbox_to_notify.c_str(),
-                        hostname.c_str());
-//            try {
-                S4U_Mailbox::dputMessage(this->mailbox_to_notify, msg);
-//            } catch (std::shared_ptr<NetworkError> &e) {
-//                WRENCH_INFO("Network error '%s' while notifying mailbox of a host state change ... ignoring",
-//                            e->toString().c_str());
-//            }
+        // Send all notifications, in the order in which the changes happened
+        for (auto const &msg : to_send) {
+            WRENCH_INFO("Notifying mailbox '%s' of a host change (%s)", this->mailbox_to_notify.c_str(),
+                        msg->getName().c_str());
+            S4U_Mailbox::dputMessage(this->mailbox_to_notify, msg);
         }
-
-        // Speed Changes
-        while (not this->hosts_that_have_recently_changed_speed.empty()) {
-            auto host_info = this->hosts_that_have_recently_changed_speed.at(0);
-            std::string hostname = std::get<0>(host_info);
-            double new_speed = std::get<1>(host_info);
-            this->hosts_that_have_recently_changed_speed.erase(this->hosts_that_have_recently_changed_speed.begin());
-
-            HostStateChangeDetectorMessage *msg;
-
-            if (this->notify_when_speed_change) {
-                msg = new HostHasChangedSpeedMessage(hostname, new_speed);
-            } else {
-                continue;
-            }
-
-            WRENCH_INFO("Notifying mailbox '%s' that host '%s' has changed speed", this->mailbox_to_notify.c_str(),
-                        hostname.c_str());
-//            try {
-                S4U_Mailbox::dputMessage(this->mailbox_to_notify, msg);
-//            } catch (std::shared_ptr<NetworkError> &e) {
-//                WRENCH_INFO("Network error '%s' while notifying mailbox of a speed state change ... ignoring",
-//                            e->toString().c_str());
-//            }
-        }
-
-
     }
     return 0;
 }
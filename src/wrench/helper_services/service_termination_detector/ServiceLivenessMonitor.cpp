@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "wrench/services/helpers/ServiceLivenessMonitor.h"
+#include "wrench/services/helpers/ServiceTerminationDetectorMessage.h"
+#include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/logging/TerminalOutput.h"
+
+WRENCH_LOG_CATEGORY(wrench_core_service_liveness_monitor, "Log category for ServiceLivenessMonitor");
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     * @param host_on_which_to_run: the service's host
+     * @param creator: the service that created this service (when its creator dies, so does this service)
+     * @param mailbox_to_notify: which mailbox to notify
+     * @param notify_on_crash: whether to send a crash notification (in case of non-clean termination)
+     * @param notify_on_termination: whether to send a termination notification (in case of clean termination)
+     */
+    ServiceLivenessMonitor::ServiceLivenessMonitor(std::string host_on_which_to_run,
+                                                   std::shared_ptr<S4U_Daemon> creator,
+                                                   std::string mailbox_to_notify,
+                                                   bool notify_on_crash,
+                                                   bool notify_on_termination) :
+            Service(host_on_which_to_run, "service_liveness_monitor", "service_liveness_monitor") {
+        this->creator = creator;
+        this->mailbox_to_notify = mailbox_to_notify;
+        this->notify_on_crash = notify_on_crash;
+        this->notify_on_termination = notify_on_termination;
+        this->mutex = simgrid::s4u::Mutex::create();
+        this->condition = simgrid::s4u::ConditionVariable::create();
+    }
+
+    /**
+     * @brief Start monitoring a service (which must have been started, as must this monitor). The
+     *        service's exit is detected by a watcher actor on this monitor's host, so that crashes
+     *        caused by a failure of the service's host are detected as well.
+     * @param service: the service to monitor
+     */
+    void ServiceLivenessMonitor::monitor(std::shared_ptr<Service> service) {
+        std::weak_ptr<ServiceLivenessMonitor> monitor = this->getSharedPtr<ServiceLivenessMonitor>();
+        S4U_Daemon::startExitWatcher(service, this->hostname,
+                                     [monitor, service](bool has_returned_from_main, int return_value) {
+                                         if (auto m = monitor.lock()) {
+                                             m->serviceHasExited(service, has_returned_from_main, return_value);
+                                         }
+                                     });
+    }
+
+    /**
+     * @brief Record that a monitored service has exited and wake up the monitor (this is
+     *        called by the service's watcher actor)
+     * @param service: the service
+     * @param has_returned_from_main: whether the service returned from main()
+     * @param return_value: the value returned by main() (if it did)
+     */
+    void ServiceLivenessMonitor::serviceHasExited(std::shared_ptr<Service> service, bool has_returned_from_main,
+                                                  int return_value) {
+        // Nobody will report on the service if this monitor is gone
+        if (this->getState() == S4U_Daemon::State::DOWN) {
+            return;
+        }
+        this->mutex->lock();
+        this->exited_services.emplace_back(service, has_returned_from_main, return_value);
+        this->condition->notify_all();
+        this->mutex->unlock();
+    }
+
+    /**
+     * @brief Record that the creator has exited and wake up the monitor (this is called by
+     *        the creator's watcher actor)
+     */
+    void ServiceLivenessMonitor::creatorHasExited() {
+        this->mutex->lock();
+        this->creator_has_exited = true;
+        this->condition->notify_all();
+        this->mutex->unlock();
+    }
+
+    /**
+     * @brief Main method
+     * @return 0 on termination
+     */
+    int ServiceLivenessMonitor::main() {
+
+        WRENCH_INFO("Starting");
+
+        // Get woken up when my creator terminates/dies
+        std::weak_ptr<ServiceLivenessMonitor> monitor = this->getSharedPtr<ServiceLivenessMonitor>();
+        S4U_Daemon::startExitWatcher(this->creator, this->hostname,
+                                     [monitor](bool has_returned_from_main, int return_value) {
+                                         if (auto m = monitor.lock()) {
+                                             m->creatorHasExited();
+                                         }
+                                     });
+
+        while (true) {
+            // Wait for something to happen
+            this->mutex->lock();
+            while (this->exited_services.empty() and (not this->creator_has_exited)) {
+                this->condition->wait(this->mutex);
+            }
+            std::deque<std::tuple<std::shared_ptr<Service>, bool, int>> to_report;
+            to_report.swap(this->exited_services);
+            bool done = this->creator_has_exited;
+            this->mutex->unlock();
+
+            // Send notifications
+            for (auto const &s : to_report) {
+                auto service = std::get<0>(s);
+                bool service_has_returned_from_main = std::get<1>(s);
+                int return_value_from_main = std::get<2>(s);
+
+                if (this->notify_on_crash and (not service_has_returned_from_main)) {
+                    WRENCH_INFO("Detected crash of service %s (notifying mailbox %s)", service->getName().c_str(),
+                                this->mailbox_to_notify.c_str());
+                    S4U_Mailbox::dputMessage(this->mailbox_to_notify, new ServiceHasCrashedMessage(service));
+                }
+                if (this->notify_on_termination and service_has_returned_from_main) {
+                    WRENCH_INFO("Detected termination of service %s (notifying mailbox %s)",
+                                service->getName().c_str(), this->mailbox_to_notify.c_str());
+                    S4U_Mailbox::dputMessage(this->mailbox_to_notify,
+                                             new ServiceHasTerminatedMessage(service, return_value_from_main));
+                }
+            }
+
+            if (done) {
+                WRENCH_INFO("My Creator has terminated/died, so must I...");
+                break;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Cleanup method
+     *
+     * @param has_returned_from_main: whether main() returned
+     * @param return_value: the return value (if main() returned)
+     */
+    void ServiceLivenessMonitor::cleanup(bool has_returned_from_main, int return_value) {
+        // Release the pointer to the creator, so that it can be freed in case refcount = 0 (the
+        // services that haven't been reported on are released along with this monitor, since
+        // the mutex cannot be acquired here)
+        this->creator = nullptr;
+    }
+
+    /**
+     * @brief Kill the service
+     */
+    void ServiceLivenessMonitor::kill() {
+        this->killActor();
+    }
+
+}
@@ -24,7 +24,6 @@
 #include "wrench/workflow/job/PilotJob.h"
 #include "StandardJobExecutorMessage.h"
 #include "wrench/services/helpers/ServiceTerminationDetectorMessage.h"
-#include "wrench/services/helpers/ServiceTerminationDetector.h"
 #include "wrench/services/helpers/HostStateChangeDetector.h"
 #include <wrench/services/helpers/HostStateChangeDetectorMessage.h>
 #include <wrench/workflow/failure_causes/HostError.h>
@@ -191,6 +190,15 @@ namespace wrench {
         this->setProperties(this->default_property_values, property_list);
         this->setMessagePayloads(this->default_messagepayload_values, messagepayload_list);
 
+        // Create the ready workunit queue, ordered by the task selection algorithm
+        try {
+            this->ready_workunits = ReadyWorkunitQueue(ReadyWorkunitQueue::parsePolicy(
+                    this->getPropertyValueAsString(StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM)));
+        } catch (std::invalid_argument &e) {
+            throw std::invalid_argument("StandardJobExecutor::StandardJobExecutor(): Unknown StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM property '" +
+                                        this->getPropertyValueAsString(StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM) + "'");
+        }
+
         // Compute the total number of cores and set initial core availabilities
         this->total_num_cores = 0;
         for (auto host : compute_resources) {
@@ -308,6 +316,12 @@ namespace wrench {
         this->host_state_monitor->simulation = this->simulation;
         this->host_state_monitor->start(this->host_state_monitor, true, false); // Daemonized, no auto-restart
 
+        // Create the monitor that will let me know when a workunit executor has died
+        this->workunit_executor_monitor = std::shared_ptr<ServiceLivenessMonitor>(
+                new ServiceLivenessMonitor(this->hostname, this->getSharedPtr<Service>(), this->mailbox_name, true, false));
+        this->workunit_executor_monitor->simulation = this->simulation;
+        this->workunit_executor_monitor->start(this->workunit_executor_monitor, true, false); // Daemonized, no auto-restart
+
         /** Create all Workunits **/
         std::set<std::shared_ptr<Workunit>> all_work_units = Workunit::createWorkunits(this->job);
 
@@ -356,6 +370,8 @@ namespace wrench {
 
         this->host_state_monitor->kill();
         this->host_state_monitor = nullptr; // Which will release the pointer to this service!
+        this->workunit_executor_monitor->kill();
+        this->workunit_executor_monitor = nullptr; // Which will release the pointer to this service!
 
         WRENCH_INFO("Standard Job Executor on host %s cleanly terminating!", S4U_Simulation::getHostName().c_str());
         return 0;
@@ -422,29 +438,32 @@ namespace wrench {
         // Don't kill me while I am doing this!
         this->acquireDaemonLock();
 
-//      std::cerr << "** IN DISPATCH READY WORK UNITS\n";
-//      for (auto const &wu : this->ready_workunits) {
-//        std::cerr << "WU: num_comp_tasks " << wu->tasks.size() << "\n";
-//        for (auto t : wu->tasks) {
-//          std::cerr << "    - flops = " << t->getFlops() << ", min_cores = " << t->getMinNumCores() << ", max_cores = " << t->getMaxNumCores() << "\n";
-//        }
-//      }
-
+        std::string host_selection_algorithm =
+                this->getPropertyValueAsString(StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM);
+        if (host_selection_algorithm != "best_fit") {
+            this->releaseDaemonLock();
+            throw std::runtime_error("Unknown StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM property '"
+                                     + host_selection_algorithm + "'");
+        }
 
-        // Get an ordered (by the task selection algorithm) list of the ready workunits
-        std::vector<std::shared_ptr<Workunit>> sorted_ready_workunits = sortReadyWorkunits();
+        // Go through the workunits in order of priority (as given by the task selection algorithm)
+        // and dispatch each them to hosts/cores, if possible
+        auto wu_it = this->ready_workunits.begin();
+        while (wu_it != this->ready_workunits.end()) {
 
-//      std::cerr << "** SORTED\n";
-//      for (auto wu : sorted_ready_workunits) {
-//        std::cerr << "WU: num_comp_tasks " << wu->tasks.size() << "\n";
-//        for (auto t : wu->tasks) {
-//          std::cerr << "    - flops = " << t->getFlops() << ", min_cores = " << t->getMinNumCores() << ", max_cores = " << t->getMaxNumCores() << "\n";
-//        }
-//      }
+            // If no host has an idle core, no other workunit can be dispatched
+            bool some_core_is_available = false;
+            for (auto const &h : this->core_availabilities) {
+                if (h.second > 0) {
+                    some_core_is_available = true;
+                    break;
+                }
+            }
+            if (not some_core_is_available) {
+                break;
+            }
 
-        // Go through the workunits in order of priority and dispatch each them to
-        // hosts/cores, if possible
-        for (auto wu : sorted_ready_workunits) {
+            auto wu = *wu_it;
 
             // Compute the workunit's minimum number of cores, desired number of cores, and minimum amount of ram
             unsigned long minimum_num_cores;
@@ -467,12 +486,8 @@ namespace wrench {
             WRENCH_INFO(
                     "Looking for a host to run a work unit that needs at least %ld cores, and would like %ld cores, and requires %.2ef bytes of RAM",
                     minimum_num_cores, desired_num_cores, required_ram);
-            std::string host_selection_algorithm =
-                    this->getPropertyValueAsString(StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM);
-
-//        std::cerr << "** FINDING A HOST USING " << host_selection_algorithm << "\n";
-
-            if (host_selection_algorithm == "best_fit") {
+            // Best fit
+            {
                 unsigned long target_slack = 0;
 
                 for (auto const &h : this->core_availabilities) {
@@ -518,16 +533,12 @@ namespace wrench {
                         target_slack = tentative_target_slack;
                     }
                 }
-            } else {
-                this->releaseDaemonLock();
-                throw std::runtime_error("Unknown StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM property '"
-                                         + host_selection_algorithm + "'");
             }
 
 
             if (target_host == "") { // didn't find a suitable host
                 WRENCH_INFO("Didn't find a suitable host");
-//          std::cerr << "DID NOT FIND A HOST, GOING TO NEXT WORK UNIT\n";
+                ++wu_it;
                 continue;
             }
 
@@ -562,12 +573,8 @@ namespace wrench {
                         "BareMetalComputeService::dispatchReadyWorkunits(): got a host error on the target host - this shouldn't happen");
             }
 
-            // Start a failure detector for this workunit executor (which will send me a message in case the
-            // work unit executor has died)
-            auto failure_detector = std::shared_ptr<ServiceTerminationDetector>(
-                    new ServiceTerminationDetector(this->hostname, workunit_executor, this->mailbox_name, true, false));
-            failure_detector->simulation = this->simulation;
-            failure_detector->start(failure_detector, true, false); // Daemonized, no auto-restart
+            // Monitor this workunit executor (so that I get a message in case it has died)
+            this->workunit_executor_monitor->monitor(workunit_executor);
 
             // Update core availabilities
             this->core_availabilities[target_host] -= target_num_cores;
@@ -578,19 +585,11 @@ namespace wrench {
             // Update data structures
             this->running_workunit_executors.insert(workunit_executor);
 
-            for (auto wu_it = this->ready_workunits.begin(); wu_it != this->ready_workunits.end(); wu_it++) {
-                if ((*wu_it) == wu) {
-                    auto tomove = *wu_it;
-                    this->ready_workunits.erase(wu_it);
-                    this->running_workunits.insert(tomove);
-                    break;
-                }
-            }
+            wu_it = this->ready_workunits.erase(wu_it);
+            this->running_workunits.insert(wu);
 
         }
 
-        sorted_ready_workunits.clear();
-
         this->releaseDaemonLock();
 
     }
@@ -743,15 +742,12 @@ namespace wrench {
 
                     // Find the child working in the non-ready  queue
                     found_it = false;
-                    for (auto it = this->non_ready_workunits.begin(); it != this->non_ready_workunits.end(); it++) {
-                        if ((*it) == child) {
-                            // Move it to the ready  queue
-                            auto tomove = *it;
-                            this->non_ready_workunits.erase(it);
-                            this->ready_workunits.insert(tomove);
-                            found_it = true;
-                            break;
-                        }
+                    auto it = this->non_ready_workunits.find(child);
+                    if (it != this->non_ready_workunits.end()) {
+                        // Move it to the ready  queue
+                        this->non_ready_workunits.erase(it);
+                        this->ready_workunits.insert(child);
+                        found_it = true;
                     }
                     if (!found_it) {
                         throw std::runtime_error(
@@ -894,75 +890,6 @@ namespace wrench {
     }
 
 
-    /**
-     * @brief Sort the a list of ready workunits based on the TASK_SELECTION_ALGORITHM property
-     *
-     * @return a sorted vector of ready tasks
-     */
-    std::vector<std::shared_ptr<Workunit>> StandardJobExecutor::sortReadyWorkunits() {
-
-//      std::cerr << "In sortReadyWorkunits()\n";
-
-        std::vector<std::shared_ptr<Workunit>> sorted_workunits;
-
-        for (auto const &wu : this->ready_workunits) {
-            sorted_workunits.push_back(wu);
-//        std::cerr << "WORKUNITS.GET = " << wu.get() << ": " << wu.get()->tasks.size() << "\n";
-        }
-
-//      std::cerr << "SORTED LENGTH = " << sorted_workunits.size() << "\n";
-
-        std::string selection_algorithm =
-                this->getPropertyValueAsString(StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM);
-
-//      std::cerr << "SELECT ALG = " << selection_algorithm << "\n";
-
-        // using function as comp
-        std::sort(sorted_workunits.begin(), sorted_workunits.end(),
-                  [selection_algorithm](const std::shared_ptr<Workunit> wu1,
-                                        const std::shared_ptr<Workunit> wu2) -> bool {
-//                    std::cerr << "IN LAMBDA1: " << wu1 << "  " << wu2 << "\n";
-//                    std::cerr << "IN LAMBDA2: " << wu1->tasks.size() << "  " << wu2->tasks.size() << "\n";
-                      // Non-computational workunits have higher priority
-
-                      if (wu1->task == nullptr and wu2->task == nullptr) {
-                          return ((uintptr_t) wu1.get() > (uintptr_t) wu2.get());
-                      }
-                      if (wu1->task == nullptr) {
-                          return true;
-                      }
-                      if (wu2->task == nullptr) {
-                          return false;
-                      }
-
-                      if (selection_algorithm == "maximum_flops") {
-                          if (wu1->task->getFlops() == wu2->task->getFlops()) {
-                              return (wu1->task->getID() > wu2->task->getID());
-                          }
-                          return (wu1->task->getFlops() > wu2->task->getFlops());
-
-                      } else if (selection_algorithm == "maximum_minimum_cores") {
-                          if (wu1->task->getMinNumCores() == wu2->task->getMinNumCores()) {
-                              return (wu1->task->getID() > wu2->task->getID());
-                          }
-                          return (wu1->task->getMinNumCores() > wu2->task->getMinNumCores());
-
-                      } else if (selection_algorithm == "minimum_top_level") {
-                          if (wu1->task->getTopLevel() == wu2->task->getTopLevel()) {
-                              return (wu1->task->getID() > wu2->task->getID());
-                          }
-                          return (wu1->task->getTopLevel() < wu2->task->getTopLevel());
-                      } else {
-                          throw std::runtime_error(
-                                  "Unknown StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM property '"
-                                  + selection_algorithm + "'");
-                      }
-                  });
-
-        return sorted_workunits;
-    }
-
-
     /**
      * @brief Clears the scratch space
      */
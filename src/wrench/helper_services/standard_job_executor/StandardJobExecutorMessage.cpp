@@ -92,12 +92,5 @@ namespace wrench {
     }
 
 
-    /**
-     * @brief Constructor
-     */
-    ComputeThreadDoneMessage::ComputeThreadDoneMessage() :
-            StandardJobExecutorMessage("COMPUTE_THREAD_DONE", 0) {
-    }
-
 
 };
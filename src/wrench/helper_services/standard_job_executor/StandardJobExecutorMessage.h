@@ -110,15 +110,6 @@ namespace wrench {
     };
 
 
-    /**
-     * @brief A message sent by a ComputeThread once it's done performing its computation
-     */
-    class ComputeThreadDoneMessage : public StandardJobExecutorMessage {
-    public:
-        ComputeThreadDoneMessage();
-
-    };
-
 
     /***********************/
     /** \endcond           */
@@ -0,0 +1,240 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+
+#include "wrench/logging/TerminalOutput.h"
+#include "wrench/services/helpers/TimerService.h"
+#include "wrench/services/helpers/TimerServiceMessage.h"
+#include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/simgrid_S4U_util/S4U_Simulation.h"
+#include "wrench/workflow/failure_causes/NetworkError.h"
+
+WRENCH_LOG_CATEGORY(wrench_core_timer_service, "Log category for Timer Service");
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     *
+     * @param timer_service: the timer service with which the deadline is registered
+     * @param date: the date at which the message should be sent
+     * @param reply_mailbox_name: the mailbox to which the message should be sent
+     * @param msg: the message to send
+     */
+    Timer::Timer(std::shared_ptr<TimerService> timer_service, double date, const std::string &reply_mailbox_name,
+                 SimulationMessage *msg) : timer_service(timer_service), date(date),
+                                           reply_mailbox_name(reply_mailbox_name), msg(msg) {
+    }
+
+    /**
+     * @brief Destructor (frees the message if it was never sent)
+     */
+    Timer::~Timer() {
+        delete this->msg;
+    }
+
+    /**
+     * @brief Cancel the timer, so that its message is never sent (does nothing if
+     *        the message has already been sent or if the timer was already cancelled)
+     */
+    void Timer::cancel() {
+        if (this->msg == nullptr) {
+            return;
+        }
+        delete this->msg;
+        this->msg = nullptr;
+        auto timer_service = this->timer_service.lock();
+        if (timer_service) {
+            timer_service->timerHasBeenCancelled();
+        }
+    }
+
+    /**
+     * @brief Determine whether the timer has yet to go off
+     * @return true if the message has not been sent and the timer has not been cancelled
+     */
+    bool Timer::isPending() {
+        return (this->msg != nullptr);
+    }
+
+    /**
+     * @brief Get the date at which the timer goes off
+     * @return a date
+     */
+    double Timer::getDate() {
+        return this->date;
+    }
+
+    /**
+     * @brief Constructor
+     *
+     * @param hostname: the name of the host on which the service should run
+     */
+    TimerService::TimerService(std::string hostname) : Service(hostname, "timer_service", "timer_service") {
+    }
+
+    /**
+     * @brief Register a deadline at which a message should be sent to a mailbox
+     *
+     * @param date: the date at which the message should be sent (if date is in the past
+     *              then the message will be sent immediately)
+     * @param reply_mailbox_name: the mailbox to which the message should be sent
+     * @param msg: the message to send (the timer takes ownership of it)
+     * @return a handle that can be used to cancel the timer
+     */
+    std::shared_ptr<Timer>
+    TimerService::setTimer(double date, const std::string &reply_mailbox_name, SimulationMessage *msg) {
+
+        auto timer = std::shared_ptr<Timer>(
+                new Timer(this->getSharedPtr<TimerService>(), date, reply_mailbox_name, msg));
+        this->deadlines.push_back({date, this->sequence_number++, timer});
+        std::push_heap(this->deadlines.begin(), this->deadlines.end(), DeadlineComparator());
+
+        // If this is the new earliest deadline, the daemon must reconsider how long it waits
+        if ((this->deadlines.front().timer == timer) and (not this->wake_up_message_pending)) {
+            this->wake_up_message_pending = true;
+            S4U_Mailbox::dputMessage(this->mailbox_name, new TimerServiceWakeUpMessage());
+        }
+
+        return timer;
+    }
+
+    /**
+     * @brief Get the number of timers that have yet to go off
+     * @return a number of timers
+     */
+    unsigned long TimerService::getNumPendingTimers() {
+        return this->deadlines.size() - this->num_cancelled_deadlines;
+    }
+
+    /**
+     * @brief Method called when one of the registered timers is cancelled
+     */
+    void TimerService::timerHasBeenCancelled() {
+        this->num_cancelled_deadlines++;
+        // Cancelled deadlines are removed lazily, unless they make up most of the heap
+        if ((this->deadlines.size() > 64) and (this->num_cancelled_deadlines > this->deadlines.size() / 2)) {
+            this->compactDeadlines();
+        }
+    }
+
+    /**
+     * @brief Remove all cancelled deadlines from the heap
+     */
+    void TimerService::compactDeadlines() {
+        this->deadlines.erase(std::remove_if(this->deadlines.begin(), this->deadlines.end(),
+                                             [](const Deadline &d) { return d.timer->msg == nullptr; }),
+                              this->deadlines.end());
+        std::make_heap(this->deadlines.begin(), this->deadlines.end(), DeadlineComparator());
+        this->num_cancelled_deadlines = 0;
+    }
+
+    /**
+     * @brief Remove cancelled deadlines from the top of the heap
+     */
+    void TimerService::discardCancelledDeadlines() {
+        while ((not this->deadlines.empty()) and (this->deadlines.front().timer->msg == nullptr)) {
+            std::pop_heap(this->deadlines.begin(), this->deadlines.end(), DeadlineComparator());
+            this->deadlines.pop_back();
+            this->num_cancelled_deadlines--;
+        }
+    }
+
+    /**
+     * @brief Send the messages of all timers that go off at or before a date
+     *
+     * @param date: the date
+     */
+    void TimerService::sendExpiredTimerMessages(double date) {
+        while ((not this->deadlines.empty()) and (this->deadlines.front().date <= date)) {
+            std::pop_heap(this->deadlines.begin(), this->deadlines.end(), DeadlineComparator());
+            auto timer = this->deadlines.back().timer;
+            this->deadlines.pop_back();
+
+            if (timer->msg == nullptr) {
+                this->num_cancelled_deadlines--;
+                continue;
+            }
+
+            auto msg = timer->msg;
+            timer->msg = nullptr;
+            WRENCH_INFO("Timer Service sending a message to %s", timer->reply_mailbox_name.c_str());
+            try {
+                S4U_Mailbox::dputMessage(timer->reply_mailbox_name, msg);
+            } catch (std::shared_ptr<NetworkError> &cause) {
+                WRENCH_WARN("Timer Service was not able to send its message");
+            }
+        }
+    }
+
+    /**
+     * @brief Main method of the daemon
+     *
+     * @return 0 on termination
+     */
+    int TimerService::main() {
+        TerminalOutput::setThisProcessLoggingColor(TerminalOutput::COLOR_MAGENTA);
+        WRENCH_INFO("Timer Service starting on host %s", this->hostname.c_str());
+
+        while (true) {
+
+            this->discardCancelledDeadlines();
+
+            // Wait until the earliest deadline, or forever if there is none
+            double next_date = -1.0;
+            double timeout = -1.0;
+            if (not this->deadlines.empty()) {
+                next_date = this->deadlines.front().date;
+                if (next_date <= S4U_Simulation::getClock()) {
+                    this->sendExpiredTimerMessages(S4U_Simulation::getClock());
+                    continue;
+                }
+                timeout = next_date - S4U_Simulation::getClock();
+            }
+
+            std::shared_ptr<SimulationMessage> message = nullptr;
+            try {
+                message = S4U_Mailbox::getMessage(this->mailbox_name, timeout);
+            } catch (std::shared_ptr<NetworkError> &cause) {
+                if (cause->isTimeout()) {
+                    this->sendExpiredTimerMessages(std::max<double>(next_date, S4U_Simulation::getClock()));
+                }
+                continue;
+            }
+
+            if (auto msg = std::dynamic_pointer_cast<TimerServiceWakeUpMessage>(message)) {
+                this->wake_up_message_pending = false;
+            } else {
+                throw std::runtime_error(
+                        "TimerService::main(): Unexpected [" + message->getName() + "] message");
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Cleanup method, which drops all pending timers (since the host on which
+     *        they were registered is down)
+     *
+     * @param has_returned_from_main: whether main() returned
+     * @param return_value: the return value (if main() returned)
+     */
+    void TimerService::cleanup(bool has_returned_from_main, int return_value) {
+        for (auto &d : this->deadlines) {
+            delete d.timer->msg;
+            d.timer->msg = nullptr;
+        }
+        this->deadlines.clear();
+        this->num_cancelled_deadlines = 0;
+        this->wake_up_message_pending = false;
+    }
+
+};
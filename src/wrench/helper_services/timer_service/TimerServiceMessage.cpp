@@ -0,0 +1,30 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "wrench/services/helpers/TimerServiceMessage.h"
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     *
+     * @param name: the message name
+     */
+    TimerServiceMessage::TimerServiceMessage(std::string name) :
+            SimulationMessage("TimerServiceMessage::" + name, 0) {
+    }
+
+    /**
+     * @brief Constructor
+     */
+    TimerServiceWakeUpMessage::TimerServiceWakeUpMessage() :
+            TimerServiceMessage("TimerServiceWakeUpMessage") {
+    }
+
+}
@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <stdexcept>
+
+#include <wrench/workflow/WorkflowTask.h>
+#include "wrench/services/compute/workunit_executor/Workunit.h"
+#include "wrench/services/compute/workunit_executor/ReadyWorkunitQueue.h"
+
+namespace wrench {
+
+    /**
+     * @brief Key comparison
+     * @param other: another key
+     * @return true if this key comes first
+     */
+    bool ReadyWorkunitQueue::Key::operator<(const Key &other) const {
+        if (this->has_task != other.has_task) {
+            return not this->has_task;
+        }
+        if (this->priority != other.priority) {
+            return this->priority < other.priority;
+        }
+        if (this->task_id != other.task_id) {
+            return this->task_id > other.task_id;
+        }
+        return this->sequence_number < other.sequence_number;
+    }
+
+    /**
+     * @brief Convert a task selection algorithm name (i.e., the value of a
+     *        TASK_SELECTION_ALGORITHM property) to a policy
+     * @param name: the name ("maximum_flops", "maximum_minimum_cores", or "minimum_top_level")
+     * @return a policy
+     *
+     * @throw std::invalid_argument
+     */
+    ReadyWorkunitQueue::Policy ReadyWorkunitQueue::parsePolicy(const std::string &name) {
+        if (name == "maximum_flops") {
+            return MAXIMUM_FLOPS;
+        } else if (name == "maximum_minimum_cores") {
+            return MAXIMUM_MINIMUM_CORES;
+        } else if (name == "minimum_top_level") {
+            return MINIMUM_TOP_LEVEL;
+        } else {
+            throw std::invalid_argument("ReadyWorkunitQueue::parsePolicy(): Unknown task selection algorithm '" +
+                                        name + "'");
+        }
+    }
+
+    /**
+     * @brief Constructor
+     * @param policy: the task selection policy
+     */
+    ReadyWorkunitQueue::ReadyWorkunitQueue(Policy policy) : policy(policy) {
+    }
+
+    /**
+     * @brief Insert a Workunit in the queue (does nothing if it is already in the queue)
+     * @param workunit: the Workunit
+     */
+    void ReadyWorkunitQueue::insert(const std::shared_ptr<Workunit> &workunit) {
+        if (this->index.find(workunit.get()) != this->index.end()) {
+            return;
+        }
+
+        Key key;
+        key.has_task = (workunit->task != nullptr);
+        key.priority = 0.0;
+        key.sequence_number = this->next_sequence_number++;
+        if (key.has_task and (this->policy != FIFO)) {
+            WorkflowTask *task = workunit->task;
+            key.task_id = task->getID();
+            switch (this->policy) {
+                case MAXIMUM_FLOPS:
+                    key.priority = -task->getFlops();
+                    break;
+                case MAXIMUM_MINIMUM_CORES:
+                    key.priority = -((double) task->getMinNumCores());
+                    break;
+                case MINIMUM_TOP_LEVEL:
+                    key.priority = (double) task->getTopLevel();
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        this->index[workunit.get()] = this->entries.insert(std::make_pair(key, workunit)).first;
+    }
+
+    /**
+     * @brief Remove a Workunit from the queue
+     * @param workunit: the Workunit
+     * @return true if the Workunit was in the queue, false otherwise
+     */
+    bool ReadyWorkunitQueue::erase(const std::shared_ptr<Workunit> &workunit) {
+        auto it = this->index.find(workunit.get());
+        if (it == this->index.end()) {
+            return false;
+        }
+        this->entries.erase(it->second);
+        this->index.erase(it);
+        return true;
+    }
+
+    /**
+     * @brief Remove the Workunit at some position in the queue
+     * @param position: an iterator to a Workunit in the queue
+     * @return an iterator to the next Workunit
+     */
+    ReadyWorkunitQueue::const_iterator ReadyWorkunitQueue::erase(const_iterator position) {
+        this->index.erase(position.it->second.get());
+        return const_iterator(this->entries.erase(position.it));
+    }
+
+    /**
+     * @brief Check whether a Workunit is in the queue
+     * @param workunit: the Workunit
+     * @return true or false
+     */
+    bool ReadyWorkunitQueue::contains(const std::shared_ptr<Workunit> &workunit) const {
+        return this->index.find(workunit.get()) != this->index.end();
+    }
+
+    /**
+     * @brief Remove all Workunits from the queue
+     */
+    void ReadyWorkunitQueue::clear() {
+        this->entries.clear();
+        this->index.clear();
+    }
+
+}
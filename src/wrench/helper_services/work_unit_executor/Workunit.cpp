@@ -11,6 +11,7 @@
 #include <wrench/workflow/WorkflowTask.h>
 #include <wrench/workflow/Workflow.h>
 #include <iostream>
+#include <unordered_map>
 #include "wrench/services/compute/workunit_executor/Workunit.h"
 #include <wrench-dev.h>
 
@@ -34,6 +35,35 @@ namespace wrench {
             WorkflowTask *task,
             std::map<WorkflowFile *, std::shared_ptr<FileLocation>> file_locations,
             std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation>>> post_file_copies,
+            std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>>> cleanup_file_deletions) :
+            Workunit(job, std::move(pre_file_copies), task,
+                     std::make_shared<const std::map<WorkflowFile *, std::shared_ptr<FileLocation>>>(std::move(file_locations)),
+                     std::move(post_file_copies), std::move(cleanup_file_deletions)) {
+
+        for (auto const &fl : *this->file_locations) {
+            auto file = std::get<0>(fl);
+            auto location = std::get<1>(fl);
+            if ((file == nullptr)  || (location == nullptr)) {
+                throw std::invalid_argument("Workunit::Workunit(): invalid file location spec");
+            }
+        }
+    }
+
+    /**
+    * @brief Constructor
+    * @param job: the job this workunit belongs to
+    * @param pre_file_copies: a vector of file copy actions to perform in sequence first
+    * @param task: a WorkflowTask
+    * @param file_locations: locations where tasks should read/write files (a table that may be shared with other workunits)
+    * @param post_file_copies: a vector of file copy actions to perform in sequence after all tasks
+    * @param cleanup_file_deletions: a vector of file deletion actions to perform last
+    */
+    Workunit::Workunit(
+            StandardJob *job,
+            std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation>>> pre_file_copies,
+            WorkflowTask *task,
+            std::shared_ptr<const std::map<WorkflowFile *, std::shared_ptr<FileLocation>>> file_locations,
+            std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation>>> post_file_copies,
             std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>>> cleanup_file_deletions) {
 
         this->num_pending_parents = 0;
@@ -48,12 +78,10 @@ namespace wrench {
             }
         }
 
-        for (auto const &fl : file_locations) {
-            auto file = std::get<0>(fl);
-            auto location = std::get<1>(fl);
-            if ((file == nullptr)  || (location == nullptr)) {
-                throw std::invalid_argument("Workunit::Workunit(): invalid file location spec");
-            }
+        // The file location table is not checked entry by entry, since it is typically shared by
+        // many workunits (the other constructor checks it)
+        if (file_locations == nullptr) {
+            throw std::invalid_argument("Workunit::Workunit(): invalid file location table");
         }
 
         for (auto const &pfc : post_file_copies) {
@@ -74,11 +102,11 @@ namespace wrench {
         }
 
         this->job = job;
-        this->pre_file_copies = pre_file_copies;
+        this->pre_file_copies = std::move(pre_file_copies);
         this->task = task;
-        this->file_locations = file_locations;
-        this->post_file_copies = post_file_copies;
-        this->cleanup_file_deletions = cleanup_file_deletions;
+        this->file_locations = std::move(file_locations);
+        this->post_file_copies = std::move(post_file_copies);
+        this->cleanup_file_deletions = std::move(cleanup_file_deletions);
 
     }
 
@@ -153,14 +181,21 @@ namespace wrench {
                                                                     (std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation> >>) {});
         }
 
-        // Create the task work units, if any
+        // Create the task work units, if any (which all share the same file location table)
+        auto file_locations = std::make_shared<const std::map<WorkflowFile *, std::shared_ptr<FileLocation>>>(
+                job->file_locations);
+        std::unordered_map<WorkflowTask *, std::shared_ptr<Workunit>> task_to_work_unit;
+        task_work_units.reserve(job->tasks.size());
+        task_to_work_unit.reserve(job->tasks.size());
         for (auto const &task : job->tasks) {
-            task_work_units.push_back(std::make_shared<Workunit>(job,
-                                                                 (std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation> >>) {},
-                                                                 task,
-                                                                 job->file_locations,
-                                                                 (std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation> >>) {},
-                                                                 (std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation> >>) {}));
+            auto task_work_unit = std::make_shared<Workunit>(job,
+                                                             (std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation> >>) {},
+                                                             task,
+                                                             file_locations,
+                                                             (std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation>, std::shared_ptr<FileLocation> >>) {},
+                                                             (std::vector<std::tuple<WorkflowFile *, std::shared_ptr<FileLocation> >>) {});
+            task_work_units.push_back(task_work_unit);
+            task_to_work_unit[task] = task_work_unit;
         }
 
         // Add dependencies between task work units, if any
@@ -168,12 +203,10 @@ namespace wrench {
             WorkflowTask *task = task_work_unit->task;
 
             if (task->getInternalState() != WorkflowTask::InternalState::TASK_READY) {
-                std::vector<WorkflowTask *> current_task_parents = task->getWorkflow()->getTaskParents(task);
-
-                for (auto const &potential_parent_task_work_unit : task_work_units) {
-                    if (std::find(current_task_parents.begin(), current_task_parents.end(),
-                                  potential_parent_task_work_unit->task) != current_task_parents.end()) {
-                        Workunit::addDependency(potential_parent_task_work_unit, task_work_unit);
+                for (auto const &parent_task : task->getWorkflow()->getTaskParents(task)) {
+                    auto it = task_to_work_unit.find(parent_task);
+                    if (it != task_to_work_unit.end()) {
+                        Workunit::addDependency(it->second, task_work_unit);
                     }
                 }
             }
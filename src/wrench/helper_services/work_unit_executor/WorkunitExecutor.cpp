@@ -24,7 +24,6 @@
 #include <wrench/simulation/SimulationTimestampTypes.h>
 #include <wrench/services/compute/workunit_executor/Workunit.h>
 #include <wrench/workflow//failure_causes/NoScratchSpace.h>
-#include "ComputeThread.h"
 #include "wrench/simulation/Simulation.h"
 
 #include "wrench/logging/TerminalOutput.h"
@@ -37,7 +36,6 @@
 
 WRENCH_LOG_CATEGORY(wrench_core_workunit_executor, "Log category for Multicore Workunit Executor");
 
-//#define S4U_KILL_JOIN_WORKS
 
 namespace wrench {
 
@@ -136,17 +134,21 @@ namespace wrench {
         this->acquireDaemonLock();
 
 
-        // Then kill all compute threads, if any
-        WRENCH_INFO("Killing %ld compute threads", this->compute_threads.size());
-        for (auto const &compute_thread : this->compute_threads) {
-            WRENCH_INFO("Killing compute thread [%s]", compute_thread->getName().c_str());
-            compute_thread->kill();
-        }
-        this->compute_threads.clear();
-
         this->terminated_due_job_being_forcefully_terminated = job_termination;
         this->killActor();
 
+        // Then cancel all compute activities, if any (killing the actor only
+        // cancels the one it was waiting on)
+        WRENCH_INFO("Cancelling %ld compute activities", this->compute_activities.size());
+        for (auto const &compute_activity : this->compute_activities) {
+            try {
+                compute_activity->cancel();
+            } catch (std::exception &e) {
+                // Ignore (the activity may have already completed or been cancelled)
+            }
+        }
+        this->compute_activities.clear();
+
         this->releaseDaemonLock();
 
     }
@@ -187,7 +189,7 @@ namespace wrench {
                     break;
                 }
             }
-            for (auto const &fl : workunit->file_locations) {
+            for (auto const &fl : *(workunit->file_locations)) {
                 if (fl.second == FileLocation::SCRATCH) {
                     scratch_space_ok = false;
                     break;
@@ -330,37 +332,37 @@ namespace wrench {
             WRENCH_INFO("Reading the %ld input files for task %s", task->getInputFiles().size(), task->getID().c_str());
             try {
                 task->setReadInputStartDate(S4U_Simulation::getClock());
-//                std::map<WorkflowFile *, std::shared_ptr<FileLocation>> files_to_read;
-                std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> files_to_read;
+                std::map<WorkflowFile *, std::shared_ptr<FileLocation>> files_to_read;
                 for (auto const &f : task->getInputFiles()) {
-                    if (work->file_locations.find(f) != work->file_locations.end()) {
-                        files_to_read.push_back(std::make_pair(f, work->file_locations[f]));
+                    if (work->file_locations->find(f) != work->file_locations->end()) {
+                        files_to_read[f] = work->file_locations->at(f);
                     } else {
                         if (this->scratch_space == nullptr) { // File should be in scratch, but there is no scratch
                             throw WorkflowExecutionException(
                                     std::make_shared<FileNotFound>(f, FileLocation::SCRATCH));
                         }
-                        files_to_read.push_back(std::make_pair(
-                                f,
-                                FileLocation::LOCATION(this->scratch_space,
-                                                       this->scratch_space->getMountPoint() + "/" +
-                                                       job->getName())));
+                        files_to_read[f] = FileLocation::LOCATION(this->scratch_space,
+                                                                  this->scratch_space->getMountPoint() + "/" +
+                                                                  job->getName());
                         this->files_stored_in_scratch.insert(f);
                     }
                 }
-                for (auto const &p : files_to_read) {
-                    WorkflowFile *f = p.first;
-                    std::shared_ptr<FileLocation> l = p.second;
-
-                    try{
-                        this->simulation->getOutput().addTimestampFileReadStart(f, l.get(), l->getStorageService().get(), task);
-                        StorageService::readFile(f, l);
-                    } catch (WorkflowExecutionException &e) {
-                        this->simulation->getOutput().addTimestampFileReadFailure(f, l.get(), l->getStorageService().get(), task);
-                        throw;
-                    }
-                    this->simulation->getOutput().addTimestampFileReadCompletion(f, l.get(), l->getStorageService().get(), task);
-                }
+                StorageService::readFiles(
+                        files_to_read, task->getMaxNumConcurrentFileOperations(),
+                        [this, task](WorkflowFile *f, std::shared_ptr<FileLocation> l,
+                                     StorageService::FileOperationEvent event) {
+                            switch (event) {
+                                case StorageService::FILE_OPERATION_STARTED:
+                                    this->simulation->getOutput().addTimestampFileReadStart(f, l.get(), l->getStorageService().get(), task);
+                                    break;
+                                case StorageService::FILE_OPERATION_COMPLETED:
+                                    this->simulation->getOutput().addTimestampFileReadCompletion(f, l.get(), l->getStorageService().get(), task);
+                                    break;
+                                case StorageService::FILE_OPERATION_FAILED:
+                                    this->simulation->getOutput().addTimestampFileReadFailure(f, l.get(), l->getStorageService().get(), task);
+                                    break;
+                            }
+                        });
                 task->setReadInputEndDate(S4U_Simulation::getClock());
             } catch (WorkflowExecutionException &e) {
                 this->failure_timestamp_should_be_generated = true;
@@ -389,30 +391,31 @@ namespace wrench {
             // Write all output files
             try {
                 task->setWriteOutputStartDate(S4U_Simulation::getClock());
-//                std::map<WorkflowFile *, std::shared_ptr<FileLocation>> files_to_write;
-                std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> files_to_write;
+                std::map<WorkflowFile *, std::shared_ptr<FileLocation>> files_to_write;
                 for (auto const &f : task->getOutputFiles()) {
-                    if (work->file_locations.find(f) != work->file_locations.end()) {
-                        files_to_write.push_back(std::make_pair(f, work->file_locations[f]));
+                    if (work->file_locations->find(f) != work->file_locations->end()) {
+                        files_to_write[f] = work->file_locations->at(f);
                     } else {
-                        files_to_write.push_back(std::make_pair(f, FileLocation::LOCATION(this->scratch_space, this->scratch_space->getMountPoint() + "/" + job->getName())));
+                        files_to_write[f] = FileLocation::LOCATION(this->scratch_space, this->scratch_space->getMountPoint() + "/" + job->getName());
                         this->files_stored_in_scratch.insert(f);
                     }
                 }
-
-                for (auto const &p : files_to_write) {
-                    WorkflowFile *f = p.first;
-                    std::shared_ptr<FileLocation> l = p.second;
-
-                    try{
-                        this->simulation->getOutput().addTimestampFileWriteStart(f, l.get(), l->getStorageService().get(), task);
-                        StorageService::writeFile(f, l);
-                    } catch (WorkflowExecutionException &e) {
-                        this->simulation->getOutput().addTimestampFileWriteFailure(f, l.get(), l->getStorageService().get(), task);
-                        throw;
-                    }
-                    this->simulation->getOutput().addTimestampFileWriteCompletion(f, l.get(), l->getStorageService().get(), task);
-                }
+                StorageService::writeFiles(
+                        files_to_write, task->getMaxNumConcurrentFileOperations(),
+                        [this, task](WorkflowFile *f, std::shared_ptr<FileLocation> l,
+                                     StorageService::FileOperationEvent event) {
+                            switch (event) {
+                                case StorageService::FILE_OPERATION_STARTED:
+                                    this->simulation->getOutput().addTimestampFileWriteStart(f, l.get(), l->getStorageService().get(), task);
+                                    break;
+                                case StorageService::FILE_OPERATION_COMPLETED:
+                                    this->simulation->getOutput().addTimestampFileWriteCompletion(f, l.get(), l->getStorageService().get(), task);
+                                    break;
+                                case StorageService::FILE_OPERATION_FAILED:
+                                    this->simulation->getOutput().addTimestampFileWriteFailure(f, l.get(), l->getStorageService().get(), task);
+                                    break;
+                            }
+                        });
                 task->setWriteOutputEndDate(S4U_Simulation::getClock());
             } catch (WorkflowExecutionException &e) {
                 this->failure_timestamp_should_be_generated = true;
@@ -429,14 +432,7 @@ namespace wrench {
 
             // Deal with Children
             for (auto child : task->getWorkflow()->getTaskChildren(task)) {
-                bool all_parents_completed = true;
-                for (auto parent : child->getWorkflow()->getTaskParents(child)) {
-                    if (parent->getInternalState() != WorkflowTask::InternalState::TASK_COMPLETED) {
-                        all_parents_completed = false;
-                        break;
-                    }
-                }
-                if (all_parents_completed) {
+                if (child->getNumberOfNotCompletedParents() == 0) {
                     child->setInternalState(WorkflowTask::InternalState::TASK_READY);
                 }
             }
@@ -490,8 +486,6 @@ namespace wrench {
                                                    bool simulate_computation_as_sleep) {
         double effective_flops = (flops / (this->num_cores * parallel_efficiency));
 
-        std::string tmp_mailbox = S4U_Mailbox::generateUniqueMailboxName("workunit_executor");
-
         if (simulate_computation_as_sleep) {
 
             /** Simulate computation as sleep **/
@@ -504,17 +498,17 @@ namespace wrench {
             Simulation::sleep(sleep_time);
 
         } else {
-            /** Simulate computation with actual compute threads **/
+            /** Simulate computation with one asynchronous execution per core **/
 
-            // Nobody kills me while I am starting compute threads!
+            // Nobody kills me while I am starting compute activities!
             this->acquireDaemonLock();
 
-            WRENCH_INFO("Launching %ld compute threads", this->num_cores);
+            WRENCH_INFO("Launching %ld compute activities", this->num_cores);
 
-            // Create a compute thread to run the computation on each core
+            // Start an execution on each core, all run by this actor (rather
+            // than by one compute thread actor per core)
             bool success = true;
             for (unsigned long i = 0; i < this->num_cores; i++) {
-//        WRENCH_INFO("Creating compute thread %ld", i);
                 try {
                     S4U_Simulation::sleep(this->thread_startup_overhead);
                 } catch (std::exception &e) {
@@ -522,64 +516,46 @@ namespace wrench {
                     this->releaseDaemonLock();
                     throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new FatalFailure()));
                 }
-                std::shared_ptr<ComputeThread> compute_thread;
                 try {
-                    compute_thread = std::shared_ptr<ComputeThread>(
-                            new ComputeThread(S4U_Simulation::getHostName(), effective_flops, tmp_mailbox));
-                    compute_thread->simulation = this->simulation;
-                    compute_thread->start(compute_thread, true, false); // Daemonized, no auto-restart
+                    this->compute_activities.push_back(simgrid::s4u::this_actor::exec_async(effective_flops));
                 } catch (std::exception &e) {
                     // Some internal SimGrid exceptions...????
-                    WRENCH_INFO("Could not create compute thread... perhaps I am being killed?");
+                    WRENCH_INFO("Could not start compute activity... perhaps I am being killed?");
                     success = false;
                     break;
                 }
-//                WRENCH_INFO("Launched compute thread [%s]", compute_thread->getName().c_str());
-                this->compute_threads.push_back(compute_thread);
             }
 
-
             if (!success) {
-                WRENCH_INFO("Failed to create some compute threads...");
-                // TODO: Dangerous to kill these now?? (this was commented out before, but seems legit, so Henri uncommented them)
-                for (auto const &ct : this->compute_threads) {
-                    ct->kill();
+                WRENCH_INFO("Failed to start some compute activities...");
+                for (auto const &ca : this->compute_activities) {
+                    try {
+                        ca->cancel();
+                    } catch (std::exception &e) {
+                        // Ignore
+                    }
                 }
+                this->compute_activities.clear();
                 this->releaseDaemonLock();
                 throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ComputeThreadHasDied()));
             }
 
             this->releaseDaemonLock();  // People can kill me now
 
-            success = true;
-            // Wait for all actors to complete
-#ifndef S4U_KILL_JOIN_WORKS
-            for (unsigned long i = 0; i < this->compute_threads.size(); i++) {
+            // Wait for all compute activities to complete
+            for (auto const &ca : this->compute_activities) {
                 try {
-                    S4U_Mailbox::getMessage(tmp_mailbox);
-                } catch (std::shared_ptr<NetworkError> &e) {
-                    WRENCH_INFO("Got a network error when trying to get completion message from compute thread");
-                    // Do nothing, perhaps the child has died
+                    ca->wait();
+                } catch (std::exception &e) {
+                    WRENCH_INFO("Got an exception while waiting for a compute activity (%s)", e.what());
+                    // Do nothing, perhaps the host has failed
                     success = false;
                     continue;
                 }
             }
-#else
-            for (unsigned long i=0; i < this->compute_threads.size(); i++) {
-            WRENCH_INFO("JOINING WITH A COMPUTE THREAD %s", this->compute_threads[i]->process_name.c_str());
-          try {
-            this->compute_threads[i]->join();
-          } catch (std::shared_ptr<FatalFailure> &e) {
-            WRENCH_INFO("EXCEPTION WHILE JOINED");
-            // Do nothing, perhaps the child has died...
-            continue;
-          }
-          WRENCH_INFO("JOINED with COMPUTE THREAD %s", this->compute_threads[i]->process_name.c_str());
 
-        }
-#endif
-            WRENCH_INFO("All compute threads have completed");
-            this->compute_threads.clear();
+            WRENCH_INFO("All compute activities have completed");
+            this->compute_activities.clear();
 
             if (!success) {
                 throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new ComputeThreadHasDied()));
@@ -9,11 +9,33 @@
 
 #include <string>
 #include <simgrid/s4u/Actor.hpp>
+#include <xbt/Extendable.hpp>
 #include <iostream>
 #include "wrench/logging/TerminalOutput.h"
 
 namespace wrench {
 
+    /**
+     * @brief The logging color of an actor, stored as actor-local data (so that
+     *        logging doesn't require a lookup in a global map)
+     */
+    class ActorLoggingColor {
+    public:
+        /** @brief The extension ID (created the first time a color is set) */
+        static simgrid::xbt::Extension<simgrid::s4u::Actor, ActorLoggingColor> EXTENSION_ID;
+
+        /**
+         * @brief Constructor
+         * @param color_code: the color ASCII code sequence
+         */
+        explicit ActorLoggingColor(const char *color_code) : color_code(color_code) {}
+
+        /** @brief The color ASCII code sequence */
+        const char *color_code;
+    };
+
+    simgrid::xbt::Extension<simgrid::s4u::Actor, ActorLoggingColor> ActorLoggingColor::EXTENSION_ID;
+
     const char *TerminalOutput::color_codes[] = {
             "\033[1;30m",
             "\033[1;31m",
@@ -25,7 +47,6 @@ namespace wrench {
             "\033[1;37m",
     };
 
-    std::map<simgrid::s4u::Actor *, std::string> TerminalOutput::colormap;
     bool TerminalOutput::color_enabled = true;
 
     /**
@@ -34,7 +55,19 @@ namespace wrench {
      * @param color: a terminal output color
      */
     void TerminalOutput::setThisProcessLoggingColor(Color color) {
-        TerminalOutput::colormap[simgrid::s4u::Actor::self()] = TerminalOutput::color_codes[color];
+        if (simgrid::s4u::this_actor::is_maestro()) {
+            return;
+        }
+        if (not ActorLoggingColor::EXTENSION_ID.valid()) {
+            ActorLoggingColor::EXTENSION_ID = simgrid::s4u::Actor::extension_create<ActorLoggingColor>();
+        }
+        auto actor = simgrid::s4u::Actor::self();
+        auto logging_color = actor->extension<ActorLoggingColor>();
+        if (logging_color) {
+            logging_color->color_code = TerminalOutput::color_codes[color];
+        } else {
+            actor->extension_set(new ActorLoggingColor(TerminalOutput::color_codes[color]));
+        }
     }
 
     /**
@@ -65,16 +98,15 @@ namespace wrench {
 
     /**
      * @brief Get the current output color ASCII code sequence for the current process
-     * @return the color ASCII code sequence as a string
+     * @return the color ASCII code sequence (empty if none was set)
      */
-    std::string TerminalOutput::getThisProcessLoggingColor() {
+    const char *TerminalOutput::getThisProcessLoggingColor() {
 
-        if (simgrid::s4u::this_actor::is_maestro() ||
-            (TerminalOutput::colormap.find(simgrid::s4u::Actor::self()) == TerminalOutput::colormap.end())) {
+        if ((!ActorLoggingColor::EXTENSION_ID.valid()) || simgrid::s4u::this_actor::is_maestro()) {
             return "";
-        } else {
-            return TerminalOutput::colormap[simgrid::s4u::Actor::self()];
         }
+        auto logging_color = simgrid::s4u::Actor::self()->extension<ActorLoggingColor>();
+        return (logging_color ? logging_color->color_code : "");
     }
 
 };
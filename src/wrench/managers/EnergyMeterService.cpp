@@ -72,6 +72,34 @@ namespace wrench {
         }
     }
 
+    /**
+     * @brief Constructor for an event-driven energy meter, which records the energy consumption of a host only
+     *        when its power consumption may change (pstate change, host turned on/off, computation started/completed/aborted
+     *        on the host or on one of its VMs), plus once when the meter starts and once when it is stopped.
+     *        Since the power consumption of a host is constant between two such events, its energy
+     *        consumption at any date can be reconstructed exactly by linear interpolation (see
+     *        SimulationOutput::dumpHostEnergyConsumptionJSON()).
+     *
+     * @param hostname: the name of the host on which this service is running
+     * @param hostnames: the list of metered hosts, as hostnames
+     */
+    EnergyMeterService::EnergyMeterService(const std::string hostname, const std::vector<std::string> &hostnames) :
+            Service(hostname, "energy_meter", "energy_meter") {
+
+        if (hostnames.empty()) {
+            throw std::invalid_argument("EnergyMeter::EnergyMeter(): no host to meter!");
+        }
+
+        for (auto const &h : hostnames) {
+            auto host = simgrid::s4u::Host::by_name_or_null(h);
+            if (host == nullptr) {
+                throw std::invalid_argument("EnergyMeter::EnergyMeter(): unknown host " + h);
+            }
+            this->last_measurement_dates[host] = -1.0;
+        }
+        this->event_driven = true;
+    }
+
     /**
      * @brief Kill the energy meter (brutally terminate the daemon)
      */
@@ -103,6 +131,25 @@ namespace wrench {
 
         WRENCH_INFO("New Energy Meter Manager starting (%s)", this->mailbox_name.c_str());
 
+        if (this->event_driven) {
+            for (auto const &h : this->last_measurement_dates) {
+                this->takeMeasurement(h.first);
+            }
+            this->connectCallBacks();
+
+            // Nothing to do but wait to be stopped
+            while (processNextMessage(-1)) {
+            }
+
+            this->disconnectCallBacks();
+            for (auto const &h : this->last_measurement_dates) {
+                this->takeMeasurement(h.first);
+            }
+
+            WRENCH_INFO("Energy Meter Manager terminating");
+            return 0;
+        }
+
         /** Main loop **/
         while (true) {
             S4U_Simulation::computeZeroFlop();
@@ -171,4 +218,88 @@ namespace wrench {
 
     }
 
+    /**
+     * @brief Cleanup method
+     *
+     * @param has_returned_from_main: whether main() returned
+     * @param return_value: the return value (if main() returned)
+     */
+    void EnergyMeterService::cleanup(bool has_returned_from_main, int return_value) {
+        // Unregister the callbacks (if main() did not return)
+        this->disconnectCallBacks();
+    }
+
+    /**
+     * @brief Connect callbacks to the SimGrid signals that mark the events at which
+     *        the power consumption of a host may change
+     */
+    void EnergyMeterService::connectCallBacks() {
+
+        this->on_state_change_call_back_id = simgrid::s4u::Host::on_state_change.connect(
+                [this](simgrid::s4u::Host &h) {
+                    this->takeMeasurement(&h);
+                });
+
+        this->on_speed_change_call_back_id = simgrid::s4u::Host::on_speed_change.connect(
+                [this](simgrid::s4u::Host &h) {
+                    this->takeMeasurement(&h);
+                });
+
+        this->on_exec_start_call_back_id = simgrid::s4u::Exec::on_start.connect(
+                [this](simgrid::s4u::Actor const &actor, simgrid::s4u::Exec const &exec) {
+                    this->takeMeasurement(actor.get_host());
+                });
+
+        this->on_exec_completion_call_back_id = simgrid::s4u::Exec::on_completion.connect(
+                [this](simgrid::s4u::Actor const &actor, simgrid::s4u::Exec const &exec) {
+                    this->takeMeasurement(actor.get_host());
+                });
+
+        // An actor that terminates (e.g., is killed) may abort an ongoing computation
+        this->on_actor_termination_call_back_id = simgrid::s4u::Actor::on_termination.connect(
+                [this](simgrid::s4u::Actor const &actor) {
+                    this->takeMeasurement(actor.get_host());
+                });
+
+        this->call_backs_connected = true;
+    }
+
+    /**
+     * @brief Disconnect the callbacks, if connected
+     */
+    void EnergyMeterService::disconnectCallBacks() {
+        if (not this->call_backs_connected) {
+            return;
+        }
+        simgrid::s4u::Host::on_state_change.disconnect(this->on_state_change_call_back_id);
+        simgrid::s4u::Host::on_speed_change.disconnect(this->on_speed_change_call_back_id);
+        simgrid::s4u::Exec::on_start.disconnect(this->on_exec_start_call_back_id);
+        simgrid::s4u::Exec::on_completion.disconnect(this->on_exec_completion_call_back_id);
+        simgrid::s4u::Actor::on_termination.disconnect(this->on_actor_termination_call_back_id);
+        this->call_backs_connected = false;
+    }
+
+    /**
+     * @brief Record the energy consumption of a host (or of the physical host of a VM), if it is
+     *        metered and has not already been measured at the current date
+     * @param host: the host
+     */
+    void EnergyMeterService::takeMeasurement(simgrid::s4u::Host *host) {
+        auto vm = dynamic_cast<simgrid::s4u::VirtualMachine *>(host);
+        if (vm != nullptr) {
+            host = vm->get_pm();
+        }
+
+        auto it = this->last_measurement_dates.find(host);
+        if (it == this->last_measurement_dates.end()) {
+            return;
+        }
+        double now = Simulation::getCurrentSimulatedDate();
+        if (it->second == now) {
+            return;
+        }
+        it->second = now;
+        this->simulation->getEnergyConsumed(host->get_name(), true);
+    }
+
 };
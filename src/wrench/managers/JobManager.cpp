@@ -409,16 +409,9 @@ namespace wrench {
             }
             // Make second pass to fix NOT_READY states
             for (auto task : ((StandardJob *) job)->tasks) {
-                if (task->getState() == WorkflowTask::State::NOT_READY) {
-                    bool ready = true;
-                    for (auto parent : task->getWorkflow()->getTaskParents(task)) {
-                        if (parent->getState() != WorkflowTask::State::COMPLETED) {
-                            ready = false;
-                        }
-                    }
-                    if (ready) {
-                        task->setState(WorkflowTask::State::READY);
-                    }
+                if ((task->getState() == WorkflowTask::State::NOT_READY) and
+                    (task->getNumberOfVisiblyNotCompletedParents(false) == 0)) {
+                    task->setState(WorkflowTask::State::READY);
                 }
             }
         } else if (job->getType() == WorkflowJob::PILOT) {
@@ -581,17 +574,19 @@ namespace wrench {
 
             if (task->getInternalState() == WorkflowTask::InternalState::TASK_COMPLETED) {
                 if (task->getUpcomingState() != WorkflowTask::State::COMPLETED) {
-                    if (necessary_state_changes.find(task) == necessary_state_changes.end()) {
-                        necessary_state_changes.insert(std::make_pair(task, WorkflowTask::State::COMPLETED));
-                    } else {
-                        necessary_state_changes[task] = WorkflowTask::State::COMPLETED;
-                    }
+                    necessary_state_changes[task] = WorkflowTask::State::COMPLETED;
+                    // Setting the upcoming state right away updates the children's counts of
+                    // not-(about-to-be-)visibly-completed parents
+                    task->setUpcomingState(WorkflowTask::State::COMPLETED);
                 }
             } else {
                 throw std::runtime_error("JobManager::main(): got a 'job done' message, but task " +
                                          task->getID() + " does not have a TASK_COMPLETED internal state (" +
                                          WorkflowTask::stateToString(task->getInternalState()) + ")");
             }
+        }
+
+        for (auto task : job->tasks) {
             auto children = task->getWorkflow()->getTaskChildren(task);
             for (auto child : children) {
                 switch (child->getInternalState()) {
@@ -610,30 +605,10 @@ namespace wrench {
                                                  WorkflowTask::stateToString(child->getInternalState()));
                         break;
                     case WorkflowTask::InternalState::TASK_READY:
-                        if (child->getState() == WorkflowTask::State::NOT_READY) {
-                            bool all_parents_visibly_completed = true;
-                            for (auto parent : child->getWorkflow()->getTaskParents(child)) {
-                                if (parent->getState() == WorkflowTask::State::COMPLETED) {
-                                    continue; // COMPLETED FROM BEFORE
-                                }
-                                if (parent->getUpcomingState() == WorkflowTask::State::COMPLETED) {
-                                    continue; // COMPLETED FROM BEFORE, BUT NOT YET SEEN BY WMS
-                                }
-                                if ((necessary_state_changes.find(parent) != necessary_state_changes.end()) &&
-                                    (necessary_state_changes[parent] == WorkflowTask::State::COMPLETED)) {
-                                    continue; // ABOUT TO BECOME COMPLETED
-                                }
-                                all_parents_visibly_completed = false;
-                                break;
-                            }
-                            if (all_parents_visibly_completed) {
-                                if (necessary_state_changes.find(child) == necessary_state_changes.end()) {
-                                    necessary_state_changes.insert(
-                                            std::make_pair(child, WorkflowTask::State::READY));
-                                } else {
-                                    necessary_state_changes[child] = WorkflowTask::State::READY;
-                                }
-                            }
+                        // Parents are completed, or about to be visibly completed (possibly as part of this job)
+                        if ((child->getState() == WorkflowTask::State::NOT_READY) and
+                            (child->getNumberOfVisiblyNotCompletedParents(true) == 0)) {
+                            necessary_state_changes[child] = WorkflowTask::State::READY;
                         }
                         break;
                 }
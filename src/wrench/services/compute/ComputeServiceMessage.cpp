@@ -360,4 +360,64 @@ namespace wrench {
     ComputeServiceResourceInformationAnswerMessage::ComputeServiceResourceInformationAnswerMessage(
             std::map<std::string, std::map<std::string, double>> info, double payload)
             : ComputeServiceMessage("RESOURCE_DESCRIPTION_ANSWER", payload), info(info) {}
+
+    /**
+     * @brief Constructor
+     * @param answer_mailbox: the mailbox to which the answer should be sent
+     * @param subscriber_mailbox: the mailbox to which resource availability updates should be pushed
+     * @param payload: the message size in bytes
+     *
+     * @throw std::invalid_argument
+     */
+    ComputeServiceResourceAvailabilitySubscriptionRequestMessage::ComputeServiceResourceAvailabilitySubscriptionRequestMessage(
+            std::string answer_mailbox, std::string subscriber_mailbox, double payload)
+            : ComputeServiceMessage("RESOURCE_AVAILABILITY_SUBSCRIPTION_REQUEST", payload) {
+        if (answer_mailbox.empty() or subscriber_mailbox.empty()) {
+            throw std::invalid_argument(
+                    "ComputeServiceResourceAvailabilitySubscriptionRequestMessage::ComputeServiceResourceAvailabilitySubscriptionRequestMessage(): Invalid arguments");
+        }
+        this->answer_mailbox = answer_mailbox;
+        this->subscriber_mailbox = subscriber_mailbox;
+    }
+
+    /**
+     * @brief Constructor
+     * @param num_idle_cores: the number of idle cores of each host
+     * @param available_ram: the available RAM of each host
+     * @param payload: the message size in bytes
+     */
+    ComputeServiceResourceAvailabilitySubscriptionAnswerMessage::ComputeServiceResourceAvailabilitySubscriptionAnswerMessage(
+            std::map<std::string, unsigned long> num_idle_cores, std::map<std::string, double> available_ram,
+            double payload)
+            : ComputeServiceMessage("RESOURCE_AVAILABILITY_SUBSCRIPTION_ANSWER", payload),
+              num_idle_cores(num_idle_cores), available_ram(available_ram) {}
+
+    /**
+     * @brief Constructor
+     * @param subscriber_mailbox: the mailbox to which resource availability updates were pushed
+     * @param payload: the message size in bytes
+     *
+     * @throw std::invalid_argument
+     */
+    ComputeServiceResourceAvailabilityUnsubscriptionRequestMessage::ComputeServiceResourceAvailabilityUnsubscriptionRequestMessage(
+            std::string subscriber_mailbox, double payload)
+            : ComputeServiceMessage("RESOURCE_AVAILABILITY_UNSUBSCRIPTION_REQUEST", payload) {
+        if (subscriber_mailbox.empty()) {
+            throw std::invalid_argument(
+                    "ComputeServiceResourceAvailabilityUnsubscriptionRequestMessage::ComputeServiceResourceAvailabilityUnsubscriptionRequestMessage(): Invalid arguments");
+        }
+        this->subscriber_mailbox = subscriber_mailbox;
+    }
+
+    /**
+     * @brief Constructor
+     * @param num_idle_cores_deltas: the changes in the number of idle cores of each host
+     * @param available_ram_deltas: the changes in the available RAM of each host
+     * @param payload: the message size in bytes
+     */
+    ComputeServiceResourceAvailabilityUpdateMessage::ComputeServiceResourceAvailabilityUpdateMessage(
+            std::map<std::string, long> num_idle_cores_deltas, std::map<std::string, double> available_ram_deltas,
+            double payload)
+            : ComputeServiceMessage("RESOURCE_AVAILABILITY_UPDATE", payload),
+              num_idle_cores_deltas(num_idle_cores_deltas), available_ram_deltas(available_ram_deltas) {}
 };
@@ -29,5 +29,9 @@ namespace wrench {
     SET_MESSAGEPAYLOAD_NAME(ComputeServiceMessagePayload, TERMINATE_PILOT_JOB_ANSWER_MESSAGE_PAYLOAD);
     SET_MESSAGEPAYLOAD_NAME(ComputeServiceMessagePayload, RESOURCE_DESCRIPTION_REQUEST_MESSAGE_PAYLOAD);
     SET_MESSAGEPAYLOAD_NAME(ComputeServiceMessagePayload, RESOURCE_DESCRIPTION_ANSWER_MESSAGE_PAYLOAD);
+    SET_MESSAGEPAYLOAD_NAME(ComputeServiceMessagePayload, RESOURCE_AVAILABILITY_SUBSCRIPTION_REQUEST_MESSAGE_PAYLOAD);
+    SET_MESSAGEPAYLOAD_NAME(ComputeServiceMessagePayload, RESOURCE_AVAILABILITY_SUBSCRIPTION_ANSWER_MESSAGE_PAYLOAD);
+    SET_MESSAGEPAYLOAD_NAME(ComputeServiceMessagePayload, RESOURCE_AVAILABILITY_UNSUBSCRIPTION_REQUEST_MESSAGE_PAYLOAD);
+    SET_MESSAGEPAYLOAD_NAME(ComputeServiceMessagePayload, RESOURCE_AVAILABILITY_UPDATE_MESSAGE_PAYLOAD);
 
 };
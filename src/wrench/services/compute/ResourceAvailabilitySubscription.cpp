@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "wrench/services/compute/ResourceAvailabilitySubscription.h"
+#include "wrench/services/compute/ComputeService.h"
+#include "wrench/services/compute/ComputeServiceMessage.h"
+#include "wrench/services/compute/ComputeServiceMessagePayload.h"
+#include "wrench/exceptions/WorkflowExecutionException.h"
+#include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include <wrench/workflow/failure_causes/NetworkError.h>
+#include <simgrid/s4u.hpp>
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     *
+     * @param compute_service: the compute service
+     * @param mailbox_name: the mailbox to which the compute service pushes changes
+     * @param num_idle_cores: the initial number of idle cores of each host
+     * @param available_ram: the initial available RAM of each host
+     */
+    ResourceAvailabilitySubscription::ResourceAvailabilitySubscription(
+            std::shared_ptr<ComputeService> compute_service,
+            std::string mailbox_name,
+            std::map<std::string, unsigned long> num_idle_cores,
+            std::map<std::string, double> available_ram) :
+            compute_service(std::move(compute_service)), mailbox_name(std::move(mailbox_name)),
+            num_idle_cores(std::move(num_idle_cores)), available_ram(std::move(available_ram)) {
+        for (auto const &h : this->num_idle_cores) {
+            this->total_num_idle_cores += h.second;
+        }
+    }
+
+    /**
+     * @brief Destructor, which cancels the subscription
+     */
+    ResourceAvailabilitySubscription::~ResourceAvailabilitySubscription() {
+        try {
+            this->cancel();
+        } catch (std::exception &e) {
+            // Nothing to do: destructors should not throw
+        } catch (std::shared_ptr<NetworkError> &e) {
+            // Nothing to do: destructors should not throw
+        }
+    }
+
+    /**
+     * @brief Get the idle core counts for each of the compute service's hosts
+     * @return the idle core counts
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    std::map<std::string, unsigned long> ResourceAvailabilitySubscription::getPerHostNumIdleCores() {
+        this->applyPendingUpdates();
+        return this->num_idle_cores;
+    }
+
+    /**
+     * @brief Get the total idle core count for all hosts of the compute service
+     * @return total idle core count
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    unsigned long ResourceAvailabilitySubscription::getTotalNumIdleCores() {
+        this->applyPendingUpdates();
+        return this->total_num_idle_cores;
+    }
+
+    /**
+     * @brief Get the RAM availability for each of the compute service's hosts
+     * @return the RAM availability map
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    std::map<std::string, double> ResourceAvailabilitySubscription::getPerHostAvailableMemoryCapacity() {
+        this->applyPendingUpdates();
+        return this->available_ram;
+    }
+
+    /**
+     * @brief Cancel the subscription (the compute service stops pushing changes)
+     */
+    void ResourceAvailabilitySubscription::cancel() {
+        if (this->cancelled) {
+            return;
+        }
+        this->cancelled = true;
+        // No message can be sent from outside any simulated process (e.g., after the simulation has completed)
+        if (simgrid::s4u::this_actor::is_maestro() or (not this->compute_service->isUp())) {
+            return;
+        }
+        S4U_Mailbox::dputMessage(
+                this->compute_service->mailbox_name,
+                new ComputeServiceResourceAvailabilityUnsubscriptionRequestMessage(
+                        this->mailbox_name,
+                        this->compute_service->getMessagePayloadValue(
+                                ComputeServiceMessagePayload::RESOURCE_AVAILABILITY_UNSUBSCRIPTION_REQUEST_MESSAGE_PAYLOAD)));
+    }
+
+    /**
+     * @brief Apply the changes that the compute service has pushed since the previous query
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    void ResourceAvailabilitySubscription::applyPendingUpdates() {
+
+        if (this->cancelled) {
+            throw std::runtime_error(
+                    "ResourceAvailabilitySubscription::applyPendingUpdates(): The subscription has been cancelled");
+        }
+
+        this->compute_service->assertServiceIsUp();
+
+        while (S4U_Mailbox::hasPendingMessage(this->mailbox_name)) {
+            std::shared_ptr<SimulationMessage> message = nullptr;
+            try {
+                message = S4U_Mailbox::getMessage(this->mailbox_name);
+            } catch (std::shared_ptr<NetworkError> &cause) {
+                throw WorkflowExecutionException(cause);
+            }
+
+            if (auto msg = std::dynamic_pointer_cast<ComputeServiceResourceAvailabilityUpdateMessage>(message)) {
+                for (auto const &d : msg->num_idle_cores_deltas) {
+                    auto &count = this->num_idle_cores[d.first];
+                    count = (unsigned long) ((long) count + d.second);
+                    this->total_num_idle_cores = (unsigned long) ((long) this->total_num_idle_cores + d.second);
+                }
+                for (auto const &d : msg->available_ram_deltas) {
+                    this->available_ram[d.first] += d.second;
+                }
+            } else {
+                throw std::runtime_error(
+                        "ResourceAvailabilitySubscription::applyPendingUpdates(): Unexpected [" +
+                        message->getName() + "] message");
+            }
+        }
+    }
+
+};
@@ -7,6 +7,7 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
 #include <typeinfo>
 #include <map>
 #include <wrench/util/PointerUtil.h>
@@ -26,7 +27,6 @@
 #include "wrench/simulation/Simulation.h"
 #include "wrench/workflow/job/PilotJob.h"
 #include "wrench/workflow/job/StandardJob.h"
-#include "wrench/services/helpers/ServiceTerminationDetector.h"
 #include "wrench/services/helpers/HostStateChangeDetector.h"
 #include "wrench/workflow/failure_causes/JobTypeNotSupported.h"
 #include "wrench/workflow/failure_causes/HostError.h"
@@ -62,6 +62,7 @@ namespace wrench {
                     std::make_pair(host.first, S4U_Simulation::getHostMemoryCapacity(host.first)));
             this->running_thread_counts.insert(std::make_pair(host.first, 0));
         }
+        this->buildHostIndex();
 
         this->running_jobs.clear();
         this->job_run_specs.clear();
@@ -69,6 +70,8 @@ namespace wrench {
         this->ready_workunits.clear();
         this->completed_workunits.clear();
         this->workunit_executors.clear();
+        this->analytical_events.clear();
+        this->analytical_task_executions.clear();
 
     }
 
@@ -503,6 +506,7 @@ namespace wrench {
                     std::make_pair(host.first, S4U_Simulation::getHostMemoryCapacity(host.first)));
             this->running_thread_counts.insert(std::make_pair(host.first, 0));
         }
+        this->buildHostIndex();
 
 
         this->ttl = ttl;
@@ -542,13 +546,22 @@ namespace wrench {
             }
             this->host_state_change_monitor = std::shared_ptr<HostStateChangeDetector>(
                     new HostStateChangeDetector(this->hostname, hosts_to_monitor, true, true, true,
-                                                this->getSharedPtr<Service>(), this->mailbox_name,
-                                                {{HostStateChangeDetectorProperty::MONITORING_PERIOD, "1.0"}}));
+                                                this->getSharedPtr<Service>(), this->mailbox_name));
             this->host_state_change_monitor->simulation = this->simulation;
             this->host_state_change_monitor->start(this->host_state_change_monitor, true,
                                                    false); // Daemonized, no auto-restart
         }
 
+        {
+            // Create the monitor that will let me know when a workunit executor has died
+            this->workunit_executor_monitor = std::shared_ptr<ServiceLivenessMonitor>(
+                    new ServiceLivenessMonitor(this->hostname, this->getSharedPtr<Service>(), this->mailbox_name,
+                                               true, false));
+            this->workunit_executor_monitor->simulation = this->simulation;
+            this->workunit_executor_monitor->start(this->workunit_executor_monitor, true,
+                                                   false); // Daemonized, no auto-restart
+        }
+
         // Set an alarm for my timely death, if necessary
         if (this->has_ttl) {
             this->death_date = S4U_Simulation::getClock() + this->ttl;
@@ -560,12 +573,115 @@ namespace wrench {
             /** Dispatch ready work units **/
             this->dispatchReadyWorkunits();
 
+            /** Push resource availability changes to subscribers **/
+            this->pushResourceAvailabilityUpdates();
+
         }
 
         WRENCH_INFO("BareMetalComputeService on host %s terminating cleanly!", S4U_Simulation::getHostName().c_str());
         return this->exit_code;
     }
 
+    /**
+     * @brief Build the host index used to pick allocations (from the current running thread counts)
+     */
+    void BareMetalComputeService::buildHostIndex() {
+        this->host_classes.clear();
+        this->host_class_indices.clear();
+        for (auto const &r : this->compute_resources) {
+            this->indexHost(r.first);
+        }
+    }
+
+    /**
+     * @brief Put a host in the host index, in the class that corresponds to its number of cores
+     *        and its current flop rate (removing it from its previous class, if any)
+     * @param hostname: the host's name
+     */
+    void BareMetalComputeService::indexHost(const std::string &hostname) {
+        auto compute_resource = this->compute_resources.find(hostname);
+        if (compute_resource == this->compute_resources.end()) {
+            return;
+        }
+        unsigned long num_cores = std::get<0>(compute_resource->second);
+        double flop_rate = S4U_Simulation::getHostFlopRate(hostname);
+        auto entry = std::make_pair(this->running_thread_counts[hostname], hostname);
+
+        auto current = this->host_class_indices.find(hostname);
+        if (current != this->host_class_indices.end()) {
+            auto &current_class = this->host_classes[current->second];
+            if ((current_class.num_cores == num_cores) and (current_class.flop_rate == flop_rate)) {
+                return;
+            }
+            current_class.hosts_by_load.erase(entry);
+        }
+
+        unsigned long class_index;
+        for (class_index = 0; class_index < this->host_classes.size(); class_index++) {
+            if ((this->host_classes[class_index].num_cores == num_cores) and
+                (this->host_classes[class_index].flop_rate == flop_rate)) {
+                break;
+            }
+        }
+        if (class_index == this->host_classes.size()) {
+            HostClass host_class;
+            host_class.num_cores = num_cores;
+            host_class.flop_rate = flop_rate;
+            this->host_classes.push_back(host_class);
+        }
+        this->host_classes[class_index].hosts_by_load.insert(entry);
+        this->host_class_indices[hostname] = class_index;
+    }
+
+    /**
+     * @brief Update the number of threads running on a host (and the host index)
+     * @param hostname: the host's name
+     * @param delta: the change in the number of running threads
+     */
+    void BareMetalComputeService::updateRunningThreadCount(const std::string &hostname, long delta) {
+        unsigned long num_idle_cores = 0;
+        if (not this->resource_availability_subscriber_mailboxes.empty()) {
+            num_idle_cores = this->getNumIdleCores(hostname);
+        }
+        unsigned long &count = this->running_thread_counts[hostname];
+        auto index = this->host_class_indices.find(hostname);
+        if (index != this->host_class_indices.end()) {
+            auto &hosts_by_load = this->host_classes[index->second].hosts_by_load;
+            hosts_by_load.erase(std::make_pair(count, hostname));
+            count = (unsigned long) ((long) count + delta);
+            hosts_by_load.insert(std::make_pair(count, hostname));
+        } else {
+            count = (unsigned long) ((long) count + delta);
+        }
+        if (not this->resource_availability_subscriber_mailboxes.empty()) {
+            this->pending_num_idle_cores_deltas[hostname] +=
+                    (long) this->getNumIdleCores(hostname) - (long) num_idle_cores;
+        }
+    }
+
+    /**
+     * @brief Update the available RAM of a host
+     * @param hostname: the host's name
+     * @param delta: the change in available RAM
+     */
+    void BareMetalComputeService::updateRamAvailability(const std::string &hostname, double delta) {
+        this->ram_availabilities[hostname] += delta;
+        if (not this->resource_availability_subscriber_mailboxes.empty()) {
+            this->pending_available_ram_deltas[hostname] += delta;
+        }
+    }
+
+    /**
+     * @brief Get the number of idle cores of a host
+     * @param hostname: the host's name
+     * @return a number of cores
+     */
+    unsigned long BareMetalComputeService::getNumIdleCores(const std::string &hostname) {
+        unsigned long num_cores = std::get<0>(this->compute_resources[hostname]);
+        unsigned long running_threads = this->running_thread_counts[hostname];
+        return (running_threads >= num_cores) ? 0 : num_cores - running_threads;
+    }
+
     /**
      * @brief helper function to figure out where/how a task should run
      *
@@ -582,85 +698,107 @@ namespace wrench {
                                                                                    double required_ram,
                                                                                    std::set<std::string> &hosts_to_avoid) {
 
-        // Compute possible hosts
-        std::set<std::string> possible_hosts;
+        double lowest_load = DBL_MAX;
+        std::string picked_host = "";
+        unsigned long picked_num_cores = 0;
         std::string new_host_to_avoid = "";
         double new_host_to_avoid_ram_capacity = 0;
-        for (auto const &r : this->compute_resources) {
-
 
-            // If there is a required host, then don't even look at others
-            if (not required_host.empty() and (r.first != required_host)) {
-                continue;
+        // If there is a required host, then only look at that host (in its class)
+        unsigned long required_host_class_index = 0;
+        if (not required_host.empty()) {
+            auto index = this->host_class_indices.find(required_host);
+            if (index == this->host_class_indices.end()) {
+                return std::make_tuple(std::string(), 0);
             }
+            required_host_class_index = index->second;
+        }
 
-            // If the host is down, then don't look at it
-            if (not Simulation::isHostOn(r.first)) {
-                continue;
-            }
+        // Look at each class of hosts, in which hosts are sorted by load (so that the first
+        // suitable host in a class is the least loaded one of that class)
+        for (unsigned long class_index = 0; class_index < this->host_classes.size(); class_index++) {
+            auto const &host_class = this->host_classes[class_index];
 
-            // If the host has compute speed zero, then don't look at it
-            if (Simulation::getHostFlopRate(r.first) <= 0.0) {
+            if (not required_host.empty() and (class_index != required_host_class_index)) {
                 continue;
             }
 
-            if ((required_num_cores == 0) and (std::get<0>(r.second) < task->getMinNumCores())) {
+            if ((required_num_cores == 0) and (host_class.num_cores < task->getMinNumCores())) {
                 continue;
             }
-            if ((required_num_cores != 0) and (std::get<0>(r.second) < required_num_cores)) {
+            if ((required_num_cores != 0) and (host_class.num_cores < required_num_cores)) {
                 continue;
             }
-            if ((required_ram > 0) and (hosts_to_avoid.find(r.first) != hosts_to_avoid.end())) {
-                continue;
+
+            unsigned long used_num_cores;
+            if (required_num_cores == 0) {
+                used_num_cores = std::min(host_class.num_cores, task->getMaxNumCores()); // as many cores as possible
+            } else {
+                used_num_cores = required_num_cores;
             }
-            if ((required_ram > 0) and (this->ram_availabilities[r.first] < required_ram)) {
-                if (new_host_to_avoid.empty()) {
-                    new_host_to_avoid = r.first;
-                    new_host_to_avoid_ram_capacity = this->ram_availabilities[r.first];
-                } else {
-                    if (this->ram_availabilities[r.first] > new_host_to_avoid_ram_capacity) {
-                        // Make sure we "Avoid" the host with the most RAM (as it might becomes usable sooner
-                        new_host_to_avoid = r.first;
-                        new_host_to_avoid_ram_capacity = this->ram_availabilities[r.first];
-                    }
+
+            auto host_it = host_class.hosts_by_load.begin();
+            auto host_end = host_class.hosts_by_load.end();
+            if (not required_host.empty()) {
+                host_it = host_class.hosts_by_load.find(
+                        std::make_pair(this->running_thread_counts[required_host], required_host));
+                if (host_it != host_end) {
+                    host_end = std::next(host_it);
                 }
-                continue;
             }
 
-            possible_hosts.insert(r.first);
+            for (; host_it != host_end; ++host_it) {
+                unsigned long num_running_threads = host_it->first;
+                const std::string &hostname = host_it->second;
+
+                // If the host is down, then don't look at it
+                if (not Simulation::isHostOn(hostname)) {
+                    continue;
+                }
+
+                // If the host has compute speed zero, then don't look at it
+                double flop_rate = S4U_Simulation::getHostFlopRate(hostname);
+                if (flop_rate <= 0.0) {
+                    continue;
+                }
+
+                if (required_ram > 0) {
+                    if (hosts_to_avoid.find(hostname) != hosts_to_avoid.end()) {
+                        continue;
+                    }
+                    double available_ram = this->ram_availabilities[hostname];
+                    if (available_ram < required_ram) {
+                        // Make sure we "Avoid" the host with the most RAM (as it might becomes usable sooner)
+                        if (new_host_to_avoid.empty() or (available_ram > new_host_to_avoid_ram_capacity) or
+                            ((available_ram == new_host_to_avoid_ram_capacity) and (hostname < new_host_to_avoid))) {
+                            new_host_to_avoid = hostname;
+                            new_host_to_avoid_ram_capacity = available_ram;
+                        }
+                        continue;
+                    }
+                }
+
+                // A totally heuristic load estimate
+                double load = ((double) (num_running_threads + used_num_cores) / (double) host_class.num_cores) / flop_rate;
+                if ((load < lowest_load) or ((load == lowest_load) and (hostname < picked_host))) {
+                    lowest_load = load;
+                    picked_host = hostname;
+                    picked_num_cores = used_num_cores;
+                }
+                // No other host in this class can have a lower load
+                break;
+            }
         }
 
         // If none, then reply with an empty tuple
-        if (possible_hosts.empty()) {
-            // Host to avoid is the one with the lowest ram availability
+        if (picked_host.empty()) {
+            // Host to avoid is the one with the highest ram availability
             if (not new_host_to_avoid.empty()) {
                 hosts_to_avoid.insert(new_host_to_avoid);
             }
             return std::make_tuple(std::string(), 0);
         }
 
-        // Select the "best" host
-        double lowest_load = DBL_MAX;
-        std::string picked_host = "";
-        unsigned long picked_num_cores = 0;
-        for (auto const &h : possible_hosts) {
-            unsigned long num_running_threads = this->running_thread_counts[h];
-            unsigned long num_cores = std::get<0>(this->compute_resources[h]);
-            double flop_rate = S4U_Simulation::getHostFlopRate(h);
-            unsigned long used_num_cores;
-            if (required_num_cores == 0) {
-                used_num_cores = std::min(num_cores, task->getMaxNumCores()); // as many cores as possible
-            } else {
-                used_num_cores = required_num_cores;
-            }
-            // A totally heuristic load estimate
-            double load = ((double) ((num_running_threads + used_num_cores) / num_cores)) / flop_rate;
-            if (load < lowest_load) {
-                lowest_load = load;
-                picked_host = h;
-                picked_num_cores = used_num_cores;
-            }
-        }
         return std::make_tuple(picked_host, picked_num_cores);
 
     }
@@ -674,15 +812,14 @@ namespace wrench {
         // Don't kill me while I am doing this
         this->acquireDaemonLock();
 
-        std::set<std::shared_ptr<Workunit>> dispatched_wus_for_job;
-
         std::set<std::string> no_longer_considered_hosts;  // Due to a previously considered workunit not being
         // able to run on that host due to RAM, and because we don't
         // allow non-zero-ram tasks to jump ahead of other tasks
 
-        for (auto const &wu : this->ready_workunits) {
+        auto wu_it = this->ready_workunits.begin();
+        while (wu_it != this->ready_workunits.end()) {
 
-            std::string picked_host;
+            auto wu = *wu_it;
 
             StandardJob *job = wu->getJob();
             std::string target_host;
@@ -709,6 +846,7 @@ namespace wrench {
 
             // If we didn't find a host, forget it
             if (target_host.empty()) {
+                ++wu_it;
                 continue;
             }
 
@@ -737,33 +875,18 @@ namespace wrench {
             }
 
 
-            // Start a failure detector for this workunit executor (which will send me a message in case the
-            // work unit executor has died)
-            auto failure_detector = std::shared_ptr<ServiceTerminationDetector>(
-                    new ServiceTerminationDetector(this->hostname, workunit_executor, this->mailbox_name, true, false));
-            failure_detector->simulation = this->simulation;
-            failure_detector->start(failure_detector, true, false); // Daemonized, no auto-restart
+            // Monitor this workunit executor (so that I get a message in case it has died)
+            this->workunit_executor_monitor->monitor(workunit_executor);
 
             // Keep track of this workunit executor
             this->workunit_executors[job].insert(workunit_executor);
 
             // Update core and RAM availability
-            this->ram_availabilities[target_host] -= required_ram;
-            this->running_thread_counts[target_host] += target_num_cores;
+            this->updateRamAvailability(target_host, -required_ram);
+            this->updateRunningThreadCount(target_host, (long) target_num_cores);
 
-            dispatched_wus_for_job.insert(wu);
-        }
-
-        // Remove the WUs from the ready queue (this is inefficient, better data structs would help)
-        while (dispatched_wus_for_job.size() > 0) {
-            std::shared_ptr<Workunit> wu = *(dispatched_wus_for_job.begin());
-            for (auto it = this->ready_workunits.begin(); it != this->ready_workunits.end(); it++) {
-                if ((*it) == wu) {
-                    this->ready_workunits.erase(it);
-                    dispatched_wus_for_job.erase(wu);
-                    break;
-                }
-            }
+            // Remove the WU from the ready queue
+            wu_it = this->ready_workunits.erase(wu_it);
         }
 
         this->releaseDaemonLock();
@@ -781,10 +904,20 @@ namespace wrench {
 
         S4U_Simulation::computeZeroFlop();
 
-        // Wait for a message
+        // Process the analytical job events that are due (so that the dispatcher can use freed resources)
+        if (this->processAnalyticalEvents()) {
+            return true;
+        }
+
+        // Wait for a message, but no longer than until the next analytical job event
+        double timeout = -1;
+        if (not this->analytical_events.empty()) {
+            timeout = this->analytical_events.begin()->first - S4U_Simulation::getClock();
+        }
+
         std::shared_ptr<SimulationMessage> message;
         try {
-            message = S4U_Mailbox::getMessage(this->mailbox_name);
+            message = S4U_Mailbox::getMessage(this->mailbox_name, timeout);
         } catch (std::shared_ptr<NetworkError> &error) {
             WRENCH_INFO("Got a network error while getting some message... ignoring");
             return true;
@@ -795,9 +928,13 @@ namespace wrench {
             // Do nothing, just wake up
             return true;
         } else if (auto msg = std::dynamic_pointer_cast<HostHasChangedSpeedMessage>(message)) {
-            // Do nothing, just wake up
+            // Move the host to the right class in the host index, and wake up
+            this->indexHost(msg->hostname);
             return true;
         } else if (auto msg = std::dynamic_pointer_cast<HostHasTurnedOffMessage>(message)) {
+            // Analytical jobs have no work unit executor that would crash, so fail them here
+            this->failAnalyticalStandardJobsOnHost(msg->hostname);
+
             // If all hosts being off should not cause the service to terminate, then nevermind
             if (this->getPropertyValueAsString(
                     BareMetalComputeServiceProperty::TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN) == "false") {
@@ -843,6 +980,14 @@ namespace wrench {
             processGetResourceInformation(msg->answer_mailbox);
             return true;
 
+        } else if (auto msg = std::dynamic_pointer_cast<ComputeServiceResourceAvailabilitySubscriptionRequestMessage>(message)) {
+            processResourceAvailabilitySubscription(msg->answer_mailbox, msg->subscriber_mailbox);
+            return true;
+
+        } else if (auto msg = std::dynamic_pointer_cast<ComputeServiceResourceAvailabilityUnsubscriptionRequestMessage>(message)) {
+            this->resource_availability_subscriber_mailboxes.erase(msg->subscriber_mailbox);
+            return true;
+
         } else if (auto msg = std::dynamic_pointer_cast<ComputeServiceTerminateStandardJobRequestMessage>(message)) {
             processStandardJobTerminationRequest(msg->job, msg->answer_mailbox);
             return true;
@@ -921,14 +1066,20 @@ namespace wrench {
     void BareMetalComputeService::terminateRunningStandardJob(StandardJob *job,
                                                               BareMetalComputeService::JobTerminationCause termination_cause) {
 
+        /** Analytical jobs have no work unit executors */
+        if (this->analytical_task_executions.find(job) != this->analytical_task_executions.end()) {
+            this->terminateAnalyticalStandardJob(job, termination_cause);
+            return;
+        }
+
         /** Kill all relevant work unit executors */
         for (auto const &wue : this->workunit_executors[job]) {
             for (auto const &f : wue->getFilesStoredInScratch()) {
                 this->files_in_scratch[job].insert(f);
             }
             if (wue->workunit->task) {
-                this->ram_availabilities[wue->getHostname()] += wue->workunit->task->getMemoryRequirement();
-                this->running_thread_counts[wue->getHostname()] -= wue->getNumCores();
+                this->updateRamAvailability(wue->getHostname(), wue->workunit->task->getMemoryRequirement());
+                this->updateRunningThreadCount(wue->getHostname(), -((long) wue->getNumCores()));
             }
             wue->kill(termination_cause == BareMetalComputeService::JobTerminationCause::TERMINATED);
         }
@@ -939,20 +1090,11 @@ namespace wrench {
         S4U_Simulation::yield();
 
         /** Remove all relevant work units */
-        std::set<std::shared_ptr<Workunit>> to_remove;
-        for (auto const &wu : this->ready_workunits) {
-            if (wu->getJob() == job) {
-                to_remove.insert(wu);
-            }
-        }
-        // Really inefficient, Better data structures needed
-        while (not to_remove.empty()) {
-            for (auto it = this->ready_workunits.begin(); it != this->ready_workunits.end(); it++) {
-                if ((*it) == (*(to_remove.begin()))) {
-                    this->ready_workunits.erase(it);
-                    to_remove.erase(to_remove.begin());
-                    break;
-                }
+        for (auto it = this->ready_workunits.begin(); it != this->ready_workunits.end();) {
+            if ((*it)->getJob() == job) {
+                it = this->ready_workunits.erase(it);
+            } else {
+                ++it;
             }
         }
         this->completed_workunits[job].clear();
@@ -1025,6 +1167,9 @@ namespace wrench {
 
         this->setStateToDown();
 
+        // Subscribers will find out that the service is down when they next query their view
+        this->resource_availability_subscriber_mailboxes.clear();
+
         WRENCH_INFO("Failing current standard jobs");
         this->failCurrentStandardJobs();
 
@@ -1118,8 +1263,8 @@ namespace wrench {
         }
 
         // Update RAM availabilities and running thread counts
-        this->ram_availabilities[workunit_executor->getHostname()] += workunit_executor->getMemoryUtilization();
-        this->running_thread_counts[workunit_executor->getHostname()] -= workunit_executor->getNumCores();
+        this->updateRamAvailability(workunit_executor->getHostname(), workunit_executor->getMemoryUtilization());
+        this->updateRunningThreadCount(workunit_executor->getHostname(), -((long) workunit_executor->getNumCores()));
 
         // Forget the workunit executor
         forgetWorkunitExecutor(workunit_executor);
@@ -1153,7 +1298,7 @@ namespace wrench {
                     }
                 }
                 // Move the workunit to ready
-                this->ready_workunits.push_back(child);
+                this->ready_workunits.insert(child);
             }
         }
 
@@ -1217,8 +1362,8 @@ namespace wrench {
         }
         // Update RAM availabilities and running thread counts
         if (workunit->task) {
-            this->ram_availabilities[workunit_executor->getHostname()] += workunit->task->getMemoryRequirement();
-            this->running_thread_counts[workunit_executor->getHostname()] -= workunit_executor->getNumCores();
+            this->updateRamAvailability(workunit_executor->getHostname(), workunit->task->getMemoryRequirement());
+            this->updateRunningThreadCount(workunit_executor->getHostname(), -((long) workunit_executor->getNumCores()));
         }
         // Forget the workunit executor
         forgetWorkunitExecutor(workunit_executor);
@@ -1263,7 +1408,8 @@ namespace wrench {
                                                                        const std::string &answer_mailbox) {
 
         // If the job doesn't exit, we reply right away
-        if (this->all_workunits.find(job) == this->all_workunits.end()) {
+        if ((this->all_workunits.find(job) == this->all_workunits.end()) and
+            (this->analytical_task_executions.find(job) == this->analytical_task_executions.end())) {
             WRENCH_INFO("Trying to terminate a standard job that's not (no longer?) running!");
             std::string msg = "Job cannot be terminated because it is not running";
             ComputeServiceTerminateStandardJobAnswerMessage *answer_message = new ComputeServiceTerminateStandardJobAnswerMessage(
@@ -1411,13 +1557,16 @@ namespace wrench {
         }
 
         // We can now admit the job!
-        this->all_workunits.insert(std::make_pair(job, Workunit::createWorkunits(job)));
         this->job_run_specs.insert(std::make_pair(job, task_run_specs));
 
-        // Add the ready ones to the ready list
-        for (auto const &wu: this->all_workunits[job]) {
-            if (wu->num_pending_parents == 0) {
-                this->ready_workunits.push_back(wu);
+        // Unless the job is simulated analytically, create its work units and add the ready ones to the ready list
+        if (not (this->getPropertyValueAsBoolean(BareMetalComputeServiceProperty::SIMULATE_JOBS_ANALYTICALLY) and
+                 this->startAnalyticalStandardJob(job, task_run_specs))) {
+            this->all_workunits.insert(std::make_pair(job, Workunit::createWorkunits(job)));
+            for (auto const &wu: this->all_workunits[job]) {
+                if (wu->num_pending_parents == 0) {
+                    this->ready_workunits.insert(wu);
+                }
             }
         }
 
@@ -1438,6 +1587,238 @@ namespace wrench {
 
     }
 
+    /**
+     * @brief Start a standard job analytically: the allocations of all the job's tasks, and their
+     *        start and end dates, are computed right away, and turned into dated events that the
+     *        daemon processes as they come due (so that no actor is started for the job)
+     *
+     * @param job: the job
+     * @param task_run_specs: the job's task run specs (i.e., service-specific arguments)
+     * @return true if the job was started, false if some task could not be placed on a host
+     */
+    bool BareMetalComputeService::startAnalyticalStandardJob(
+            StandardJob *job, std::map<WorkflowTask *, std::tuple<std::string, unsigned long>> &task_run_specs) {
+
+        double io_bandwidth = this->getPropertyValueAsDouble(BareMetalComputeServiceProperty::ANALYTICAL_IO_BANDWIDTH);
+        double startup_overhead = this->getPropertyValueAsDouble(BareMetalComputeServiceProperty::TASK_STARTUP_OVERHEAD);
+
+        // Consider tasks by increasing top level, so that parents come before their children
+        std::vector<WorkflowTask *> tasks = job->getTasks();
+        std::stable_sort(tasks.begin(), tasks.end(), [](WorkflowTask *t1, WorkflowTask *t2) {
+            return t1->getTopLevel() < t2->getTopLevel();
+        });
+
+        // Place all tasks (counting the cores of the job's already placed tasks as used, so that
+        // the job's tasks are spread over hosts), but only reserve cores when tasks actually start
+        std::map<WorkflowTask *, AnalyticalTaskExecution> executions;
+        for (auto const &task : tasks) {
+            std::set<std::string> hosts_to_avoid;
+            auto allocation = this->pickAllocation(task, std::get<0>(task_run_specs[task]),
+                                                   std::get<1>(task_run_specs[task]), 0, hosts_to_avoid);
+            if (std::get<0>(allocation).empty()) {
+                for (auto const &e : executions) {
+                    this->updateRunningThreadCount(e.second.hostname, -((long) e.second.num_cores));
+                }
+                return false;
+            }
+            AnalyticalTaskExecution execution;
+            execution.hostname = std::get<0>(allocation);
+            execution.num_cores = std::get<1>(allocation);
+            execution.running = false;
+            this->updateRunningThreadCount(execution.hostname, (long) execution.num_cores);
+            executions[task] = execution;
+        }
+        for (auto const &e : executions) {
+            this->updateRunningThreadCount(e.second.hostname, -((long) e.second.num_cores));
+        }
+
+        // Pre file copies are done sequentially before any task starts
+        double tasks_start_date = S4U_Simulation::getClock();
+        for (auto const &fc : job->pre_file_copies) {
+            tasks_start_date += startup_overhead + std::get<0>(fc)->getSize() / io_bandwidth;
+        }
+
+        // Compute task dates, as a work unit executor would: read input, compute, write output
+        double job_end_date = tasks_start_date;
+        for (auto const &task : tasks) {
+            auto &execution = executions[task];
+
+            execution.start_date = tasks_start_date;
+            for (auto const &parent : task->getWorkflow()->getTaskParents(task)) {
+                auto parent_execution = executions.find(parent);
+                if (parent_execution != executions.end()) {
+                    execution.start_date = std::max<double>(execution.start_date, parent_execution->second.end_date);
+                }
+            }
+
+            double input_size = 0;
+            for (auto const &f : task->getInputFiles()) {
+                input_size += f->getSize();
+            }
+            double output_size = 0;
+            for (auto const &f : task->getOutputFiles()) {
+                output_size += f->getSize();
+            }
+
+            execution.read_input_end_date = execution.start_date + input_size / io_bandwidth;
+            execution.computation_end_date = execution.read_input_end_date +
+                                             (double) execution.num_cores * startup_overhead +
+                                             (task->getFlops() /
+                                              ((double) execution.num_cores * task->getParallelEfficiency())) /
+                                             S4U_Simulation::getHostFlopRate(execution.hostname);
+            execution.end_date = execution.computation_end_date + output_size / io_bandwidth;
+            job_end_date = std::max<double>(job_end_date, execution.end_date);
+
+            this->analytical_events.insert(std::make_pair(execution.start_date, std::make_tuple(ANALYTICAL_TASK_START, job, task)));
+            this->analytical_events.insert(std::make_pair(execution.end_date, std::make_tuple(ANALYTICAL_TASK_END, job, task)));
+        }
+
+        // Post file copies are done sequentially after all tasks have completed
+        for (auto const &fc : job->post_file_copies) {
+            job_end_date += std::get<0>(fc)->getSize() / io_bandwidth;
+        }
+        this->analytical_events.insert(std::make_pair(job_end_date, std::make_tuple(ANALYTICAL_JOB_END, job, (WorkflowTask *) nullptr)));
+
+        WRENCH_INFO("Simulating standard job %s analytically (expected completion date: %lf)",
+                    job->getName().c_str(), job_end_date);
+
+        this->analytical_task_executions[job] = std::move(executions);
+        return true;
+    }
+
+    /**
+     * @brief Process the analytical job events that are due
+     * @return true if some event was processed
+     */
+    bool BareMetalComputeService::processAnalyticalEvents() {
+        bool some_event_was_processed = false;
+        double now = S4U_Simulation::getClock();
+
+        while ((not this->analytical_events.empty()) and
+               (this->analytical_events.begin()->first <= now)) {
+            auto event = this->analytical_events.begin()->second;
+            this->analytical_events.erase(this->analytical_events.begin());
+            some_event_was_processed = true;
+
+            StandardJob *job = std::get<1>(event);
+            WorkflowTask *task = std::get<2>(event);
+
+            switch (std::get<0>(event)) {
+                case ANALYTICAL_TASK_START: {
+                    auto &execution = this->analytical_task_executions[job][task];
+                    execution.running = true;
+                    this->updateRunningThreadCount(execution.hostname, (long) execution.num_cores);
+                    task->setInternalState(WorkflowTask::InternalState::TASK_RUNNING);
+                    task->setStartDate(now);
+                    task->setExecutionHost(execution.hostname);
+                    task->setNumCoresAllocated(execution.num_cores);
+                    this->simulation->getOutput().addTimestampTaskStart(task);
+                    break;
+                }
+
+                case ANALYTICAL_TASK_END: {
+                    auto const &execution = this->analytical_task_executions[job][task];
+                    task->setReadInputStartDate(execution.start_date);
+                    task->setReadInputEndDate(execution.read_input_end_date);
+                    task->setComputationStartDate(execution.read_input_end_date);
+                    task->setComputationEndDate(execution.computation_end_date);
+                    task->setWriteOutputStartDate(execution.computation_end_date);
+                    task->setWriteOutputEndDate(now);
+                    task->setInternalState(WorkflowTask::InternalState::TASK_COMPLETED);
+                    task->setEndDate(now);
+                    this->simulation->getOutput().addTimestampTaskCompletion(task);
+
+                    for (auto child : task->getWorkflow()->getTaskChildren(task)) {
+                        if (child->getNumberOfNotCompletedParents() == 0) {
+                            child->setInternalState(WorkflowTask::InternalState::TASK_READY);
+                        }
+                    }
+
+                    job->incrementNumCompletedTasks();
+                    this->updateRunningThreadCount(execution.hostname, -((long) execution.num_cores));
+                    this->analytical_task_executions[job].erase(task);
+                    break;
+                }
+
+                case ANALYTICAL_JOB_END: {
+                    WRENCH_INFO("Analytically simulated standard job %s has completed", job->getName().c_str());
+                    this->analytical_task_executions.erase(job);
+                    this->job_run_specs.erase(job);
+                    this->running_jobs.erase(job);
+
+                    S4U_Mailbox::dputMessage(
+                            job->popCallbackMailbox(), new ComputeServiceStandardJobDoneMessage(
+                                    job, this->getSharedPtr<BareMetalComputeService>(), this->getMessagePayloadValue(
+                                            BareMetalComputeServiceMessagePayload::STANDARD_JOB_DONE_MESSAGE_PAYLOAD)));
+                    break;
+                }
+            }
+        }
+        return some_event_was_processed;
+    }
+
+    /**
+     * @brief Terminate a running analytical standard job
+     * @param job: the job
+     * @param termination_cause: the termination cause
+     */
+    void BareMetalComputeService::terminateAnalyticalStandardJob(StandardJob *job,
+                                                                 JobTerminationCause termination_cause) {
+
+        // Forget the job's pending events
+        for (auto it = this->analytical_events.begin(); it != this->analytical_events.end();) {
+            if (std::get<1>(it->second) == job) {
+                it = this->analytical_events.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        // Release the cores of running tasks, and make them ready again
+        double now = S4U_Simulation::getClock();
+        for (auto const &e : this->analytical_task_executions[job]) {
+            WorkflowTask *task = e.first;
+            if (e.second.running) {
+                this->updateRunningThreadCount(e.second.hostname, -((long) e.second.num_cores));
+                if (termination_cause == BareMetalComputeService::JobTerminationCause::TERMINATED) {
+                    task->setTerminationDate(now);
+                    this->simulation->getOutput().addTimestampTaskTermination(task);
+                } else {
+                    task->setFailureDate(now);
+                    this->simulation->getOutput().addTimestampTaskFailure(task);
+                }
+                task->setInternalState(WorkflowTask::InternalState::TASK_READY);
+            }
+        }
+        this->analytical_task_executions.erase(job);
+    }
+
+    /**
+     * @brief Fail the running analytical standard jobs that have tasks that have not completed
+     *        on a host that has turned off
+     * @param hostname: the host's name
+     */
+    void BareMetalComputeService::failAnalyticalStandardJobsOnHost(const std::string &hostname) {
+
+        std::vector<StandardJob *> jobs_to_fail;
+        for (auto const &j : this->analytical_task_executions) {
+            for (auto const &e : j.second) {
+                if (e.second.hostname == hostname) {
+                    jobs_to_fail.push_back(j.first);
+                    break;
+                }
+            }
+        }
+
+        for (auto const &job : jobs_to_fail) {
+            WRENCH_INFO("Analytically simulated standard job %s has tasks on host %s, which has turned off",
+                        job->getName().c_str(), hostname.c_str());
+            this->failRunningStandardJob(job, std::shared_ptr<FailureCause>(new HostError(hostname)));
+            this->job_run_specs.erase(job);
+            this->running_jobs.erase(job);
+        }
+    }
+
 /**
  * @brief Process a submit pilot job request
  *
@@ -1537,6 +1918,69 @@ namespace wrench {
         S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
     }
 
+    /**
+     * @brief Process a resource availability subscription request
+     *
+     * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param subscriber_mailbox: the mailbox to which resource availability changes should be pushed
+     */
+    void BareMetalComputeService::processResourceAvailabilitySubscription(const std::string &answer_mailbox,
+                                                                          const std::string &subscriber_mailbox) {
+
+        // Push pending changes to current subscribers, so that the new subscriber
+        // only receives changes that happen after the current state
+        this->pushResourceAvailabilityUpdates();
+
+        this->resource_availability_subscriber_mailboxes.insert(subscriber_mailbox);
+
+        std::map<std::string, unsigned long> num_idle_cores;
+        for (auto const &r : this->running_thread_counts) {
+            num_idle_cores.insert(std::make_pair(r.first, this->getNumIdleCores(r.first)));
+        }
+
+        S4U_Mailbox::dputMessage(
+                answer_mailbox,
+                new ComputeServiceResourceAvailabilitySubscriptionAnswerMessage(
+                        num_idle_cores, this->ram_availabilities,
+                        this->getMessagePayloadValue(
+                                ComputeServiceMessagePayload::RESOURCE_AVAILABILITY_SUBSCRIPTION_ANSWER_MESSAGE_PAYLOAD)));
+    }
+
+    /**
+     * @brief Push the resource availability changes that have happened since the previous push
+     *        (if any) to subscribers, as a single message per subscriber
+     */
+    void BareMetalComputeService::pushResourceAvailabilityUpdates() {
+
+        std::map<std::string, long> num_idle_cores_deltas;
+        for (auto const &d : this->pending_num_idle_cores_deltas) {
+            if (d.second != 0) {
+                num_idle_cores_deltas.insert(d);
+            }
+        }
+        std::map<std::string, double> available_ram_deltas;
+        for (auto const &d : this->pending_available_ram_deltas) {
+            if (d.second != 0) {
+                available_ram_deltas.insert(d);
+            }
+        }
+        this->pending_num_idle_cores_deltas.clear();
+        this->pending_available_ram_deltas.clear();
+
+        if (num_idle_cores_deltas.empty() and available_ram_deltas.empty()) {
+            return;
+        }
+
+        for (auto const &subscriber_mailbox : this->resource_availability_subscriber_mailboxes) {
+            S4U_Mailbox::dputMessage(
+                    subscriber_mailbox,
+                    new ComputeServiceResourceAvailabilityUpdateMessage(
+                            num_idle_cores_deltas, available_ram_deltas,
+                            this->getMessagePayloadValue(
+                                    ComputeServiceMessagePayload::RESOURCE_AVAILABILITY_UPDATE_MESSAGE_PAYLOAD)));
+        }
+    }
+
 /**
  * @brief Cleans up the scratch as I am a pilot job and I to need clean the files stored by the standard jobs
  *        executed inside me
@@ -1581,6 +2025,21 @@ namespace wrench {
                                                 BareMetalComputeServiceProperty::TASK_STARTUP_OVERHEAD));
         }
 
+        // Analytical I/O bandwidth
+        double analytical_io_bandwidth = 0;
+        try {
+            analytical_io_bandwidth = this->getPropertyValueAsDouble(
+                    BareMetalComputeServiceProperty::ANALYTICAL_IO_BANDWIDTH);
+        } catch (std::invalid_argument &e) {
+            success = false;
+        }
+
+        if ((!success) or (analytical_io_bandwidth <= 0)) {
+            throw std::invalid_argument("Invalid ANALYTICAL_IO_BANDWIDTH property specification: " +
+                                        this->getPropertyValueAsString(
+                                                BareMetalComputeServiceProperty::ANALYTICAL_IO_BANDWIDTH));
+        }
+
         // Supporting Pilot jobs
         if (this->getPropertyValueAsBoolean(BareMetalComputeServiceProperty::SUPPORTS_PILOT_JOBS)) {
             throw std::invalid_argument(
@@ -1600,6 +2059,54 @@ namespace wrench {
                 "BareMetalComputeService::terminatePilotJob(): not implemented because BareMetalComputeService never supports pilot jobs");
     }
 
+    /**
+     * @brief Subscribe to the resource availability of the service, so as to obtain a local view
+     *        of the numbers of idle cores and of the available RAM of its hosts, which the service
+     *        keeps up to date by pushing changes (so that queries on the view do not require
+     *        a round-trip to the service)
+     *
+     * @return a resource availability subscription
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    std::shared_ptr<ResourceAvailabilitySubscription> BareMetalComputeService::subscribeToResourceAvailability() {
+
+        assertServiceIsUp();
+
+        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("subscribe_to_resource_availability");
+        std::string subscriber_mailbox = S4U_Mailbox::generateUniqueMailboxName("resource_availability_updates");
+
+        try {
+            S4U_Mailbox::putMessage(
+                    this->mailbox_name,
+                    new ComputeServiceResourceAvailabilitySubscriptionRequestMessage(
+                            answer_mailbox, subscriber_mailbox,
+                            this->getMessagePayloadValue(
+                                    ComputeServiceMessagePayload::RESOURCE_AVAILABILITY_SUBSCRIPTION_REQUEST_MESSAGE_PAYLOAD)));
+        } catch (std::shared_ptr<NetworkError> &cause) {
+            throw WorkflowExecutionException(cause);
+        }
+
+        // Get the reply
+        std::shared_ptr<SimulationMessage> message = nullptr;
+        try {
+            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        } catch (std::shared_ptr<NetworkError> &cause) {
+            throw WorkflowExecutionException(cause);
+        }
+
+        if (auto msg = std::dynamic_pointer_cast<ComputeServiceResourceAvailabilitySubscriptionAnswerMessage>(message)) {
+            return std::shared_ptr<ResourceAvailabilitySubscription>(
+                    new ResourceAvailabilitySubscription(this->getSharedPtr<ComputeService>(), subscriber_mailbox,
+                                                         msg->num_idle_cores, msg->available_ram));
+        } else {
+            throw std::runtime_error(
+                    "BareMetalComputeService::subscribeToResourceAvailability(): Unexpected [" +
+                    message->getName() + "] message");
+        }
+    }
+
 
     /**
      * @brief Process a crash of a WorkunitExecutor (although some work may has been done, we'll just
@@ -1622,8 +2129,8 @@ namespace wrench {
 
         // Update RAM availabilities and running thread counts
         if (workunit->task) {
-            this->ram_availabilities[workunit_executor->getHostname()] += workunit->task->getMemoryRequirement();
-            this->running_thread_counts[workunit_executor->getHostname()] -= workunit_executor->getNumCores();
+            this->updateRamAvailability(workunit_executor->getHostname(), workunit->task->getMemoryRequirement());
+            this->updateRunningThreadCount(workunit_executor->getHostname(), -((long) workunit_executor->getNumCores()));
         }
 
         // Forget the workunit executor
@@ -1633,7 +2140,7 @@ namespace wrench {
         workunit->task->setInternalState(WorkflowTask::InternalState::TASK_READY);
         // Put the WorkUnit back in the ready list (at the end)
         WRENCH_INFO("Putting task back in the ready queue");
-        this->ready_workunits.push_back(workunit);
+        this->ready_workunits.insert(workunit);
     }
 
     /**
@@ -14,6 +14,8 @@ namespace wrench {
 
     SET_PROPERTY_NAME(BareMetalComputeServiceProperty, TASK_STARTUP_OVERHEAD);
     SET_PROPERTY_NAME(BareMetalComputeServiceProperty, TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN);
+    SET_PROPERTY_NAME(BareMetalComputeServiceProperty, SIMULATE_JOBS_ANALYTICALLY);
+    SET_PROPERTY_NAME(BareMetalComputeServiceProperty, ANALYTICAL_IO_BANDWIDTH);
 
 };
 
@@ -147,38 +147,27 @@ namespace wrench {
         this->num_cores_per_node = this->nodes_to_cores_map.begin()->second;
         this->total_num_of_nodes = compute_hosts.size();
 
-        // Check that the workload file is valid
-        std::string workload_file = this->getPropertyValueAsString(
+        // Check that the workload file is valid (jobs are only read, lazily, once the
+        // replayer runs; they are not kept in memory here)
+        this->workload_trace_file = this->getPropertyValueAsString(
                 BatchComputeServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE);
-        if (not workload_file.empty()) {
+        if (not this->workload_trace_file.empty()) {
             try {
-
-                this->workload_trace = TraceFileLoader::loadFromTraceFile(workload_file,
-                                                                          this->getPropertyValueAsBoolean(BatchComputeServiceProperty::IGNORE_INVALID_JOBS_IN_WORKLOAD_TRACE_FILE),
-                                                                          this->getPropertyValueAsDouble(BatchComputeServiceProperty::SUBMIT_TIME_OF_FIRST_JOB_IN_WORKLOAD_TRACE_FILE));
+                this->workload_trace_num_jobs = TraceFileLoader::checkTraceFile(this->workload_trace_file,
+                                                                                this->getPropertyValueAsBoolean(BatchComputeServiceProperty::IGNORE_INVALID_JOBS_IN_WORKLOAD_TRACE_FILE),
+                                                                                this->getPropertyValueAsDouble(BatchComputeServiceProperty::SUBMIT_TIME_OF_FIRST_JOB_IN_WORKLOAD_TRACE_FILE),
+                                                                                this->getPropertyValueAsUnsignedLong(BatchComputeServiceProperty::WORKLOAD_TRACE_FILE_LOADING_THREADS));
             } catch (std::exception &e) {
                 throw;
             }
-            // Fix value
-            for (auto &j : this->workload_trace) {
-                std::string id = std::get<0>(j);
-                double submit_time = std::get<1>(j);
-                double flops = std::get<2>(j);
-                double requested_flops = std::get<3>(j);
-                double requested_ram = std::get<4>(j);
-                unsigned int num_nodes = std::get<5>(j);
-
-                // Capping to max number of nodes, silently
-                if (num_nodes > this->total_num_of_nodes) {
-                    std::get<5>(j) = this->total_num_of_nodes;
-                }
-                // Capping to ram, silently
-                if (requested_ram > ram_available) {
-                    std::get<4>(j) = ram_available;
-                }
-            }
         }
 
+        // Create the job log (which creates the output files, if any)
+        this->job_log = std::unique_ptr<BatchJobLog>(new BatchJobLog(
+                this->compute_hosts, this->num_cores_per_node,
+                this->getPropertyValueAsString(BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG),
+                this->getPropertyValueAsString(BatchComputeServiceProperty::OUTPUT_BINARY_JOB_LOG)));
+
         // Create a scheduler
 #ifdef ENABLE_BATSCHED
         this->scheduler = std::unique_ptr<BatchScheduler>(new BatschedBatchScheduler(this));
@@ -201,6 +190,16 @@ namespace wrench {
 
     }
 
+    /**
+     * @brief Get the log of the jobs that have left the service (completed, failed, or terminated),
+     *        along with aggregate metrics
+     *
+     * @return a job log
+     */
+    const BatchJobLog &BatchComputeService::getJobLog() {
+        return *(this->job_log);
+    }
+
     /**
      * @brief Retrieve start time estimates for a set of job configurations
      *
@@ -508,7 +507,7 @@ namespace wrench {
         this->scheduler->launch();
 
         // Start the workload trace replayer if needed
-        if (not this->workload_trace.empty()) {
+        if (this->workload_trace_num_jobs > 0) {
             try {
                 startBackgroundWorkloadProcess();
             } catch (std::runtime_error &e) {
@@ -553,6 +552,9 @@ namespace wrench {
         }
 
         this->scheduler->processJobFailure(batch_job);
+        if (batch_job != nullptr) {
+            this->job_log->recordJob(batch_job, BatchJobLog::FAILED, S4U_Simulation::getClock());
+        }
 
         try {
             S4U_Mailbox::putMessage(job->popCallbackMailbox(),
@@ -598,6 +600,11 @@ namespace wrench {
             return;
         }
 
+        if (job->isBackgroundJob()) {
+            this->all_jobs.erase(job);
+            return;
+        }
+
         for (auto const &j: this->all_jobs) {
             if (j->getWorkflowJob() == job->getWorkflowJob()) {
                 this->all_jobs.erase(j);
@@ -707,7 +714,7 @@ namespace wrench {
             std::vector<std::shared_ptr<BatchJob>> to_erase;
             for (auto const &j : this->running_jobs) {
                 WorkflowJob *workflow_job = j->getWorkflowJob();
-                if (workflow_job->getType() == WorkflowJob::STANDARD) {
+                if ((workflow_job != nullptr) and (workflow_job->getType() == WorkflowJob::STANDARD)) {
                     auto *job = (StandardJob *) workflow_job;
                     terminateRunningStandardJob(job);
                     this->sendStandardJobFailureNotification(job, std::to_string(j->getJobID()),
@@ -730,7 +737,7 @@ namespace wrench {
 
             for (auto it1 = this->batch_queue.begin(); it1 != this->batch_queue.end(); it1++) {
                 WorkflowJob *workflow_job = (*it1)->getWorkflowJob();
-                if (workflow_job->getType() == WorkflowJob::STANDARD) {
+                if ((workflow_job != nullptr) and (workflow_job->getType() == WorkflowJob::STANDARD)) {
                     to_erase.push_back(it1);
                     auto *job = (StandardJob *) workflow_job;
                     this->sendStandardJobFailureNotification(job, std::to_string((*it1)->getJobID()),
@@ -751,7 +758,7 @@ namespace wrench {
 
             for (auto const &wj : this->waiting_jobs) {
                 WorkflowJob *workflow_job = wj->getWorkflowJob();
-                if (workflow_job->getType() == WorkflowJob::STANDARD) {
+                if ((workflow_job != nullptr) and (workflow_job->getType() == WorkflowJob::STANDARD)) {
                     to_erase.push_back(wj);
                     auto *job = (StandardJob *) workflow_job;
                     this->sendStandardJobFailureNotification(job, std::to_string(wj->getJobID()),
@@ -799,7 +806,7 @@ namespace wrench {
 
             // Stopping services
             for (auto &job : this->running_jobs) {
-                if ((job)->getWorkflowJob()->getType() == WorkflowJob::PILOT) {
+                if ((not job->isBackgroundJob()) and ((job)->getWorkflowJob()->getType() == WorkflowJob::PILOT)) {
                     auto p_job = (PilotJob *) ((job)->getWorkflowJob());
                     auto cs = p_job->getComputeService();
                     if (cs == nullptr) {
@@ -817,6 +824,7 @@ namespace wrench {
 
             // Cleaning up data structures
             for (auto &job : to_erase) {
+                this->job_log->recordJob(job, BatchJobLog::TERMINATED, S4U_Simulation::getClock());
                 this->running_jobs.erase(job);
                 this->removeBatchJobFromJobsList(job);
             }
@@ -834,11 +842,21 @@ namespace wrench {
 
         S4U_Simulation::computeZeroFlop();
 
-        // Wait for a message
+        // Complete background jobs that are done (so that the scheduler can use their resources)
+        if (this->processBackgroundJobCompletions()) {
+            return true;
+        }
+
+        // Wait for a message, but no longer than until the next background job completion
+        double timeout = -1;
+        if (not this->background_job_end_dates.empty()) {
+            timeout = this->background_job_end_dates.begin()->first - S4U_Simulation::getClock();
+        }
+
         std::shared_ptr<SimulationMessage> message = nullptr;
 
         try {
-            message = S4U_Mailbox::getMessage(this->mailbox_name);
+            message = S4U_Mailbox::getMessage(this->mailbox_name, timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             return true;
         }
@@ -919,6 +937,23 @@ namespace wrench {
 
         WRENCH_INFO("Asked to run a batch job with id %ld", job->getJobID());
 
+        // Background jobs get no answer, and are dropped if they can never run
+        if (job->isBackgroundJob()) {
+            if ((job->getRequestedNumNodes() > this->total_num_of_nodes) or
+                (job->getRequestedCoresPerNode() > this->num_cores_per_node) or
+                (job->getMemoryRequirement() >
+                 Simulation::getHostMemoryCapacity(this->available_nodes_to_cores.begin()->first))) {
+                WRENCH_INFO("Background batch job %ld can never run... ignoring", job->getJobID());
+                return;
+            }
+            job->setRequestedTime(job->getRequestedTime() +
+                                  this->getPropertyValueAsUnsignedLong(BatchComputeServiceProperty::BATCH_RJMS_PADDING_DELAY));
+            this->all_jobs.insert(job);
+            this->batch_queue.push_back(job);
+            this->scheduler->processJobSubmission(job);
+            return;
+        }
+
         // Check whether the job type is supported
         if ((job->getWorkflowJob()->getType() == WorkflowJob::STANDARD) and
             (not getPropertyValueAsBoolean(BatchComputeServiceProperty::SUPPORTS_STANDARD_JOBS))) {
@@ -1058,12 +1093,13 @@ namespace wrench {
         this->removeJobFromRunningList(batch_job);
         this->freeUpResources(batch_job->getResourcesAllocated());
         if (this->pilot_job_alarms[job->getName()] != nullptr) {
-            this->pilot_job_alarms[job->getName()]->kill();
+            this->pilot_job_alarms[job->getName()]->cancel();
             this->pilot_job_alarms.erase(job->getName());
         }
 
         // Let the scheduler know about the job completion
         this->scheduler->processJobCompletion(batch_job);
+        this->job_log->recordJob(batch_job, BatchJobLog::COMPLETED, S4U_Simulation::getClock());
 
         // Forward the notification
         try {
@@ -1093,6 +1129,7 @@ namespace wrench {
 
                 // notify scheduler of job termination
                 this->scheduler->processJobTermination(*it);
+                this->job_log->recordJob(*it, BatchJobLog::TERMINATED, S4U_Simulation::getClock());
 
                 std::shared_ptr<BatchJob> to_erase = *it;
                 this->batch_queue.erase(it);
@@ -1110,6 +1147,7 @@ namespace wrench {
                 S4U_Mailbox::dputMessage(answer_mailbox, answer_message);
                 // forward this notification to batsched
                 this->scheduler->processJobTermination(*it2);
+                this->job_log->recordJob(*it2, BatchJobLog::TERMINATED, S4U_Simulation::getClock());
                 auto to_erase = *it2;
                 this->waiting_jobs.erase(it2);
                 this->removeBatchJobFromJobsList(to_erase);
@@ -1133,6 +1171,7 @@ namespace wrench {
 
 
                 this->scheduler->processJobTermination(*it1);
+                this->job_log->recordJob(*it1, BatchJobLog::TERMINATED, S4U_Simulation::getClock());
 
                 //this is the list of unique pointers
                 auto to_erase = *it1;
@@ -1173,7 +1212,7 @@ namespace wrench {
                 PointerUtil::moveSharedPtrFromSetToSet(it, &(this->running_standard_job_executors),
                                                        &(this->finished_standard_job_executors));
                 executor_on_the_list = true;
-                this->standard_job_alarms[job->getName()]->kill();
+                this->standard_job_alarms[job->getName()]->cancel();
                 this->standard_job_alarms.erase(job->getName());
                 break;
             }
@@ -1223,6 +1262,7 @@ namespace wrench {
 //        }
         // notify the scheduled of the job completion
         this->scheduler->processJobCompletion(batch_job);
+        this->job_log->recordJob(batch_job, BatchJobLog::COMPLETED, S4U_Simulation::getClock());
 
         // Send the callback to the originator
         S4U_Mailbox::dputMessage(job->popCallbackMailbox(),
@@ -1239,6 +1279,39 @@ namespace wrench {
     }
 
 
+    /**
+     * @brief Process the completions of all background jobs whose end date has been reached
+     * @return true if at least one background job has completed, false otherwise
+     */
+    bool BatchComputeService::processBackgroundJobCompletions() {
+        bool some_job_completed = false;
+        double now = S4U_Simulation::getClock();
+
+        while ((not this->background_job_end_dates.empty()) and
+               (this->background_job_end_dates.begin()->first <= now)) {
+            auto batch_job = this->background_job_end_dates.begin()->second;
+            this->background_job_end_dates.erase(this->background_job_end_dates.begin());
+
+            WRENCH_INFO("Background batch job %ld has completed", batch_job->getJobID());
+
+            this->freeUpResources(batch_job->getResourcesAllocated());
+            this->removeJobFromRunningList(batch_job);
+
+            // A background job that runs longer than its requested time is a time out
+            if (batch_job->getBackgroundJobRuntime() > (double) batch_job->getRequestedTime()) {
+                this->scheduler->processJobFailure(batch_job);
+                this->job_log->recordJob(batch_job, BatchJobLog::FAILED, now);
+            } else {
+                this->scheduler->processJobCompletion(batch_job);
+                this->job_log->recordJob(batch_job, BatchJobLog::COMPLETED, now);
+            }
+
+            this->removeBatchJobFromJobsList(batch_job);
+            some_job_completed = true;
+        }
+        return some_job_completed;
+    }
+
     /**
      * @brief Helper function to remove a job from the batch queue
      * @param job: the job to remove
@@ -1270,7 +1343,7 @@ namespace wrench {
                 PointerUtil::moveSharedPtrFromSetToSet(it, &(this->running_standard_job_executors),
                                                        &(this->finished_standard_job_executors));
                 executor_on_the_list = true;
-                this->standard_job_alarms[job->getName()]->kill();
+                this->standard_job_alarms[job->getName()]->cancel();
                 this->standard_job_alarms.erase(job->getName());
                 break;
             }
@@ -1335,6 +1408,19 @@ namespace wrench {
                                   unsigned long allocated_time,
                                   unsigned long cores_per_node_asked_for) {
 
+        // A background job simply holds its resources until its end date (no executor is created)
+        if (batch_job->isBackgroundJob()) {
+            WRENCH_INFO("Starting background batch job %ld on %ld nodes with %ld cores per node",
+                        batch_job->getJobID(), num_nodes_allocated, cores_per_node_asked_for);
+            batch_job->setBeginTimestamp(S4U_Simulation::getClock());
+            batch_job->setEndingTimestamp(S4U_Simulation::getClock() + (double) allocated_time);
+            this->timeslots.push_back(batch_job->getEndingTimestamp());
+            batch_job->setAllocatedResources(resources);
+            double end_date = S4U_Simulation::getClock() +
+                              std::min<double>(batch_job->getBackgroundJobRuntime(), (double) allocated_time);
+            this->background_job_end_dates.insert(std::make_pair(end_date, batch_job));
+            return;
+        }
 
         switch (workflow_job->getType()) {
             case WorkflowJob::STANDARD: {
@@ -1376,12 +1462,9 @@ namespace wrench {
                 SimulationMessage *msg =
                         new AlarmJobTimeOutMessage(batch_job, 0);
 
-                std::shared_ptr<Alarm> alarm_ptr = Alarm::createAndStartAlarm(this->simulation,
-                                                                              batch_job->getEndingTimestamp(),
-                                                                              this->hostname,
-                                                                              this->mailbox_name, msg,
-                                                                              "batch_standard");
-                standard_job_alarms[job->getName()] = alarm_ptr;
+                std::shared_ptr<Timer> timer = this->simulation->getTimerService(this->hostname)->setTimer(
+                        batch_job->getEndingTimestamp(), this->mailbox_name, msg);
+                standard_job_alarms[job->getName()] = timer;
 
 
                 return;
@@ -1442,13 +1525,10 @@ namespace wrench {
                 SimulationMessage *msg =
                         new AlarmJobTimeOutMessage(batch_job, 0);
 
-                std::shared_ptr<Alarm> alarm_ptr = Alarm::createAndStartAlarm(this->simulation,
-                                                                              batch_job->getEndingTimestamp(),
-                                                                              host_to_run_on,
-                                                                              this->mailbox_name, msg,
-                                                                              "batch_pilot");
+                std::shared_ptr<Timer> timer = this->simulation->getTimerService(host_to_run_on)->setTimer(
+                        batch_job->getEndingTimestamp(), this->mailbox_name, msg);
 
-                this->pilot_job_alarms[job->getName()] = alarm_ptr;
+                this->pilot_job_alarms[job->getName()] = timer;
 
                 return;
             }
@@ -1526,11 +1606,23 @@ namespace wrench {
  * @throw std::runtime_error
  */
     void BatchComputeService::startBackgroundWorkloadProcess() {
-        if (this->workload_trace.empty()) {
+        if (this->workload_trace_num_jobs == 0) {
             throw std::runtime_error(
                     "BatchComputeService::startBackgroundWorkloadProcess(): no workload trace file specified");
         }
 
+        // Create the reader from which the replayer will pull jobs
+        std::shared_ptr<TraceFileReader> workload_trace_reader;
+        try {
+            workload_trace_reader = std::make_shared<TraceFileReader>(
+                    this->workload_trace_file,
+                    this->getPropertyValueAsBoolean(BatchComputeServiceProperty::IGNORE_INVALID_JOBS_IN_WORKLOAD_TRACE_FILE),
+                    this->getPropertyValueAsDouble(BatchComputeServiceProperty::SUBMIT_TIME_OF_FIRST_JOB_IN_WORKLOAD_TRACE_FILE));
+        } catch (std::invalid_argument &e) {
+            throw std::runtime_error(
+                    "BatchComputeService::startBackgroundWorkloadProcess(): cannot read workload trace file: " + std::string(e.what()));
+        }
+
         // Create the trace replayer process
         this->workload_trace_replayer = std::shared_ptr<WorkloadTraceFileReplayer>(
                 new WorkloadTraceFileReplayer(S4U_Simulation::getHostName(),
@@ -1538,7 +1630,7 @@ namespace wrench {
                                               this->num_cores_per_node,
                                               this->getPropertyValueAsBoolean(
                                                       BatchComputeServiceProperty::USE_REAL_RUNTIMES_AS_REQUESTED_RUNTIMES_IN_WORKLOAD_TRACE_FILE),
-                                              this->workload_trace)
+                                              workload_trace_reader)
         );
         try {
             this->workload_trace_replayer->simulation = this->simulation;
@@ -1565,7 +1657,7 @@ namespace wrench {
         bool is_running = false;
         for (auto const &j : this->running_jobs) {
             auto workflow_job = j->getWorkflowJob();
-            if ((workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *) workflow_job == job)) {
+            if ((workflow_job != nullptr) and (workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *) workflow_job == job)) {
                 batch_job = j;
                 is_running = true;
             }
@@ -1577,7 +1669,7 @@ namespace wrench {
             // Is it pending?
             for (auto it1 = this->batch_queue.begin(); it1 != this->batch_queue.end(); it1++) {
                 WorkflowJob *workflow_job = (*it1)->getWorkflowJob();
-                if ((workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *) workflow_job == job)) {
+                if ((workflow_job != nullptr) and (workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *) workflow_job == job)) {
                     batch_pending_it = it1;
                     is_pending = true;
                 }
@@ -1590,7 +1682,7 @@ namespace wrench {
             // Is it waiting?
             for (auto const &j : this->waiting_jobs) {
                 WorkflowJob *workflow_job = j->getWorkflowJob();
-                if ((workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *) workflow_job == job)) {
+                if ((workflow_job != nullptr) and (workflow_job->getType() == WorkflowJob::STANDARD) and ((StandardJob *) workflow_job == job)) {
                     batch_job = j;
                     is_waiting = true;
                 }
@@ -1613,6 +1705,8 @@ namespace wrench {
 
         // Notify the scheduler of the failuire
         this->scheduler->processJobFailure(batch_job);
+        this->job_log->recordJob(is_pending ? *batch_pending_it : batch_job, BatchJobLog::TERMINATED,
+                                 S4U_Simulation::getClock());
 
         // Is it running?
         if (is_running) {
@@ -1698,7 +1792,7 @@ namespace wrench {
                 break;
             }
         }
-        if (workflow_job == nullptr) {
+        if (batch_job == nullptr) {
             //throw std::runtime_error("BatchComputeService::processExecuteJobFromBatSched(): Job received from batsched that does not belong to the list of jobs batchservice has");
             WRENCH_WARN("BatchComputeService::processExecuteJobFromBatSched(): Job received from batsched that does not belong to the list of known jobs... ignoring (Batsched seems to send this back even when a job has been actively terminated)");
             return;
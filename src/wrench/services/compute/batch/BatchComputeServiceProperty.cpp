@@ -23,8 +23,10 @@ namespace wrench {
     SET_PROPERTY_NAME(BatchComputeServiceProperty, USE_REAL_RUNTIMES_AS_REQUESTED_RUNTIMES_IN_WORKLOAD_TRACE_FILE);
     SET_PROPERTY_NAME(BatchComputeServiceProperty, SUBMIT_TIME_OF_FIRST_JOB_IN_WORKLOAD_TRACE_FILE);
     SET_PROPERTY_NAME(BatchComputeServiceProperty, IGNORE_INVALID_JOBS_IN_WORKLOAD_TRACE_FILE);
+    SET_PROPERTY_NAME(BatchComputeServiceProperty, WORKLOAD_TRACE_FILE_LOADING_THREADS);
 
     SET_PROPERTY_NAME(BatchComputeServiceProperty, OUTPUT_CSV_JOB_LOG);
+    SET_PROPERTY_NAME(BatchComputeServiceProperty, OUTPUT_BINARY_JOB_LOG);
 
     SET_PROPERTY_NAME(BatchComputeServiceProperty, SIMULATE_COMPUTATION_AS_SLEEP);
 
@@ -50,6 +50,61 @@ namespace wrench {
         this->csv_metadata = "color:red";
     }
 
+    /**
+     * @brief Constructor for a background job, i.e., a job that is not associated to any workflow
+     *        job and that merely occupies its allocated resources for some time (as used for replaying
+     *        workload traces)
+     *
+     * @param job_id: the batch job id
+     * @param time_in_minutes: the requested execution time in minutes
+     * @param num_nodes: the requested number of compute nodes (hosts)
+     * @param cores_per_node: the requested number of cores per node
+     * @param runtime: the time (in seconds) for which the job occupies its resources once started
+     * @param memory_requirement: the job's RAM requirement per node (in bytes)
+     * @param arrival_time_stamp: the job's arrival date
+     */
+    BatchJob::BatchJob(unsigned long job_id, unsigned long time_in_minutes, unsigned long num_nodes,
+                       unsigned long cores_per_node, double runtime, double memory_requirement,
+                       double arrival_time_stamp) {
+        if (job_id <= 0 || num_nodes == 0 || cores_per_node == 0 || runtime < 0 || memory_requirement < 0) {
+            throw std::invalid_argument(
+                    "BatchJob::BatchJob(): either jobid (" + std::to_string(job_id) +
+                    "), num_nodes (" + std::to_string(num_nodes) +
+                    "), cores_per_node (" + std::to_string(cores_per_node) +
+                    "), runtime (" + std::to_string(runtime) +
+                    ") or memory_requirement (" + std::to_string(memory_requirement) +
+                    ") is invalid"
+            );
+        }
+        this->job = nullptr;
+        this->job_id = job_id;
+        this->requested_time = time_in_minutes * 60;
+        this->requested_num_nodes = num_nodes;
+        this->requested_cores_per_node = cores_per_node;
+        this->ending_time_stamp = -1;
+        this->arrival_time_stamp = arrival_time_stamp;
+        this->background_job_runtime = runtime;
+        this->background_job_memory_requirement = memory_requirement;
+
+        this->csv_metadata = "color:green";
+    }
+
+    /**
+     * @brief Determine whether this batch job is a background job (i.e., has no workflow job)
+     * @return true or false
+     */
+    bool BatchJob::isBackgroundJob() {
+        return this->job == nullptr;
+    }
+
+    /**
+     * @brief Get the runtime of a background job
+     * @return a time in seconds (-1 if this is not a background job)
+     */
+    double BatchJob::getBackgroundJobRuntime() {
+        return this->background_job_runtime;
+    }
+
     /**
      * @brief Get the requested number of cores per node
      * @return a number of cores
@@ -80,6 +135,9 @@ namespace wrench {
      */
     double BatchJob::getMemoryRequirement() {
         WorkflowJob *workflow_job = this->job;
+        if (workflow_job == nullptr) {
+            return this->background_job_memory_requirement;
+        }
         double memory_requirement = 0.0;
         if (workflow_job->getType() == WorkflowJob::STANDARD) {
             auto standard_job = (StandardJob *) workflow_job;
@@ -102,7 +160,7 @@ namespace wrench {
 
     /**
      * @brief Get the workflow job corresponding to this batch job
-     * @return a workflow job
+     * @return a workflow job (nullptr for a background job)
      */
     WorkflowJob *BatchJob::getWorkflowJob() {
         return this->job;
@@ -0,0 +1,373 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "wrench/services/compute/batch/BatchJobLog.h"
+
+namespace wrench {
+
+    constexpr double BatchJobLog::BOUNDED_SLOWDOWN_THRESHOLD;
+
+    /** @brief Magic string at the beginning of binary job log files **/
+    static const char BINARY_JOB_LOG_MAGIC[8] = {'W', 'R', 'E', 'N', 'C', 'H', 'J', 'L'};
+    /** @brief Version of the binary job log format **/
+    static const uint32_t BINARY_JOB_LOG_VERSION = 1;
+    /** @brief Size of a record in binary job log files **/
+    static const uint32_t BINARY_JOB_LOG_RECORD_SIZE = 56;
+
+    /**
+     * @brief Constructor
+     *
+     * @param hosts: the hosts of the batch compute service (in host index order)
+     * @param num_cores_per_host: the number of cores per host
+     * @param csv_file_path: the path of the CSV file to which records are streamed ("" means no CSV file)
+     * @param binary_file_path: the path of the binary file to which records are streamed ("" means no binary file)
+     *
+     * @throw std::invalid_argument
+     */
+    BatchJobLog::BatchJobLog(const std::vector<std::string> &hosts, unsigned long num_cores_per_host,
+                             std::string csv_file_path, std::string binary_file_path) :
+            hosts(hosts), num_cores_per_host(num_cores_per_host) {
+
+        for (unsigned long i = 0; i < this->hosts.size(); i++) {
+            this->host_indices[this->hosts[i]] = i;
+        }
+
+        if (not csv_file_path.empty()) {
+            this->csv_file.open(csv_file_path, std::ios_base::out | std::ios_base::trunc);
+            if (not this->csv_file) {
+                throw std::invalid_argument("BatchJobLog::BatchJobLog(): Unable to create CSV output file " +
+                                            csv_file_path + " (as specified by the BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG property)");
+            }
+            this->csv_file << "allocated_processors,consumed_energy,execution_time,finish_time,job_id,metadata,"
+                              "requested_number_of_processors,requested_time,starting_time,stretch,submission_time,success,"
+                              "turnaround_time,waiting_time,workload_name\n";
+            this->csv_file.flush();
+        }
+
+        if (not binary_file_path.empty()) {
+            this->binary_file.open(binary_file_path, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+            if (not this->binary_file) {
+                throw std::invalid_argument("BatchJobLog::BatchJobLog(): Unable to create binary output file " +
+                                            binary_file_path + " (as specified by the BatchComputeServiceProperty::OUTPUT_BINARY_JOB_LOG property)");
+            }
+            this->binary_file.write(BINARY_JOB_LOG_MAGIC, sizeof(BINARY_JOB_LOG_MAGIC));
+            this->binary_file.write((const char *) &BINARY_JOB_LOG_VERSION, sizeof(BINARY_JOB_LOG_VERSION));
+            this->binary_file.write((const char *) &BINARY_JOB_LOG_RECORD_SIZE, sizeof(BINARY_JOB_LOG_RECORD_SIZE));
+            this->binary_file.flush();
+        }
+    }
+
+    /**
+     * @brief Record a job that has left the batch compute service
+     *
+     * @param batch_job: the batch job
+     * @param status: the job's exit status
+     * @param end_date: the date at which the job left the service
+     */
+    void BatchJobLog::recordJob(const std::shared_ptr<BatchJob> &batch_job, JobStatus status, double end_date) {
+
+        auto resources = batch_job->getResourcesAllocated();
+        double start_date = resources.empty() ? -1.0 : batch_job->getBeginTimestamp();
+
+        unsigned long index = this->job_ids.size();
+        this->job_ids.push_back(batch_job->getJobID());
+        this->submit_dates.push_back(batch_job->getArrivalTimestamp());
+        this->start_dates.push_back(start_date);
+        this->end_dates.push_back(end_date);
+        this->requested_times.push_back((double) batch_job->getRequestedTime());
+        this->num_nodes.push_back(resources.empty() ? batch_job->getRequestedNumNodes() : resources.size());
+        this->num_cores_per_node.push_back(batch_job->getRequestedCoresPerNode());
+        this->statuses.push_back((unsigned char) status);
+
+        auto metadata_it = this->metadata_value_indices.find(batch_job->csv_metadata);
+        if (metadata_it == this->metadata_value_indices.end()) {
+            metadata_it = this->metadata_value_indices.insert(
+                    std::make_pair(batch_job->csv_metadata, this->metadata_values.size())).first;
+            this->metadata_values.push_back(batch_job->csv_metadata);
+        }
+        this->metadata_indices.push_back(metadata_it->second);
+
+        unsigned long allocation_begin = this->allocated_host_indices.size();
+        for (auto const &r : resources) {
+            auto host_it = this->host_indices.find(r.first);
+            if (host_it != this->host_indices.end()) {
+                this->allocated_host_indices.push_back(host_it->second);
+            }
+        }
+        std::sort(this->allocated_host_indices.begin() + allocation_begin, this->allocated_host_indices.end());
+        this->allocation_offsets.push_back(this->allocated_host_indices.size());
+
+        // Update aggregates
+        if ((this->first_submit_date < 0) or (batch_job->getArrivalTimestamp() < this->first_submit_date)) {
+            this->first_submit_date = batch_job->getArrivalTimestamp();
+        }
+        this->last_end_date = std::max<double>(this->last_end_date, end_date);
+        if (start_date >= 0) {
+            double wait_time = start_date - batch_job->getArrivalTimestamp();
+            double run_time = end_date - start_date;
+            double bounded_slowdown = std::max<double>(
+                    1.0, (wait_time + run_time) / std::max<double>(run_time, BOUNDED_SLOWDOWN_THRESHOLD));
+            this->num_started_jobs++;
+            this->total_wait_time += wait_time;
+            this->max_wait_time = std::max<double>(this->max_wait_time, wait_time);
+            this->total_bounded_slowdown += bounded_slowdown;
+            this->max_bounded_slowdown = std::max<double>(this->max_bounded_slowdown, bounded_slowdown);
+            this->total_core_seconds += run_time * (double) (this->num_nodes[index] * this->num_cores_per_node[index]);
+        }
+
+        if (this->csv_file.is_open()) {
+            this->writeCSVRecord(index);
+        }
+        if (this->binary_file.is_open()) {
+            this->writeBinaryRecord(index);
+        }
+    }
+
+    /**
+     * @brief Append a record to the CSV file (in the Batsim format)
+     * @param index: the record index
+     */
+    void BatchJobLog::writeCSVRecord(unsigned long index) {
+
+        // Allocated processors, as Batsim-style intervals of host indices (e.g., "0-3 7")
+        std::string allocated_processors;
+        unsigned long begin = this->allocation_offsets[index];
+        unsigned long end = this->allocation_offsets[index + 1];
+        for (unsigned long i = begin; i < end;) {
+            unsigned long j = i;
+            while ((j + 1 < end) and (this->allocated_host_indices[j + 1] == this->allocated_host_indices[j] + 1)) {
+                j++;
+            }
+            if (not allocated_processors.empty()) {
+                allocated_processors += " ";
+            }
+            allocated_processors += std::to_string(this->allocated_host_indices[i]);
+            if (j > i) {
+                allocated_processors += "-" + std::to_string(this->allocated_host_indices[j]);
+            }
+            i = j + 1;
+        }
+
+        double start_date = this->start_dates[index];
+        double execution_time = (start_date < 0) ? 0.0 : this->end_dates[index] - start_date;
+        double turnaround_time = this->end_dates[index] - this->submit_dates[index];
+        double waiting_time = (start_date < 0) ? turnaround_time : start_date - this->submit_dates[index];
+        double stretch = (execution_time > 0) ? turnaround_time / execution_time : 0.0;
+
+        this->csv_file << allocated_processors << ","
+                       << "0,"
+                       << std::to_string(execution_time) << ","
+                       << std::to_string(this->end_dates[index]) << ","
+                       << this->job_ids[index] << ","
+                       << "\"" << this->metadata_values[this->metadata_indices[index]] << "\","
+                       << this->num_nodes[index] << ","
+                       << std::to_string(this->requested_times[index]) << ","
+                       << std::to_string(start_date) << ","
+                       << std::to_string(stretch) << ","
+                       << std::to_string(this->submit_dates[index]) << ","
+                       << (unsigned int) this->statuses[index] << ","
+                       << std::to_string(turnaround_time) << ","
+                       << std::to_string(waiting_time) << ","
+                       << "wrench\n";
+        this->csv_file.flush();
+    }
+
+    /**
+     * @brief Append a record to the binary file. After a 16-byte header (8-byte magic string,
+     *        32-bit format version, 32-bit record size), each record consists of (in native
+     *        byte order): a 64-bit job ID, submit/start/end dates and requested time as
+     *        doubles, 32-bit numbers of nodes and of cores per node, an 8-bit status, and padding.
+     *
+     * @param index: the record index
+     */
+    void BatchJobLog::writeBinaryRecord(unsigned long index) {
+        char record[BINARY_JOB_LOG_RECORD_SIZE];
+        memset(record, 0, sizeof(record));
+
+        auto job_id = (uint64_t) this->job_ids[index];
+        auto num_nodes = (uint32_t) this->num_nodes[index];
+        auto num_cores_per_node = (uint32_t) this->num_cores_per_node[index];
+        memcpy(record, &job_id, 8);
+        memcpy(record + 8, &this->submit_dates[index], 8);
+        memcpy(record + 16, &this->start_dates[index], 8);
+        memcpy(record + 24, &this->end_dates[index], 8);
+        memcpy(record + 32, &this->requested_times[index], 8);
+        memcpy(record + 40, &num_nodes, 4);
+        memcpy(record + 44, &num_cores_per_node, 4);
+        record[48] = (char) this->statuses[index];
+
+        this->binary_file.write(record, sizeof(record));
+        this->binary_file.flush();
+    }
+
+    /**
+     * @brief Get the number of recorded jobs
+     * @return a number of jobs
+     */
+    unsigned long BatchJobLog::getNumJobs() const {
+        return this->job_ids.size();
+    }
+
+    /**
+     * @brief Get the ID of a recorded job
+     * @param index: the record index
+     * @return a job ID
+     */
+    unsigned long BatchJobLog::getJobID(unsigned long index) const {
+        return this->job_ids.at(index);
+    }
+
+    /**
+     * @brief Get the submit date of a recorded job
+     * @param index: the record index
+     * @return a date
+     */
+    double BatchJobLog::getSubmitDate(unsigned long index) const {
+        return this->submit_dates.at(index);
+    }
+
+    /**
+     * @brief Get the start date of a recorded job
+     * @param index: the record index
+     * @return a date (-1 if the job never started)
+     */
+    double BatchJobLog::getStartDate(unsigned long index) const {
+        return this->start_dates.at(index);
+    }
+
+    /**
+     * @brief Get the date at which a recorded job left the batch compute service
+     * @param index: the record index
+     * @return a date
+     */
+    double BatchJobLog::getEndDate(unsigned long index) const {
+        return this->end_dates.at(index);
+    }
+
+    /**
+     * @brief Get the wait time of a recorded job
+     * @param index: the record index
+     * @return a time in seconds (-1 if the job never started)
+     */
+    double BatchJobLog::getWaitTime(unsigned long index) const {
+        if (this->start_dates.at(index) < 0) {
+            return -1.0;
+        }
+        return this->start_dates[index] - this->submit_dates[index];
+    }
+
+    /**
+     * @brief Get the requested time of a recorded job
+     * @param index: the record index
+     * @return a time in seconds
+     */
+    double BatchJobLog::getRequestedTime(unsigned long index) const {
+        return this->requested_times.at(index);
+    }
+
+    /**
+     * @brief Get the number of nodes of a recorded job
+     * @param index: the record index
+     * @return a number of nodes (allocated, or requested if the job never started)
+     */
+    unsigned long BatchJobLog::getNumNodes(unsigned long index) const {
+        return this->num_nodes.at(index);
+    }
+
+    /**
+     * @brief Get the number of cores per node of a recorded job
+     * @param index: the record index
+     * @return a number of cores
+     */
+    unsigned long BatchJobLog::getNumCoresPerNode(unsigned long index) const {
+        return this->num_cores_per_node.at(index);
+    }
+
+    /**
+     * @brief Get the exit status of a recorded job
+     * @param index: the record index
+     * @return a status
+     */
+    BatchJobLog::JobStatus BatchJobLog::getStatus(unsigned long index) const {
+        return (JobStatus) this->statuses.at(index);
+    }
+
+    /**
+     * @brief Get the nodes allocated to a recorded job
+     * @param index: the record index
+     * @return a list of hostnames (empty if the job never started)
+     */
+    std::vector<std::string> BatchJobLog::getAllocatedNodes(unsigned long index) const {
+        std::vector<std::string> nodes;
+        for (unsigned long i = this->allocation_offsets.at(index); i < this->allocation_offsets.at(index + 1); i++) {
+            nodes.push_back(this->hosts[this->allocated_host_indices[i]]);
+        }
+        return nodes;
+    }
+
+    /**
+     * @brief Get the number of recorded jobs that have started
+     * @return a number of jobs
+     */
+    unsigned long BatchJobLog::getNumStartedJobs() const {
+        return this->num_started_jobs;
+    }
+
+    /**
+     * @brief Get the average wait time of recorded jobs that have started
+     * @return a time in seconds
+     */
+    double BatchJobLog::getAverageWaitTime() const {
+        return (this->num_started_jobs == 0) ? 0.0 : this->total_wait_time / (double) this->num_started_jobs;
+    }
+
+    /**
+     * @brief Get the maximum wait time of recorded jobs that have started
+     * @return a time in seconds
+     */
+    double BatchJobLog::getMaxWaitTime() const {
+        return this->max_wait_time;
+    }
+
+    /**
+     * @brief Get the average bounded slowdown (with a BOUNDED_SLOWDOWN_THRESHOLD threshold) of recorded jobs that have started
+     * @return a slowdown
+     */
+    double BatchJobLog::getAverageBoundedSlowdown() const {
+        return (this->num_started_jobs == 0) ? 0.0 : this->total_bounded_slowdown / (double) this->num_started_jobs;
+    }
+
+    /**
+     * @brief Get the maximum bounded slowdown (with a BOUNDED_SLOWDOWN_THRESHOLD threshold) of recorded jobs that have started
+     * @return a slowdown
+     */
+    double BatchJobLog::getMaxBoundedSlowdown() const {
+        return this->max_bounded_slowdown;
+    }
+
+    /**
+     * @brief Get the core utilization, i.e., the fraction of the available core-seconds between the first
+     *        recorded submission and the last recorded end that were used by recorded jobs
+     * @return a utilization between 0 and 1
+     */
+    double BatchJobLog::getUtilization() const {
+        double duration = this->last_end_date - this->first_submit_date;
+        double total_num_cores = (double) (this->hosts.size() * this->num_cores_per_host);
+        if ((duration <= 0) or (total_num_cores <= 0)) {
+            return 0.0;
+        }
+        return this->total_core_seconds / (duration * total_num_cores);
+    }
+
+}
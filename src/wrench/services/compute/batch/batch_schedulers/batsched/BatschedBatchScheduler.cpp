@@ -152,17 +152,6 @@ namespace wrench {
                             "startBatsched(): Unknown fatal error");
             }
 
-            // Create the output CSV file if needed
-            std::string output_csv_file = this->cs->getPropertyValueAsString(BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG);
-            if (not output_csv_file.empty()) {
-                std::ofstream file;
-                file.open(output_csv_file, std::ios_base::out);
-                if (not file) {
-                    throw std::invalid_argument("BatchComputeService(): Unable to create CSV output file " +
-                                                output_csv_file + " (as specified by the BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG property)");
-                }
-            }
-
         } else {
             // fork failed
             throw std::runtime_error(
@@ -362,7 +351,6 @@ namespace wrench {
 #ifdef ENABLE_BATSCHED
 
         this->notifyJobEventsToBatSched(std::to_string(batch_job->getJobID()), "TIMEOUT", "COMPLETED_FAILED", "", "JOB_COMPLETED");
-        this->appendJobInfoToCSVOutputFile(batch_job.get(), "FAILED");
 #else
         throw std::runtime_error("BatschedBatchScheduler::processQueuesJobs(): BATSCHED_ENABLE should be set to 'on'");
 #endif
@@ -372,7 +360,6 @@ namespace wrench {
 
 #ifdef ENABLE_BATSCHED
         this->notifyJobEventsToBatSched(std::to_string(batch_job->getJobID()), "SUCCESS", "COMPLETED_SUCCESSFULLY", "", "JOB_COMPLETED");
-        this->appendJobInfoToCSVOutputFile(batch_job.get(), "success");
 #else
         throw std::runtime_error("BatschedBatchScheduler::processQueuesJobs(): BATSCHED_ENABLE should be set to 'on'");
 #endif
@@ -383,7 +370,6 @@ namespace wrench {
 
 #ifdef ENABLE_BATSCHED
         this->notifyJobEventsToBatSched(std::to_string(batch_job->getJobID()), "TIMEOUT", "NOT_SUBMITTED", "", "JOB_COMPLETED");
-        this->appendJobInfoToCSVOutputFile(batch_job.get(), "TERMINATED");
 #else
         throw std::runtime_error("BatschedBatchScheduler::processQueuesJobs(): BATSCHED_ENABLE should be set to 'on'");
 #endif
@@ -433,80 +419,6 @@ namespace wrench {
     }
 
 
-    /**
-     * @brief Appends a job to the CSV Output file
-     *
-     * @param batch_job: the batch job
-     * @param status: "COMPLETED", "TERMINATED" (by user), "FAILED" (timeout)
-     */
-    void BatschedBatchScheduler::appendJobInfoToCSVOutputFile(BatchJob *batch_job, std::string status) {
-        std::string csv_file_path;
-        static unsigned long job_id = 0;
-
-        csv_file_path = this->cs->getPropertyValueAsString(BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG);
-        if (csv_file_path.empty()) {
-            return;
-        }
-        std::ofstream file;
-        file.open(csv_file_path, std::ios_base::app);
-        if (not file) {
-            throw std::runtime_error("BatchComputeService::appendJobInfoToCSVOutputFile(): Unable to append to CSV output file " +
-                                     csv_file_path + " (as specified by the BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG property)");
-        }
-        std::string csv_line = "";
-
-        // Allocated Processors
-        csv_line += batch_job->csv_allocated_processors + ",";
-        // Consumed Energy
-        csv_line += "0,";
-        // Execution Time
-        double execution_time = batch_job->getEndingTimestamp() - batch_job->getBeginTimestamp();
-        csv_line += std::to_string(execution_time) + ",";
-        // Finish time
-        double finish_time = batch_job->getEndingTimestamp();
-        csv_line += std::to_string(finish_time) + ",";
-        // Job ID
-        csv_line += std::to_string(job_id++) + ",";
-        // MetaData
-        csv_line += std::string("\"") + batch_job->csv_metadata + "\",";
-        // Requested number of processors
-        csv_line += std::to_string(batch_job->getRequestedNumNodes()) + ",";
-        // Requested time
-        csv_line += std::to_string(batch_job->getRequestedTime()) + ",";
-        // Starting time
-        double starting_time = batch_job->getBeginTimestamp();
-        csv_line += std::to_string(starting_time) + ",";
-        // Stretch
-        double stretch = (batch_job->getEndingTimestamp() - batch_job->getArrivalTimestamp()) /
-                         (batch_job->getEndingTimestamp() - batch_job->getBeginTimestamp());
-        csv_line += std::to_string(stretch) + ",";
-        // Submission time
-        double submission_time = batch_job->getArrivalTimestamp();
-        csv_line += std::to_string(submission_time) + ",";
-        // Success
-        unsigned char success = 1;
-        if (status == "COMPLETED") {
-            success = 1;
-        } else if (status == "FAILED") {
-            success = 0;
-        } else if (status == "TERMINATED") {
-            success = 2;
-        }
-        csv_line += std::to_string(success) + ",";
-        // Turnaround time
-        double turnaround_time = (batch_job->getEndingTimestamp() - batch_job->getArrivalTimestamp());
-        csv_line += std::to_string(turnaround_time) + ",";
-        // Waiting time
-        double waiting_time = (batch_job->getBeginTimestamp() - batch_job->getArrivalTimestamp());
-        csv_line += std::to_string(waiting_time) + ",";
-        // Workload name
-        csv_line += "wrench";
-
-        file << csv_line << std::endl;
-        file.close();
-    }
-
-
     /**
     * @brief Start a network listener process (for batsched only)
     */
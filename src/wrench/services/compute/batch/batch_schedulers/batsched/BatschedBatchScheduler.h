@@ -87,8 +87,6 @@ namespace wrench {
         void notifyJobEventsToBatSched(std::string job_id, std::string status, std::string job_state,
                                        std::string kill_reason, std::string event_type);
 
-        void appendJobInfoToCSVOutputFile(BatchJob *batch_job, std::string status);
-
         void startBatschedNetworkListener();
 
 
@@ -36,19 +36,22 @@ namespace wrench {
                     batch_job->getJobID(),  batch_job->getRequestedNumNodes());
 
         // Update the time origin
-        this->schedule->setTimeOrigin((u_int32_t)Simulation::getCurrentSimulatedDate());
+        this->schedule->setTimeOrigin(BatchScheduleTime::fromDate(Simulation::getCurrentSimulatedDate()));
 
         // Find its earliest possible start time
-        auto est = this->schedule->findEarliestStartTime(batch_job->getRequestedTime(), batch_job->getRequestedNumNodes());
-//        WRENCH_INFO("The Earliest start time is: %u", est);
+        auto duration = BatchScheduleTime::fromDuration((double) batch_job->getRequestedTime());
+        auto est = this->schedule->findEarliestStartTime(duration, batch_job->getRequestedNumNodes());
+//        WRENCH_INFO("The Earliest start time is: %.3lf", BatchScheduleTime::toSeconds(est));
 
         // Insert it in the schedule
-        this->schedule->add(est, est + batch_job->getRequestedTime(), batch_job);
+        auto end = BatchScheduleTime::add(est, duration);
+        this->schedule->add(est, end, batch_job);
         batch_job->conservative_bf_start_date = est;
-        batch_job->conservative_bf_expected_end_date = est + batch_job->getRequestedTime();
-        WRENCH_INFO("Scheduled batch job %lu on %lu from time %u to %u",
+        batch_job->conservative_bf_expected_end_date = end;
+        WRENCH_INFO("Scheduled batch job %lu on %lu from time %.3lf to %.3lf",
                     batch_job->getJobID(), batch_job->getRequestedNumNodes(),
-                    batch_job->conservative_bf_start_date, batch_job->conservative_bf_expected_end_date);
+                    BatchScheduleTime::toSeconds(batch_job->conservative_bf_start_date),
+                    BatchScheduleTime::toSeconds(batch_job->conservative_bf_expected_end_date));
 #ifdef PRINT_SCHEDULE
         this->schedule->print();
 #endif
@@ -64,7 +67,7 @@ namespace wrench {
         }
 
         // Update the time origin
-        this->schedule->setTimeOrigin((u_int32_t)Simulation::getCurrentSimulatedDate());
+        this->schedule->setTimeOrigin(BatchScheduleTime::fromDate(Simulation::getCurrentSimulatedDate()));
 
         // Start  all non-started the jobs in the next slot!
 
@@ -126,7 +129,7 @@ namespace wrench {
         //   - re-insert it as early as possible
 
         // Reset the time origin
-        auto now = (u_int32_t)Simulation::getCurrentSimulatedDate();
+        auto now = BatchScheduleTime::fromDate(Simulation::getCurrentSimulatedDate());
         this->schedule->setTimeOrigin(now);
 
         // Go through the batch queue
@@ -135,20 +138,24 @@ namespace wrench {
 
             // Remove the job from the schedule
 //            WRENCH_INFO("REMOVING IT FROM SCHEDULE");
-            this->schedule->remove(batch_job->conservative_bf_start_date, batch_job->conservative_bf_expected_end_date + 100, batch_job);
+            this->schedule->remove(batch_job->conservative_bf_start_date,
+                                   BatchScheduleTime::add(batch_job->conservative_bf_expected_end_date, BatchScheduleTime::fromDuration(100)),
+                                   batch_job);
 //            this->schedule->print();
 
             // Find the earliest start time
 //            WRENCH_INFO("FINDING EARLIEST START TIME");
-            auto est = this->schedule->findEarliestStartTime(batch_job->getRequestedTime(), batch_job->getRequestedNumNodes());
-//            WRENCH_INFO("EARLIEST START TIME FOR IT: %u", est);
+            auto duration = BatchScheduleTime::fromDuration((double) batch_job->getRequestedTime());
+            auto est = this->schedule->findEarliestStartTime(duration, batch_job->getRequestedNumNodes());
+//            WRENCH_INFO("EARLIEST START TIME FOR IT: %.3lf", BatchScheduleTime::toSeconds(est));
             // Insert it in the schedule
-            this->schedule->add(est, est + batch_job->getRequestedTime(), batch_job);
+            auto end = BatchScheduleTime::add(est, duration);
+            this->schedule->add(est, end, batch_job);
 //            WRENCH_INFO("RE-INSERTED THERE!");
 //            this->schedule->print();
 
             batch_job->conservative_bf_start_date = est;
-            batch_job->conservative_bf_expected_end_date = est + batch_job->getRequestedTime();
+            batch_job->conservative_bf_expected_end_date = end;
         }
 
 
@@ -157,7 +164,7 @@ namespace wrench {
         this->schedule->clear();
 
         // Reset the time origin
-        auto now = (u_int32_t)Simulation::getCurrentSimulatedDate();
+        auto now = BatchScheduleTime::fromDate(Simulation::getCurrentSimulatedDate());
         this->schedule->setTimeOrigin(now);
 
         // Add the running job time slots
@@ -167,11 +174,12 @@ namespace wrench {
 
         // Add in all other jobs as early as possible in batch queue order
         for (auto const &batch_job : this->cs->batch_queue) {
-            auto est = this->schedule->findEarliestStartTime(batch_job->getRequestedTime(), batch_job->getRequestedNumNodes());
+            auto duration = BatchScheduleTime::fromDuration((double) batch_job->getRequestedTime());
+            auto est = this->schedule->findEarliestStartTime(duration, batch_job->getRequestedNumNodes());
             // Insert it in the schedule
-            this->schedule->add(est, est + batch_job->getRequestedTime(), batch_job);
+            this->schedule->add(est, BatchScheduleTime::add(est, duration), batch_job);
             batch_job->conservative_bf_start_date = est;
-            batch_job->conservative_bf_expected_end_date = est + batch_job->getRequestedTime();
+            batch_job->conservative_bf_expected_end_date = BatchScheduleTime::add(est, duration);
         }
 #endif
 
@@ -188,9 +196,10 @@ namespace wrench {
     void CONSERVATIVEBFBatchScheduler::processJobCompletion(std::shared_ptr<BatchJob> batch_job) {
         WRENCH_INFO("Notified of completion of batch job, %lu", batch_job->getJobID());
 
-        auto now = (u_int32_t)Simulation::getCurrentSimulatedDate();
+        auto now = BatchScheduleTime::fromDate(Simulation::getCurrentSimulatedDate());
         this->schedule->setTimeOrigin(now);
-        this->schedule->remove(now, batch_job->conservative_bf_expected_end_date + 100, batch_job);
+        this->schedule->remove(now, BatchScheduleTime::add(batch_job->conservative_bf_expected_end_date, BatchScheduleTime::fromDuration(100)),
+                               batch_job);
 
 #ifdef PRINT_SCHEDULE
         this->schedule->print();
@@ -287,18 +296,21 @@ namespace wrench {
             std::set<std::tuple<std::string, unsigned long, unsigned long, double>> set_of_jobs) {
         std::map<std::string, double> to_return;
 
+        // Estimates can't be in the past
+        this->schedule->setTimeOrigin(BatchScheduleTime::fromDate(Simulation::getCurrentSimulatedDate()));
+
         for (auto const &j : set_of_jobs) {
             const std::string& id = std::get<0>(j);
             u_int64_t num_nodes = std::get<1>(j);
             u_int64_t num_cores_per_host = this->cs->num_cores_per_node;  // Ignore this one. Assume all  cores!
-            if (std::get<3>(j) > UINT32_MAX) {
+            auto duration = BatchScheduleTime::fromDuration(std::get<3>(j));
+            if (duration == BatchScheduleTime::INFINITE_DATE) {
                 throw std::runtime_error("CONSERVATIVEBFBatchScheduler::getStartTimeEstimates(): job duration too large");
             }
-            auto duration = (u_int32_t)(std::get<3>(j));
 
             auto est = this->schedule->findEarliestStartTime(duration, num_nodes);
-            if (est <  UINT32_MAX) {
-                to_return[id] = (double) est;
+            if (est < BatchScheduleTime::INFINITE_DATE) {
+                to_return[id] = BatchScheduleTime::toSeconds(est);
             } else {
                 to_return[id] = -1.0;
             }
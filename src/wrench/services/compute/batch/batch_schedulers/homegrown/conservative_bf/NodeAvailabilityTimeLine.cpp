@@ -31,7 +31,7 @@ namespace wrench {
      */
     NodeAvailabilityTimeLine::NodeAvailabilityTimeLine(unsigned long max_num_nodes) : max_num_nodes(max_num_nodes) {
         std::set<BatchJob *> empty_set;
-        this->availability_timeslots += make_pair(boost::icl::interval<u_int32_t>::right_open(0, UINT32_MAX),
+        this->availability_timeslots += make_pair(boost::icl::interval<BatchScheduleTime::ticks>::right_open(0, BatchScheduleTime::INFINITE_DATE),
                                                   BatchJobSet());
     }
 
@@ -41,15 +41,15 @@ namespace wrench {
     void NodeAvailabilityTimeLine::clear() {
         this->availability_timeslots.clear();
         std::set<BatchJob *> empty_set;
-        this->availability_timeslots += make_pair(boost::icl::interval<u_int32_t>::right_open(0, UINT32_MAX),
+        this->availability_timeslots += make_pair(boost::icl::interval<BatchScheduleTime::ticks>::right_open(0, BatchScheduleTime::INFINITE_DATE),
                                                   BatchJobSet());
     }
 
     /**
      * @brief Method to set the node availability timeline's time origin
-     * @param t: a date
+     * @param t: a date (in ticks)
      */
-    void NodeAvailabilityTimeLine::setTimeOrigin(u_int32_t t) {
+    void NodeAvailabilityTimeLine::setTimeOrigin(BatchScheduleTime::ticks t) {
 
         while (true) {
             auto ts = this->availability_timeslots.begin();
@@ -59,12 +59,12 @@ namespace wrench {
                 this->availability_timeslots.erase(ts);
                 continue;
             } else {
-                u_int32_t new_left = t;
-                u_int32_t new_right = ts->first.upper();
+                BatchScheduleTime::ticks new_left = t;
+                BatchScheduleTime::ticks new_right = ts->first.upper();
                 BatchJobSet job_set = ts->second;
                 this->availability_timeslots.erase(ts);
                 this->availability_timeslots += make_pair(
-                        boost::icl::interval<u_int32_t>::right_open(new_left, new_right), job_set);
+                        boost::icl::interval<BatchScheduleTime::ticks>::right_open(new_left, new_right), job_set);
                 return;
             }
         }
@@ -88,48 +88,48 @@ namespace wrench {
     /**
      * @brief Method to update the node availability timeline
      * @param add: true if we're adding, false otherwise
-     * @param start: the start date
-     * @param end: the end date
+     * @param start: the start date (in ticks)
+     * @param end: the end date (in ticks)
      * @param job: the batch job
      */
-    void NodeAvailabilityTimeLine::update(bool add, u_int32_t start, u_int32_t end, std::shared_ptr<BatchJob> job) {
-        auto job_set = new BatchJobSet();
-        job_set->add(job);
+    void NodeAvailabilityTimeLine::update(bool add, BatchScheduleTime::ticks start, BatchScheduleTime::ticks end, std::shared_ptr<BatchJob> job) {
+        BatchJobSet job_set;
+        job_set.add(job);
 
         if (add) {
             this->availability_timeslots +=
-                    make_pair(boost::icl::interval<u_int32_t>::right_open(start, end), *job_set);
+                    make_pair(boost::icl::interval<BatchScheduleTime::ticks>::right_open(start, end), job_set);
         } else {
             this->availability_timeslots -=
-                    make_pair(boost::icl::interval<u_int32_t>::right_open(start, end), *job_set);
+                    make_pair(boost::icl::interval<BatchScheduleTime::ticks>::right_open(start, end), job_set);
         }
     }
 
     /**
      * @brief Method to find the earliest start time for a job spec
-     * @param duration: the job's duration
+     * @param duration: the job's duration (in ticks)
      * @param num_nodes: the job's number of nodes
-     * @return a date
+     * @return a date (in ticks), or BatchScheduleTime::INFINITE_DATE if the job can never start
      */
-    u_int32_t NodeAvailabilityTimeLine::findEarliestStartTime(uint32_t duration, unsigned long num_nodes) {
+    BatchScheduleTime::ticks NodeAvailabilityTimeLine::findEarliestStartTime(BatchScheduleTime::ticks duration, unsigned long num_nodes) {
 
 
-        uint32_t start_time = UINT32_MAX;
-        uint32_t remaining_duration = duration;
+        BatchScheduleTime::ticks start_time = BatchScheduleTime::INFINITE_DATE;
+        BatchScheduleTime::ticks remaining_duration = duration;
 
         for (auto &availability_timeslot : this->availability_timeslots) {
             unsigned long available_nodes = this->max_num_nodes - availability_timeslot.second.num_nodes_utilized;
 
             // Nope!
             if (available_nodes < num_nodes) {
-                start_time = UINT32_MAX;
+                start_time = BatchScheduleTime::INFINITE_DATE;
                 continue;
             }
-            u_int32_t interval_length = availability_timeslot.first.upper() - availability_timeslot.first.lower();
+            BatchScheduleTime::ticks interval_length = availability_timeslot.first.upper() - availability_timeslot.first.lower();
 
             // Yes!
             if (interval_length >= remaining_duration) {
-                if (start_time == UINT32_MAX) {
+                if (start_time == BatchScheduleTime::INFINITE_DATE) {
                     start_time = availability_timeslot.first.lower();
                 }
                 break;
@@ -137,7 +137,7 @@ namespace wrench {
 
             // Maybe!
             remaining_duration -= interval_length;
-            if (start_time == UINT32_MAX) {
+            if (start_time == BatchScheduleTime::INFINITE_DATE) {
                 start_time = availability_timeslot.first.lower();
             }
         }
@@ -13,6 +13,7 @@
 #include <vector>
 #include <boost/icl/interval_map.hpp>
 #include "BatchJobSet.h"
+#include "wrench/services/compute/batch/batch_schedulers/homegrown/BatchScheduleTime.h"
 
 /***********************/
 /** \cond              */
@@ -30,19 +31,19 @@ namespace wrench {
 
     public:
         explicit NodeAvailabilityTimeLine(unsigned long max_num_nodes);
-        void setTimeOrigin(u_int32_t t);
-        void add(u_int32_t start, u_int32_t end, std::shared_ptr<BatchJob>job) { update(true, start, end, job);}
-        void remove(u_int32_t start, u_int32_t end, std::shared_ptr<BatchJob> job) { update(false, start, end, job);}
+        void setTimeOrigin(BatchScheduleTime::ticks t);
+        void add(BatchScheduleTime::ticks start, BatchScheduleTime::ticks end, std::shared_ptr<BatchJob>job) { update(true, start, end, job);}
+        void remove(BatchScheduleTime::ticks start, BatchScheduleTime::ticks end, std::shared_ptr<BatchJob> job) { update(false, start, end, job);}
         void clear();
         void print();
         std::set<std::shared_ptr<BatchJob>> getJobsInFirstSlot();
-        u_int32_t findEarliestStartTime(uint32_t duration, unsigned long num_nodes);
+        BatchScheduleTime::ticks findEarliestStartTime(BatchScheduleTime::ticks duration, unsigned long num_nodes);
 
     private:
         unsigned long max_num_nodes;
-        boost::icl::interval_map<u_int32_t, BatchJobSet, boost::icl::partial_enricher> availability_timeslots;
+        boost::icl::interval_map<BatchScheduleTime::ticks, BatchJobSet, boost::icl::partial_enricher> availability_timeslots;
 
-        void update(bool add, u_int32_t start, u_int32_t end, std::shared_ptr<BatchJob>job);
+        void update(bool add, BatchScheduleTime::ticks start, BatchScheduleTime::ticks end, std::shared_ptr<BatchJob>job);
 
     };
 
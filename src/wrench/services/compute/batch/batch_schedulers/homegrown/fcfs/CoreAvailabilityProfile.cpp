@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2017-2019. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <cfloat>
+#include <stdexcept>
+
+#include "CoreAvailabilityProfile.h"
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     * @param nodes_to_cores: the hosts of the batch compute service and their number of cores
+     */
+    CoreAvailabilityProfile::CoreAvailabilityProfile(const std::map<std::string, unsigned long> &nodes_to_cores) {
+        // Host indices follow the (sorted) host name order
+        for (auto const &h : nodes_to_cores) {
+            this->host_indices[h.first] = this->host_num_cores.size();
+            this->host_num_cores.push_back(h.second);
+            this->max_num_cores_per_host = std::max<unsigned long>(this->max_num_cores_per_host, h.second);
+        }
+        this->busy_cores.resize(this->host_num_cores.size());
+    }
+
+    /**
+     * @brief Add a job that just started to the profile
+     * @param batch_job: the batch job (which must have been allocated resources)
+     */
+    void CoreAvailabilityProfile::addRunningJob(const std::shared_ptr<BatchJob> &batch_job) {
+        if (this->running_job_end_dates.find(batch_job->getJobID()) != this->running_job_end_dates.end()) {
+            return;
+        }
+        double end_date = batch_job->getBeginTimestamp() + (double) batch_job->getRequestedTime();
+        for (auto const &r : batch_job->getResourcesAllocated()) {
+            auto it = this->host_indices.find(r.first);
+            if (it == this->host_indices.end()) {
+                throw std::runtime_error("CoreAvailabilityProfile::addRunningJob(): unknown host " + r.first);
+            }
+            this->busy_cores[it->second][end_date] += std::get<0>(r.second);
+        }
+        this->running_job_end_dates[batch_job->getJobID()] = end_date;
+        this->invalidate();
+    }
+
+    /**
+     * @brief Remove a job that is no longer running from the profile (does nothing if
+     *        the job is not in the profile)
+     * @param batch_job: the batch job
+     */
+    void CoreAvailabilityProfile::removeRunningJob(const std::shared_ptr<BatchJob> &batch_job) {
+        auto job_it = this->running_job_end_dates.find(batch_job->getJobID());
+        if (job_it == this->running_job_end_dates.end()) {
+            return;
+        }
+        double end_date = job_it->second;
+        for (auto const &r : batch_job->getResourcesAllocated()) {
+            auto &host_busy_cores = this->busy_cores[this->host_indices[r.first]];
+            auto it = host_busy_cores.find(end_date);
+            if (it == host_busy_cores.end()) {
+                continue;
+            }
+            if (it->second <= std::get<0>(r.second)) {
+                host_busy_cores.erase(it);
+            } else {
+                it->second -= std::get<0>(r.second);
+            }
+        }
+        this->running_job_end_dates.erase(job_it);
+        this->invalidate();
+    }
+
+    /**
+     * @brief Invalidate the cached projection of pending jobs (to be called whenever the batch queue changes)
+     */
+    void CoreAvailabilityProfile::invalidate() {
+        this->projection_is_valid = false;
+        this->sorted_host_start_times.clear();
+    }
+
+    /**
+     * @brief Compute the earliest start time of a job configuration, assuming FCFS
+     *        scheduling of the pending jobs with no "jumping ahead" of any kind
+     *
+     * @param batch_queue: the batch queue
+     * @param now: the current date
+     * @param num_hosts: the number of hosts
+     * @param num_cores_per_host: the number of cores per host
+     *
+     * @return a start time relative to now, or -1.0 if the configuration can never run
+     */
+    double CoreAvailabilityProfile::getEarliestStartTime(const std::deque<std::shared_ptr<BatchJob>> &batch_queue,
+                                                         double now,
+                                                         unsigned long num_hosts,
+                                                         unsigned long num_cores_per_host) {
+
+        if ((num_hosts == 0) or (num_cores_per_host == 0) or
+            (num_hosts > this->host_num_cores.size()) or
+            (num_cores_per_host > this->max_num_cores_per_host)) {
+            return -1.0;
+        }
+
+        if ((not this->projection_is_valid) or (this->projection_date != now)) {
+            this->project(batch_queue, now);
+        }
+
+        double start_time = this->getSortedHostStartTimes(num_cores_per_host).at(num_hosts - 1);
+        if (start_time == DBL_MAX) {
+            return -1.0;
+        }
+        return start_time;
+    }
+
+    /**
+     * @brief Project the core availabilities given running and pending jobs
+     *
+     * @param batch_queue: the batch queue
+     * @param now: the current date
+     */
+    void CoreAvailabilityProfile::project(const std::deque<std::shared_ptr<BatchJob>> &batch_queue, double now) {
+
+        unsigned long num_hosts = this->host_num_cores.size();
+
+        // Account for running jobs (invariant: for each host, core availabilities
+        // are sorted by non-decreasing available time)
+        this->projected_core_available_times.resize(num_hosts);
+        for (unsigned long h = 0; h < num_hosts; h++) {
+            auto &core_available_times = this->projected_core_available_times[h];
+            core_available_times.clear();
+            unsigned long num_busy_cores = 0;
+            for (auto const &b : this->busy_cores[h]) {
+                num_busy_cores += b.second;
+            }
+            unsigned long num_idle_cores = this->host_num_cores[h] - std::min(num_busy_cores, this->host_num_cores[h]);
+            core_available_times.insert(core_available_times.end(), num_idle_cores, 0.0);
+            for (auto const &b : this->busy_cores[h]) {
+                unsigned long count = std::min(b.second, this->host_num_cores[h] - core_available_times.size());
+                core_available_times.insert(core_available_times.end(), count, std::max<double>(0, b.first - now));
+            }
+        }
+
+        // Go through the pending jobs and update core availabilities
+        std::vector<std::pair<unsigned long, double>> earliest_start_times(num_hosts);
+        for (auto const &job : batch_queue) {
+            auto duration = (double) job->getRequestedTime();
+            unsigned long job_num_hosts = job->getRequestedNumNodes();
+            unsigned long job_num_cores_per_host = job->getRequestedCoresPerNode();
+
+            if ((job_num_hosts == 0) or (job_num_hosts > num_hosts) or
+                (job_num_cores_per_host == 0) or (job_num_cores_per_host > this->max_num_cores_per_host)) {
+                continue;
+            }
+
+            // Compute the earliest start times on all hosts, and sort the hosts by them
+            for (unsigned long h = 0; h < num_hosts; h++) {
+                earliest_start_times[h] = std::make_pair(h, (job_num_cores_per_host <= this->host_num_cores[h]) ?
+                                                            this->projected_core_available_times[h][job_num_cores_per_host - 1] : DBL_MAX);
+            }
+            std::sort(earliest_start_times.begin(), earliest_start_times.end(),
+                      [](std::pair<unsigned long, double> const &a, std::pair<unsigned long, double> const &b) {
+                          return a.second < b.second;
+                      });
+
+            // Compute the actual earliest start time
+            double earliest_job_start_time = earliest_start_times[job_num_hosts - 1].second;
+            if (earliest_job_start_time == DBL_MAX) {
+                continue;
+            }
+
+            // Update the core available times on each host used for the job
+            for (unsigned long i = 0; i < job_num_hosts; i++) {
+                auto &core_available_times = this->projected_core_available_times[earliest_start_times[i].first];
+                std::fill(core_available_times.begin(), core_available_times.begin() + job_num_cores_per_host,
+                          earliest_job_start_time + duration);
+                std::sort(core_available_times.begin(), core_available_times.end());
+            }
+
+            // Make sure that no core is available before earliest_job_start_time since this
+            // is a simple fcfs algorithm (clamping preserves the sorted order)
+            for (auto &core_available_times : this->projected_core_available_times) {
+                for (auto &t : core_available_times) {
+                    t = std::max<double>(t, earliest_job_start_time);
+                }
+            }
+        }
+
+        this->sorted_host_start_times.clear();
+        this->projection_date = now;
+        this->projection_is_valid = true;
+    }
+
+    /**
+     * @brief Get the (projected) dates at which each host has a given number of cores available, sorted
+     * @param num_cores_per_host: the number of cores
+     * @return a sorted vector of dates relative to the projection date (DBL_MAX for hosts that have too few cores)
+     */
+    const std::vector<double> &CoreAvailabilityProfile::getSortedHostStartTimes(unsigned long num_cores_per_host) {
+        auto it = this->sorted_host_start_times.find(num_cores_per_host);
+        if (it != this->sorted_host_start_times.end()) {
+            return it->second;
+        }
+        std::vector<double> start_times;
+        start_times.reserve(this->host_num_cores.size());
+        for (unsigned long h = 0; h < this->host_num_cores.size(); h++) {
+            start_times.push_back((num_cores_per_host <= this->host_num_cores[h]) ?
+                                  this->projected_core_available_times[h][num_cores_per_host - 1] : DBL_MAX);
+        }
+        std::sort(start_times.begin(), start_times.end());
+        return this->sorted_host_start_times[num_cores_per_host] = std::move(start_times);
+    }
+
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2017-2019. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_COREAVAILABILITYPROFILE_H
+#define WRENCH_COREAVAILABILITYPROFILE_H
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "wrench/services/compute/batch/BatchJob.h"
+
+/***********************/
+/** \cond INTERNAL     */
+/***********************/
+
+namespace wrench {
+
+    /**
+     * @brief A class that maintains, for each host of a batch compute service, the dates at
+     *        which its cores become available. Running jobs are added and removed incrementally
+     *        as they start and finish, and the projection of pending jobs is computed
+     *        once and cached until the schedule changes, so that batches of start time
+     *        estimate queries each boil down to a lookup in a pre-sorted vector.
+     */
+    class CoreAvailabilityProfile {
+
+    public:
+
+        explicit CoreAvailabilityProfile(const std::map<std::string, unsigned long> &nodes_to_cores);
+
+        void addRunningJob(const std::shared_ptr<BatchJob> &batch_job);
+
+        void removeRunningJob(const std::shared_ptr<BatchJob> &batch_job);
+
+        void invalidate();
+
+        double getEarliestStartTime(const std::deque<std::shared_ptr<BatchJob>> &batch_queue, double now,
+                                    unsigned long num_hosts, unsigned long num_cores_per_host);
+
+    private:
+
+        void project(const std::deque<std::shared_ptr<BatchJob>> &batch_queue, double now);
+
+        const std::vector<double> &getSortedHostStartTimes(unsigned long num_cores_per_host);
+
+        /** @brief Dense host indices **/
+        std::unordered_map<std::string, unsigned long> host_indices;
+        /** @brief Number of cores of each host **/
+        std::vector<unsigned long> host_num_cores;
+        /** @brief Max number of cores on any host **/
+        unsigned long max_num_cores_per_host = 0;
+
+        /** @brief For each host, the release dates of busy cores (date -> number of cores) **/
+        std::vector<std::map<double, unsigned long>> busy_cores;
+        /** @brief Expected end dates of the running jobs in the profile, indexed by job ID **/
+        std::unordered_map<unsigned long, double> running_job_end_dates;
+
+        /** @brief Whether the cached projection is up to date **/
+        bool projection_is_valid = false;
+        /** @brief The date at which the cached projection was computed **/
+        double projection_date = -1.0;
+        /** @brief Projected core available times (relative to projection_date) for each host, sorted **/
+        std::vector<std::vector<double>> projected_core_available_times;
+        /** @brief Sorted host start times, indexed by the number of cores per host (lazily computed) **/
+        std::map<unsigned long, std::vector<double>> sorted_host_start_times;
+
+    };
+
+}
+
+/***********************/
+/** \endcond           */
+/***********************/
+
+#endif //WRENCH_COREAVAILABILITYPROFILE_H
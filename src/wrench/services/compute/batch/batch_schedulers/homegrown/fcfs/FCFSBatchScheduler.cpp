@@ -16,6 +16,16 @@ WRENCH_LOG_CATEGORY(wrench_core_fcfs_batch_scheduler, "Log category for FCFSBatc
 
 namespace wrench {
 
+    /**
+     * @brief Constructor
+     *
+     * @param cs: the batch compute service for which this scheduler is operating
+     */
+    FCFSBatchScheduler::FCFSBatchScheduler(BatchComputeService *cs) : HomegrownBatchScheduler(cs) {
+        this->core_availability_profile = std::unique_ptr<CoreAvailabilityProfile>(
+                new CoreAvailabilityProfile(cs->nodes_to_cores_map));
+    }
+
     /**
     * @brief Overriden Method to pick the next job to schedule
     *
@@ -159,171 +169,35 @@ namespace wrench {
         return resources;
     }
 
+    /**
+     * @brief Method to obtain start time estimates
+     *
+     * @param set_of_jobs: a set of job specs
+     * @return map of estimates
+     */
     std::map<std::string, double> FCFSBatchScheduler::getStartTimeEstimates(
             std::set<std::tuple<std::string, unsigned long, unsigned long, double>> set_of_jobs) {
 
-        if (cs->getPropertyValueAsString(BatchComputeServiceProperty::HOST_SELECTION_ALGORITHM) != "FIRSTFIT") {
-            throw std::runtime_error("FCFSBatchScheduler::getStartTimeEstimates(): The fcfs sceduling algorithm can only provide start time estimates "
-                                     "when the HOST_SELECTION_ALGORITHM property is set to FIRSTFIT");
-        }
-
-        // Assumes time origin is zero for simplicity!
-
-        // Set the available time of each node to zero (i.e., now)
-        // (invariant: for each host, core availabilities are sorted by
-        //             non-decreasing available time)
-        std::map<std::string, std::vector<double>> core_available_times;
-        for (auto h : cs->nodes_to_cores_map) {
-            std::string hostname = h.first;
-            unsigned long num_cores = h.second;
-            std::vector<double> zeros;
-            for (unsigned int i = 0; i < num_cores; i++) {
-                zeros.push_back(0);
-            }
-            core_available_times.insert(std::make_pair(hostname, zeros));
-        }
-
-
-        // Update core availabilities for jobs that are currently running
-        for (auto job : cs->running_jobs) {
-            double time_to_finish = std::max<double>(0, job->getBeginTimestamp() +
-                                                        job->getRequestedTime() -
-                                                        cs->simulation->getCurrentSimulatedDate());
-            for (auto resource : job->getResourcesAllocated()) {
-                std::string hostname = resource.first;
-                unsigned long num_cores = std::get<0>(resource.second);
-                double ram = std::get<1>(resource.second);
-                // Update available_times
-                double new_available_time = *(core_available_times[hostname].begin() + num_cores - 1) + time_to_finish;
-                for (unsigned int i = 0; i < num_cores; i++) {
-                    *(core_available_times[hostname].begin() + i) = new_available_time;
-                }
-                // Sort them!
-                std::sort(core_available_times[hostname].begin(), core_available_times[hostname].end());
-            }
-        }
-
-#if 0
-        std::cerr << "TIMELINES AFTER ACCOUNTING FOR RUNNING JOBS: \n";
-      for (auto h : core_available_times) {
-        std::cerr << "  " << h.first << ":\n";
-        for (auto t : h.second) {
-          std::cerr << "     core : " << t << "\n";
-        }
-      }
-      std::cerr << "----------------------------------------\n";
-#endif
-
-        // Go through the pending jobs and update core availabilities
-        for (auto job : this->cs->batch_queue) {
-            double duration = job->getRequestedTime();
-            unsigned long num_hosts = job->getRequestedNumNodes();
-            unsigned long num_cores_per_host = job->getRequestedCoresPerNode();
-
-#if 0
-            std::cerr << "ACCOUNTING FOR RUNNING JOB WITH " << "duration:" <<
-                  duration << " num_hosts=" << num_hosts << " num_cores_per_host=" << num_cores_per_host << "\n";
-#endif
-
-            // Compute the  earliest start times on all hosts
-            std::vector<std::pair<std::string, double>> earliest_start_times;
-            for (auto h : core_available_times) {
-                double earliest_start_time = *(h.second.begin() + num_cores_per_host - 1);
-                earliest_start_times.emplace_back(std::make_pair(h.first, earliest_start_time));
-            }
-
-            // Sort the hosts by earliest start times
-            std::sort(earliest_start_times.begin(), earliest_start_times.end(),
-                      [](std::pair<std::string, double> const &a, std::pair<std::string, double> const &b) {
-                          return std::get<1>(a) < std::get<1>(b);
-                      });
-
-            // Compute the actual earliest start time
-            double earliest_job_start_time = (*(earliest_start_times.begin() + num_hosts - 1)).second;
-
-            // Update the core available times on each host used for the job
-            for (unsigned int i = 0; i < num_hosts; i++) {
-                std::string hostname = (*(earliest_start_times.begin() + i)).first;
-                for (unsigned int j = 0; j < num_cores_per_host; j++) {
-                    *(core_available_times[hostname].begin() + j) = earliest_job_start_time + duration;
-                }
-                std::sort(core_available_times[hostname].begin(), core_available_times[hostname].end());
-            }
-
-            // Go through all hosts and make sure that no core is available before earliest_job_start_time
-            // since this is a simple fcfs algorithm with no "jumping ahead" of any kind
-            for (auto h : cs->nodes_to_cores_map) {
-                std::string hostname = h.first;
-                unsigned long num_cores = h.second;
-                for (unsigned int i = 0; i < num_cores; i++) {
-                    if (*(core_available_times[hostname].begin() + i) < earliest_job_start_time) {
-                        *(core_available_times[hostname].begin() + i) = earliest_job_start_time;
-                    }
-                }
-                std::sort(core_available_times[hostname].begin(), core_available_times[hostname].end());
-            }
+        // The projection of running and pending jobs is cached in the core availability profile,
+        // so that each estimate below is a lookup (hosts being homogeneous, the estimate does
+        // not depend on the host selection algorithm)
+        double now = cs->simulation->getCurrentSimulatedDate();
 
-#if 0
-            std::cerr << "AFTER ACCOUNTING FOR THIS JOB: \n";
-        for (auto h : core_available_times) {
-          std::cerr << "  " << h.first << ":\n";
-          for (auto t : h.second) {
-            std::cerr << "     core : " << t << "\n";
-          }
-        }
-        std::cerr << "----------------------------------------\n";
-#endif
-
-        }
-
-        // We now have the predicted available times for each cores given
-        // everything that's running and pending. We can compute predictions.
         std::map<std::string, double> predictions;
 
-        for (auto job : set_of_jobs) {
+        for (auto const &job : set_of_jobs) {
             std::string id = std::get<0>(job);
-            unsigned int num_hosts = std::get<1>(job);
-            unsigned int num_cores_per_host = std::get<2>(job);
-            double duration = std::get<3>(job);
-
-            double earliest_job_start_time;
-
-            if ((num_hosts > core_available_times.size()) ||
-                (num_cores_per_host > cs->num_cores_per_node)) {
-
-                earliest_job_start_time = -1.0;
-
-            } else {
-
-#if 0
-                std::cerr << "COMPUTING PREDICTIONS for JOB: num_hosts=" << num_hosts <<
-                    ", num_cores_per_hosts=" << num_cores_per_host << ", duration=" << duration << "\n";
-#endif
-
-                // Compute the earliest start times on all hosts
-                std::vector<std::pair<std::string, double>> earliest_start_times;
-                for (auto h : core_available_times) {
-                    double earliest_start_time = *(h.second.begin() + num_cores_per_host - 1);
-                    earliest_start_times.emplace_back(std::make_pair(h.first, earliest_start_time));
-                }
-
-
-                // Sort the hosts by putative start times
-                std::sort(earliest_start_times.begin(), earliest_start_times.end(),
-                          [](std::pair<std::string, double> const &a, std::pair<std::string, double> const &b) {
-                              return std::get<1>(a) < std::get<1>(b);
-                          });
-
-                earliest_job_start_time = (*(earliest_start_times.begin() + num_hosts - 1)).second;
-            }
+            unsigned long num_hosts = std::get<1>(job);
+            unsigned long num_cores_per_host = std::get<2>(job);
 
+            double earliest_job_start_time = this->core_availability_profile->getEarliestStartTime(
+                    this->cs->batch_queue, now, num_hosts, num_cores_per_host);
 
             // Note that below we translate predictions back to actual start dates given the current time
-            if (earliest_job_start_time > 0) {
-                earliest_job_start_time = cs->simulation->getCurrentSimulatedDate() + earliest_job_start_time;
+            if (earliest_job_start_time >= 0) {
+                earliest_job_start_time = now + earliest_job_start_time;
             }
             predictions.insert(std::make_pair(id, earliest_job_start_time));
-
         }
 
         return predictions;
@@ -359,11 +233,11 @@ namespace wrench {
 
             auto resources = this->scheduleOnHosts(num_nodes_asked_for, cores_per_node_asked_for, ComputeService::ALL_RAM);
             if (resources.empty()) {
-                WRENCH_INFO("Can't run job %s right now", workflow_job->getName().c_str());
+                WRENCH_INFO("Can't run batch job %lu right now", batch_job->getJobID());
                 break;
             }
 
-            WRENCH_INFO("Starting job %s", workflow_job->getName().c_str());
+            WRENCH_INFO("Starting batch job %lu", batch_job->getJobID());
 
             // Remove the job from the batch queue
             this->cs->removeJobFromBatchQueue(batch_job);
@@ -375,24 +249,51 @@ namespace wrench {
             this->cs->startJob(resources, workflow_job, batch_job, num_nodes_asked_for, requested_time,
                      cores_per_node_asked_for);
 
+            // Account for it in the core availability profile
+            this->core_availability_profile->addRunningJob(batch_job);
 
         }
     }
 
+    /**
+     * @brief Method to process a job submission
+     * @param batch_job: the newly submitted batch job
+     */
     void FCFSBatchScheduler::processJobSubmission(std::shared_ptr<BatchJob> batch_job) {
-        // Do nothing
+        // The batch queue has changed
+        this->core_availability_profile->invalidate();
     }
 
+    /**
+     * @brief Method to process a job failure
+     * @param batch_job: the job that failed
+     */
     void FCFSBatchScheduler::processJobFailure(std::shared_ptr<BatchJob> batch_job) {
-        // Do nothing
+        // Just like a job completion to me!
+        this->processJobCompletion(batch_job);
     }
 
+    /**
+     * @brief Method to process a job completion
+     * @param batch_job: the job that completed
+     */
     void FCFSBatchScheduler::processJobCompletion(std::shared_ptr<BatchJob> batch_job) {
-        // Do nothing
+        // The batch queue may have changed (e.g., a pending job, passed as nullptr, was terminated)
+        this->core_availability_profile->invalidate();
+        if (batch_job == nullptr) {
+            return;
+        }
+        // Removing a job that's not running (e.g., a pending job) is a no-op
+        this->core_availability_profile->removeRunningJob(batch_job);
     }
 
+    /**
+     * @brief Method to process a job termination
+     * @param batch_job: the job that was terminated
+     */
     void FCFSBatchScheduler::processJobTermination(std::shared_ptr<BatchJob> batch_job) {
-        // Do nothing
+        // Just like a job completion to me!
+        this->processJobCompletion(batch_job);
     }
 
 
@@ -16,6 +16,7 @@
 
 #include <wrench/services/compute/batch/batch_schedulers/homegrown/HomegrownBatchScheduler.h>
 #include <wrench/services/compute/batch/BatchComputeService.h>
+#include "CoreAvailabilityProfile.h"
 
 namespace wrench {
 
@@ -31,7 +32,7 @@ namespace wrench {
          *
          * @param cs: the batch compute service for which this scheduler is operating
          */
-        explicit FCFSBatchScheduler(BatchComputeService *cs) : HomegrownBatchScheduler(cs) {}
+        explicit FCFSBatchScheduler(BatchComputeService *cs);
 
         void processQueuedJobs() override;
 
@@ -47,6 +48,10 @@ namespace wrench {
 
         std::map<std::string, double> getStartTimeEstimates(std::set <std::tuple<std::string, unsigned long, unsigned long, double>> set_of_jobs) override;
 
+    private:
+
+        std::unique_ptr<CoreAvailabilityProfile> core_availability_profile;
+
     };
 
 }
@@ -7,7 +7,18 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "wrench/logging/TerminalOutput.h"
 #include <wrench-dev.h>
 #include <nlohmann/json.hpp>
@@ -17,12 +28,333 @@ WRENCH_LOG_CATEGORY(wrench_core_trace_file_loader, "Log category for Trace File
 
 namespace wrench {
 
+    namespace {
+
+        typedef std::tuple<std::string, double, double, double, double, unsigned int> TraceFileJob;
+
+        /** @brief Maximum number of columns in an SWF line **/
+        const unsigned long SWF_MAX_NUM_COLUMNS = 18;
+
+        /** @brief Minimum number of bytes for which it is worth parsing an SWF file chunk in a separate thread **/
+        const size_t SWF_MIN_CHUNK_SIZE = 1 << 16;
+
+        /** @brief A token of an SWF line, pointing into the (memory-mapped) file **/
+        struct SWFToken {
+            const char *begin;
+            size_t length;
+
+            std::string str() const {
+                return std::string(this->begin, this->length);
+            }
+        };
+
+        /** @brief A chunk of an SWF file, parsed independently from the other chunks **/
+        struct SWFChunk {
+            const char *begin;
+            const char *end;
+            std::vector<TraceFileJob> jobs;
+            unsigned long num_jobs = 0;
+            std::vector<std::string> warnings;
+            bool failed = false;
+            std::string error;
+        };
+
+        bool isSWFWhitespace(char c) {
+            return (c == ' ') or (c == '\t') or (c == '\r') or (c == '\v') or (c == '\f');
+        }
+
+        /**
+         * @brief Split an SWF line into tokens (only the first SWF_MAX_NUM_COLUMNS+1 tokens are kept)
+         * @param begin: the beginning of the line
+         * @param end: the end of the line (exclusive)
+         * @param tokens: an array of SWF_MAX_NUM_COLUMNS+1 tokens
+         * @return the number of tokens
+         */
+        unsigned long tokenizeSWFLine(const char *begin, const char *end, SWFToken *tokens) {
+            unsigned long num_tokens = 0;
+            const char *p = begin;
+            while (num_tokens < SWF_MAX_NUM_COLUMNS + 1) {
+                while ((p < end) and isSWFWhitespace(*p)) p++;
+                if (p == end) break;
+                const char *token_begin = p;
+                while ((p < end) and (not isSWFWhitespace(*p))) p++;
+                tokens[num_tokens].begin = token_begin;
+                tokens[num_tokens].length = (size_t) (p - token_begin);
+                num_tokens++;
+            }
+            return num_tokens;
+        }
+
+        /**
+         * @brief Parse a floating point token (like sscanf's "%lf", i.e., a valid prefix is enough)
+         * @param token: the token
+         * @param value: the parsed value
+         * @return true on success, false otherwise
+         */
+        bool parseSWFDouble(const SWFToken &token, double &value) {
+            char buffer[64];
+            size_t length = std::min<size_t>(token.length, sizeof(buffer) - 1);
+            memcpy(buffer, token.begin, length);
+            buffer[length] = '\0';
+            char *parse_end;
+            value = strtod(buffer, &parse_end);
+            return parse_end != buffer;
+        }
+
+        /**
+         * @brief Parse an integer token (like sscanf's "%d", i.e., a valid prefix is enough)
+         * @param token: the token
+         * @param value: the parsed value
+         * @return true on success, false otherwise
+         */
+        bool parseSWFInt(const SWFToken &token, int &value) {
+            char buffer[64];
+            size_t length = std::min<size_t>(token.length, sizeof(buffer) - 1);
+            memcpy(buffer, token.begin, length);
+            buffer[length] = '\0';
+            char *parse_end;
+            value = (int) strtol(buffer, &parse_end, 10);
+            return parse_end != buffer;
+        }
+
+        /**
+         * @brief Find the end of the line that starts at a given position
+         * @param begin: the beginning of the line
+         * @param end: the end of the buffer
+         * @return a pointer to the line's '\n' (or to end if none)
+         */
+        const char *findSWFLineEnd(const char *begin, const char *end) {
+            auto eol = (const char *) memchr(begin, '\n', (size_t) (end - begin));
+            return (eol == nullptr) ? end : eol;
+        }
+
+        /**
+         * @brief Parse an SWF job description line
+         *
+         * @param begin: the beginning of the line
+         * @param end: the end of the line (exclusive)
+         * @param filename: the path to the trace file
+         * @param desired_submit_time_of_first_job: the desired submit of of the first job (-1 means "use whatever time is in the trace file")
+         * @param original_submit_time_of_first_job: the submit time of the first job in the trace file
+         * @param job: the job to fill in (nullptr if the job should only be checked)
+         * @param warnings: warnings to append to (nullptr if warnings should be dropped)
+         *
+         * @throw std::invalid_argument
+         */
+        void parseSWFLine(const char *begin, const char *end, const std::string &filename,
+                          double desired_submit_time_of_first_job, double original_submit_time_of_first_job,
+                          TraceFileJob *job, std::vector<std::string> *warnings) {
+
+            SWFToken tokens[SWF_MAX_NUM_COLUMNS + 1];
+            unsigned long num_tokens = tokenizeSWFLine(begin, end, tokens);
+
+            double time = -1, requested_time = -1, requested_ram = -1;
+            double sub_time = -1;
+            int requested_num_nodes = -1;
+            int num_nodes = -1;
+
+            if (num_tokens < 10) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): Seeing less than 10 fields per line in batch workload trace file '" +
+                        filename +
+                        "'");
+            }
+
+            // Submit time
+            if (not parseSWFDouble(tokens[1], sub_time)) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): Invalid submission time '" +
+                        tokens[1].str() +
+                        "' in batch workload trace file");
+            }
+            if (desired_submit_time_of_first_job >= 0) {
+                sub_time += (desired_submit_time_of_first_job - original_submit_time_of_first_job);
+            }
+            // Run time (assuming flops and runtime are the same, in seconds)
+            if (not parseSWFDouble(tokens[3], time)) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): Invalid run time '" + tokens[3].str() +
+                        "' in batch workload trace file");
+            }
+            // Number of Allocated Processors
+            if (not parseSWFInt(tokens[4], num_nodes)) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): Invalid number of processors '" +
+                        tokens[4].str() +
+                        "' in batch workload trace file");
+            }
+            // Requested Number of Processors
+            if (not parseSWFInt(tokens[7], requested_num_nodes)) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested number of processors '" +
+                        tokens[7].str() +
+                        "' in batch workload trace file");
+            }
+            // Requested time (assuming flops and runtime are the same, in seconds)
+            if (not parseSWFDouble(tokens[8], requested_time)) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested time '" +
+                        tokens[8].str() +
+                        "' in batch workload trace file");
+            }
+            // Requested memory (in KiB)
+            if (not parseSWFDouble(tokens[9], requested_ram)) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested memory '" +
+                        tokens[9].str() +
+                        "' in batch workload trace file");
+            }
+            requested_ram *= 1024.0;
+            // Columns 10 to 17 (status, user ID, group ID, executable number, queue number,
+            // partition number, preceding job number, think time) are ignored
+            if (num_tokens > SWF_MAX_NUM_COLUMNS) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): Unknown batch workload trace file column, maybe there are more than 18 columns?"
+                );
+            }
+
+            // Fix/check values
+            if (requested_time < 0) {
+                requested_time = time;
+            } else if (time < 0) {
+                time = requested_time;
+            }
+            if ((requested_time < 0) or (time < 0)) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative flops (" +
+                        std::to_string(time) + ") and negative requested flops ("+ std::to_string(requested_time) + ") in batch workload trace file");
+            }
+            if (requested_time < time) {
+                if (warnings) {
+                    char warning[256];
+                    snprintf(warning, sizeof(warning),
+                             "TraceFileLoader::loadFromTraceFileSWF(): invalid job with requested time (%lf) smaller than actual time (%lf) in batch workload trace file [fixing it]", requested_time, time);
+                    warnings->push_back(warning);
+                }
+                requested_time = time;
+            }
+
+            if (requested_ram < 0) {
+                requested_ram = 0;
+            }
+
+            if (sub_time < 0) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative submission time in batch workload trace file");
+            }
+            if (requested_num_nodes <= 0) {
+                requested_num_nodes = num_nodes;
+            }
+            if (requested_num_nodes <= 0) {
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative (requested) number of node in batch workload trace file");
+            }
+
+            if (job) {
+                *job = TraceFileJob(tokens[0].str(), sub_time, time, requested_time, requested_ram,
+                                    (unsigned int) requested_num_nodes);
+            }
+        }
+
+        /**
+         * @brief Find the submit time of the first job in an SWF file, i.e., the submit time in
+         *        the first non-comment line that has enough fields and a valid submit time
+         * @param begin: the beginning of the file
+         * @param end: the end of the file
+         * @return a submit time (-1 if none)
+         */
+        double findSWFSubmitTimeOfFirstJob(const char *begin, const char *end) {
+            SWFToken tokens[SWF_MAX_NUM_COLUMNS + 1];
+            for (const char *p = begin; p < end; p = findSWFLineEnd(p, end) + 1) {
+                if (*p == ';') continue;
+                const char *eol = findSWFLineEnd(p, end);
+                double sub_time;
+                if ((tokenizeSWFLine(p, eol, tokens) >= 10) and parseSWFDouble(tokens[1], sub_time)) {
+                    return sub_time;
+                }
+            }
+            return -1;
+        }
+
+        /**
+         * @brief Parse a chunk of an SWF file (does not log, so that it can run in any thread)
+         *
+         * @param chunk: the chunk
+         * @param filename: the path to the trace file
+         * @param ignore_invalid_jobs: whether to ignore invalid job specifications
+         * @param desired_submit_time_of_first_job: the desired submit of of the first job (-1 means "use whatever time is in the trace file")
+         * @param original_submit_time_of_first_job: the submit time of the first job in the trace file
+         * @param store_jobs: whether parsed jobs should be stored (or just counted)
+         */
+        void parseSWFChunk(SWFChunk *chunk, const std::string &filename, bool ignore_invalid_jobs,
+                           double desired_submit_time_of_first_job, double original_submit_time_of_first_job,
+                           bool store_jobs) {
+            try {
+                TraceFileJob job;
+                for (const char *p = chunk->begin; p < chunk->end; p = findSWFLineEnd(p, chunk->end) + 1) {
+                    if (*p == ';') continue;
+                    try {
+                        parseSWFLine(p, findSWFLineEnd(p, chunk->end), filename,
+                                     desired_submit_time_of_first_job, original_submit_time_of_first_job,
+                                     store_jobs ? &job : nullptr, &chunk->warnings);
+                    } catch (std::invalid_argument &e) {
+                        if (ignore_invalid_jobs) {
+                            chunk->warnings.push_back(std::string(e.what()) + " (in batch workload file " + filename + ") IGNORING");
+                            continue;
+                        } else {
+                            throw std::invalid_argument("Error while reading batch workload trace file " + filename + ": " +  e.what());
+                        }
+                    }
+                    if (store_jobs) {
+                        chunk->jobs.push_back(std::move(job));
+                    }
+                    chunk->num_jobs++;
+                }
+            } catch (std::exception &e) {
+                chunk->failed = true;
+                chunk->error = e.what();
+            }
+        }
+
+        /**
+         * @brief Memory-map a file in read-only mode
+         * @param filename: the path to the file
+         * @param size: the size of the file
+         * @return the mapping (nullptr if the file is empty)
+         *
+         * @throw std::invalid_argument
+         */
+        void *mapTraceFile(const std::string &filename, size_t &size) {
+            int fd = open(filename.c_str(), O_RDONLY);
+            struct stat file_stat;
+            if ((fd < 0) or (fstat(fd, &file_stat) != 0) or (not S_ISREG(file_stat.st_mode))) {
+                if (fd >= 0) close(fd);
+                throw std::invalid_argument(
+                        "TraceFileLoader::loadFromTraceFileSWF(): Cannot open batch workload trace file " + filename);
+            }
+            size = (size_t) file_stat.st_size;
+            void *mapping = nullptr;
+            if (size > 0) {
+                mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (mapping == MAP_FAILED) {
+                    close(fd);
+                    throw std::invalid_argument(
+                            "TraceFileLoader::loadFromTraceFileSWF(): Cannot open batch workload trace file " + filename);
+                }
+                madvise(mapping, size, MADV_SEQUENTIAL);
+            }
+            close(fd);
+            return mapping;
+        }
+    }
+
     /**
     * @brief Load the workflow trace file
     *
     * @param filename: the path to the trace file in SWF format or in JSON format
     * @param ignore_invalid_jobs: whether to ignore invalid job specifications
     * @param desired_submit_time_of_first_job: the desired submit of of the first job (-1 means "use whatever time is in the trace file")
+    * @param num_threads: the number of threads used to parse SWF files (0 means "one per hardware thread")
     *
     * @return  a vector of tuples, where each tuple is a job description with the following fields:
     *              - job id
@@ -35,7 +367,51 @@ namespace wrench {
     * @throw std::invalid_argument
     */
     std::vector<std::tuple<std::string, double, double, double, double, unsigned int>>
-    TraceFileLoader::loadFromTraceFile(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job) {
+    TraceFileLoader::loadFromTraceFile(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job,
+                                       unsigned long num_threads) {
+
+        std::string extension = getTraceFileExtension(filename);
+        if (extension == "swf") {
+            std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> trace_file_jobs;
+            loadFromTraceFileSWF(filename, ignore_invalid_jobs, desired_submit_time_of_first_job, num_threads, &trace_file_jobs);
+            return trace_file_jobs;
+        } else {
+            return loadFromTraceFileJSON(filename, ignore_invalid_jobs, desired_submit_time_of_first_job);
+        }
+    }
+
+    /**
+    * @brief Check that a workflow trace file is valid, without storing its jobs
+    *
+    * @param filename: the path to the trace file in SWF format or in JSON format
+    * @param ignore_invalid_jobs: whether to ignore invalid job specifications
+    * @param desired_submit_time_of_first_job: the desired submit of of the first job (-1 means "use whatever time is in the trace file")
+    * @param num_threads: the number of threads used to parse SWF files (0 means "one per hardware thread")
+    *
+    * @return the number of (valid) jobs in the trace file
+    *
+    * @throw std::invalid_argument
+    */
+    unsigned long
+    TraceFileLoader::checkTraceFile(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job,
+                                    unsigned long num_threads) {
+
+        std::string extension = getTraceFileExtension(filename);
+        if (extension == "swf") {
+            return loadFromTraceFileSWF(filename, ignore_invalid_jobs, desired_submit_time_of_first_job, num_threads, nullptr);
+        } else {
+            return loadFromTraceFileJSON(filename, ignore_invalid_jobs, desired_submit_time_of_first_job).size();
+        }
+    }
+
+    /**
+     * @brief Get the extension of a trace file
+     * @param filename: the path to the trace file
+     * @return "swf" or "json"
+     *
+     * @throw std::invalid_argument
+     */
+    std::string TraceFileLoader::getTraceFileExtension(const std::string &filename) {
 
         std::istringstream ss(filename);
         std::string token;
@@ -45,216 +421,99 @@ namespace wrench {
             tokens.push_back(token);
         }
 
-        if (tokens.size() < 2) {
-            throw std::invalid_argument(
-                    "TraceFileLoader::loadFromTraceFile(): batch workload trace file name must end with '.swf' or '.json'");
-        }
-        std::string extension = tokens[tokens.size() - 1];
-        if (extension == "swf") {
-            return loadFromTraceFileSWF(filename, ignore_invalid_jobs, desired_submit_time_of_first_job);
-        } else if (extension == "json") {
-            return loadFromTraceFileJSON(filename, ignore_invalid_jobs, desired_submit_time_of_first_job);
-        } else {
+        if ((tokens.size() < 2) or ((tokens[tokens.size() - 1] != "swf") and (tokens[tokens.size() - 1] != "json"))) {
             throw std::invalid_argument(
                     "TraceFileLoader::loadFromTraceFile(): batch workload trace file name must end with '.swf' or '.json'");
         }
+        return tokens[tokens.size() - 1];
     }
 
     /**
-    * @brief Load the workflow SWF trace file
+    * @brief Load the workflow SWF trace file. The file is memory-mapped and split into
+    *        chunks (at line boundaries) that are parsed concurrently, after which results
+    *        are merged in file order so that the outcome (jobs, warnings, first error) is
+    *        the same as that of a sequential parse.
     *
     * @param filename: the path to the trace file in SWF format
     * @param ignore_invalid_jobs: whether to ignore invalid job specifications
     * @param desired_submit_time_of_first_job: the desired submit of of the first job (-1 means "use whatever time is in the trace file")
+    * @param num_threads: the number of threads (0 means "one per hardware thread")
+    * @param trace_file_jobs: the vector to which job descriptions are appended (nullptr if jobs should only be checked)
     *
-    * @return  a vector of tuples, where each tuple is a job description with the following fields:
-    *              - job id
-    *              - submission time
-    *              - actual time
-    *              - requested time,
-    *              - requested ram
-    *              - requested number of nodes
+    * @return the number of (valid) jobs in the trace file
     *
     * @throw std::invalid_argument
     */
-    std::vector<std::tuple<std::string, double, double, double, double, unsigned int>>
-    TraceFileLoader::loadFromTraceFileSWF(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job) {
-
-        std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> trace_file_jobs = {};
-
-        std::ifstream infile(filename);
-        if (not infile.is_open()) {
-            throw std::invalid_argument(
-                    "TraceFileLoader::loadFromTraceFileSWF(): Cannot open batch workload trace file " + filename);
-        }
-
-
-        std::string line;
-        double original_submit_time_of_first_job = -1;
-        while (std::getline(infile, line)) {
+    unsigned long
+    TraceFileLoader::loadFromTraceFileSWF(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job,
+                                          unsigned long num_threads,
+                                          std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> *trace_file_jobs) {
 
-            if (line[0] != ';') {
-                std::istringstream iss(line);
-                std::vector<std::string> tokens{std::istream_iterator<std::string>{iss},
-                                                std::istream_iterator<std::string>{}};
+        size_t size;
+        void *mapping = mapTraceFile(filename, size);
+        auto begin = (const char *) mapping;
+        auto end = begin + size;
 
-                std::string id;
-                double time = -1, requested_time = -1, requested_ram = -1;
-                int itemnum = 0;
-                double sub_time = -1;
-                int requested_num_nodes = -1;
-                int num_nodes = -1;
+        double original_submit_time_of_first_job = findSWFSubmitTimeOfFirstJob(begin, end);
 
-                try {
-                    if (tokens.size() < 10) {
-                        throw std::invalid_argument(
-                                "TraceFileLoader::loadFromTraceFileSWF(): Seeing less than 10 fields per line in batch workload trace file '" +
-                                filename +
-                                "'");
-                    }
-
-                    for (auto const &item : tokens) {
-                        switch (itemnum) {
-                            case 0: // Job ID
-                                id = item;
-                                break;
-                            case 1: // Submit time
-                                if (sscanf(item.c_str(), "%lf", &sub_time) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid submission time '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                if (original_submit_time_of_first_job < 0) {
-                                    original_submit_time_of_first_job = sub_time;
-                                }
-                                if (desired_submit_time_of_first_job >= 0) {
-                                    sub_time += (desired_submit_time_of_first_job - original_submit_time_of_first_job);
-                                }
-                                break;
-                            case 2: // Wait time
-                                break;
-                            case 3: // Run time
-                                //assuming flops and runtime are the same (in seconds)
-                                if (sscanf(item.c_str(), "%lf", &time) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid run time '" + item +
-                                            "' in batch workload trace file");
-                                }
-                                break;
-                            case 4: // Number of Allocated Processors
-                                if (sscanf(item.c_str(), "%d", &num_nodes) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid number of processors '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                break;
-                            case 5:// Average CPU time Used
-                                break;
-                            case 6: // Used Memory
-                                break;
-                            case 7: // Requested Number of Processors
-                                if (sscanf(item.c_str(), "%d", &requested_num_nodes) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested number of processors '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                break;
-                            case 8: // Requested time
-                                //assuming flops and runtime are the same (in seconds)
-                                if (sscanf(item.c_str(), "%lf", &requested_time) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested time '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                break;
-                            case 9: // Requested memory
-                                // In KiB
-                                if (sscanf(item.c_str(), "%lf", &requested_ram) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested memory '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                requested_ram *= 1024.0;
-                                break;
-                            case 10: // Status
-                                break;
-                            case 11: // User ID
-                                break;
-                            case 12: // Group ID
-                                break;
-                            case 13: // Executable number
-                                break;
-                            case 14: // Queue number
-                                break;
-                            case 15: // Partition number
-                                break;
-                            case 16: // Preceding job number
-                                break;
-                            case 17: // Think time
-                                break;
-                            default:
-                                throw std::invalid_argument(
-                                        "TraceFileLoader::loadFromTraceFileSWF(): Unknown batch workload trace file column, maybe there are more than 18 columns?"
-                                );
-                        }
-                        itemnum++;
-                    }
-
-                    // Fix/check values
-                    if (requested_time < 0) {
-                        requested_time = time;
-                    } else if (time < 0) {
-                        time = requested_time;
-                    }
-                    if ((requested_time < 0) or (time < 0)) {
-                        throw std::invalid_argument(
-                                "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative flops (" +
-                                std::to_string(time) + ") and negative requested flops ("+ std::to_string(requested_time) + ") in batch workload trace file");
-                    }
-                    if (requested_time < time) {
-                        WRENCH_WARN(
-                                "TraceFileLoader::loadFromTraceFileSWF(): invalid job with requested time (%lf) smaller than actual time (%lf) in batch workload trace file [fixing it]", requested_time, time);
-                        requested_time = time;
-                    }
-
-                    if (requested_ram < 0) {
-                        requested_ram = 0;
-                    }
+        // Split the file into chunks, at line boundaries
+        if (num_threads == 0) {
+            num_threads = std::max<unsigned long>(1, std::thread::hardware_concurrency());
+        }
+        unsigned long num_chunks = std::max<unsigned long>(1, std::min<unsigned long>(num_threads, size / SWF_MIN_CHUNK_SIZE));
+        std::vector<SWFChunk> chunks(num_chunks);
+        const char *chunk_begin = begin;
+        for (unsigned long i = 0; i < num_chunks; i++) {
+            const char *chunk_end = (i == num_chunks - 1) ? end : std::max(chunk_begin, begin + (size * (i + 1)) / num_chunks);
+            if (chunk_end < end) {
+                chunk_end = std::min(end, findSWFLineEnd(chunk_end, end) + 1);
+            }
+            chunks[i].begin = chunk_begin;
+            chunks[i].end = chunk_end;
+            chunk_begin = chunk_end;
+        }
 
-                    if (sub_time < 0) {
-                        throw std::invalid_argument(
-                                "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative submission time in batch workload trace file");
-                    }
-                    if (requested_num_nodes <= 0) {
-                        requested_num_nodes = num_nodes;
-                    }
-                    if (requested_num_nodes <= 0) {
-                        throw std::invalid_argument(
-                                "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative (requested) number of node in batch workload trace file");
-                    }
-                } catch (std::invalid_argument &e) {
-                    if (ignore_invalid_jobs) {
-                        WRENCH_WARN("%s (in batch workload file %s) IGNORING", e.what(), filename.c_str());
-                        continue;
-                    } else {
-                        throw std::invalid_argument("Error while reading batch workload trace file " + filename + ": " +  e.what());
-                    }
-                }
+        // Parse all chunks
+        if (num_chunks == 1) {
+            parseSWFChunk(&chunks[0], filename, ignore_invalid_jobs, desired_submit_time_of_first_job,
+                          original_submit_time_of_first_job, trace_file_jobs != nullptr);
+        } else {
+            std::vector<std::thread> threads;
+            for (auto &chunk : chunks) {
+                threads.emplace_back(parseSWFChunk, &chunk, std::cref(filename), ignore_invalid_jobs,
+                                     desired_submit_time_of_first_job, original_submit_time_of_first_job,
+                                     trace_file_jobs != nullptr);
+            }
+            for (auto &t : threads) {
+                t.join();
+            }
+        }
+        if (mapping) {
+            munmap(mapping, size);
+        }
 
-                // Add the job to the list
-                std::tuple<std::string, double, double, double, double, unsigned int> job =
-                        std::tuple<std::string, double, double, double, double, unsigned int>(
-                                id, sub_time, time, requested_time, requested_ram,
-                                (unsigned int) requested_num_nodes);
-                trace_file_jobs.push_back(job);
+        // Merge the results in file order
+        unsigned long num_jobs = 0;
+        if (trace_file_jobs) {
+            unsigned long total_num_jobs = 0;
+            for (auto const &chunk : chunks) {
+                total_num_jobs += chunk.num_jobs;
             }
+            trace_file_jobs->reserve(trace_file_jobs->size() + total_num_jobs);
         }
-        return trace_file_jobs;
+        for (auto &chunk : chunks) {
+            for (auto const &warning : chunk.warnings) {
+                WRENCH_WARN("%s", warning.c_str());
+            }
+            if (chunk.failed) {
+                throw std::invalid_argument(chunk.error);
+            }
+            if (trace_file_jobs) {
+                std::move(chunk.jobs.begin(), chunk.jobs.end(), std::back_inserter(*trace_file_jobs));
+            }
+            num_jobs += chunk.num_jobs;
+        }
+        return num_jobs;
     }
 
     /**
@@ -370,4 +629,73 @@ namespace wrench {
 
         return trace_file_jobs;
     }
+
+    /**
+     * @brief Constructor
+     *
+     * @param filename: the path to the trace file in SWF format or in JSON format
+     * @param ignore_invalid_jobs: whether to ignore (silently) invalid job specifications
+     * @param desired_submit_time_of_first_job: the desired submit of of the first job (-1 means "use whatever time is in the trace file")
+     *
+     * @throw std::invalid_argument
+     */
+    TraceFileReader::TraceFileReader(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job) :
+            filename(filename), ignore_invalid_jobs(ignore_invalid_jobs),
+            desired_submit_time_of_first_job(desired_submit_time_of_first_job) {
+
+        if (TraceFileLoader::getTraceFileExtension(filename) == "swf") {
+            this->mapping = mapTraceFile(filename, this->mapping_size);
+            this->cursor = (const char *) this->mapping;
+            this->end = this->cursor + this->mapping_size;
+            this->original_submit_time_of_first_job = findSWFSubmitTimeOfFirstJob(this->cursor, this->end);
+        } else {
+            this->json_jobs = TraceFileLoader::loadFromTraceFileJSON(filename, ignore_invalid_jobs,
+                                                                     desired_submit_time_of_first_job);
+        }
+    }
+
+    /**
+     * @brief Destructor
+     */
+    TraceFileReader::~TraceFileReader() {
+        if (this->mapping) {
+            munmap(this->mapping, this->mapping_size);
+        }
+    }
+
+    /**
+     * @brief Get the next job in the trace file
+     *
+     * @param job: the job description to fill in (see TraceFileLoader::loadFromTraceFile())
+     * @return true if a job was read, false if the end of the trace file was reached
+     *
+     * @throw std::invalid_argument
+     */
+    bool TraceFileReader::getNextJob(std::tuple<std::string, double, double, double, double, unsigned int> &job) {
+
+        if (this->mapping == nullptr) {
+            if (this->next_json_job >= this->json_jobs.size()) {
+                return false;
+            }
+            job = std::move(this->json_jobs[this->next_json_job++]);
+            return true;
+        }
+
+        while (this->cursor < this->end) {
+            const char *line = this->cursor;
+            const char *eol = findSWFLineEnd(line, this->end);
+            this->cursor = eol + 1;
+            if (*line == ';') continue;
+            try {
+                parseSWFLine(line, eol, this->filename, this->desired_submit_time_of_first_job,
+                             this->original_submit_time_of_first_job, &job, nullptr);
+                return true;
+            } catch (std::invalid_argument &e) {
+                if (not this->ignore_invalid_jobs) {
+                    throw std::invalid_argument("Error while reading batch workload trace file " + this->filename + ": " +  e.what());
+                }
+            }
+        }
+        return false;
+    }
 }
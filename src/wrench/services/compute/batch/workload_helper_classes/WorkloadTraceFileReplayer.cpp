@@ -9,10 +9,11 @@
 
 
 #include <wrench/simgrid_S4U_util/S4U_Simulation.h>
+#include <wrench/simgrid_S4U_util/S4U_Mailbox.h>
 #include <wrench/services/compute/batch/BatchComputeService.h>
+#include <wrench/services/compute/batch/BatchComputeServiceMessage.h>
 #include <wrench-dev.h>
 #include "WorkloadTraceFileReplayer.h"
-#include "WorkloadTraceFileReplayerEventReceiver.h"
 
 WRENCH_LOG_CATEGORY(wrench_core_workload_trace_file_replayer, "Log category for Trace File Replayer");
 
@@ -24,20 +25,18 @@ namespace wrench {
      * @param batch_service: the batch service to which it submits jobs
      * @param num_cores_per_node: the number of cores per host on the batch service
      * @param use_actual_runtimes_as_requested_runtimes: if true, use actual runtimes as requested runtimes
-     * @param workload_trace: the workload trace to be replayed
+     * @param workload_trace_reader: the reader of the workload trace to be replayed
      */
     WorkloadTraceFileReplayer::WorkloadTraceFileReplayer(std::string hostname,
                                                          std::shared_ptr<BatchComputeService> batch_service,
                                                          unsigned long num_cores_per_node,
                                                          bool use_actual_runtimes_as_requested_runtimes,
-                                                         std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> &workload_trace
+                                                         std::shared_ptr<TraceFileReader> workload_trace_reader
     ) :
-            WMS(nullptr, nullptr,
-                {batch_service}, {},
-                {},
-                nullptr, hostname,
-                "workload_tracefile_replayer"),
-            workload_trace(workload_trace),
+            Service(hostname,
+                    "workload_tracefile_replayer",
+                    "workload_tracefile_replayer"),
+            workload_trace_reader(std::move(workload_trace_reader)),
             batch_service(batch_service),
             num_cores_per_node(num_cores_per_node),
             use_actual_runtimes_as_requested_runtimes(use_actual_runtimes_as_requested_runtimes) {}
@@ -45,31 +44,15 @@ namespace wrench {
 
     int WorkloadTraceFileReplayer::main() {
 
-        // Create a Job Manager
-        std::shared_ptr<JobManager> job_manager = this->createJobManager();
-
-        // Create and handle a bogus workflow
-        auto workflow = new Workflow();
-        this->addWorkflow(workflow);
-
-        // Create the dual WMS that will just receive workflow execution events so that I don't have to
-        std::shared_ptr<WorkloadTraceFileReplayerEventReceiver> event_receiver = std::shared_ptr<WorkloadTraceFileReplayerEventReceiver>(
-                new WorkloadTraceFileReplayerEventReceiver(this->hostname, job_manager));
-
-        // Start the WorkloadTraceFileReplayerEventReceiver
-        event_receiver->addWorkflow(workflow, S4U_Simulation::getClock());
-        event_receiver->simulation = this->simulation;
-        event_receiver->start(event_receiver, true, false); // Daemonized, no auto-restart
-
-        double core_flop_rate = (*(this->batch_service->getCoreFlopRate().begin())).second;
-
-        unsigned long job_count = 0;
+        unsigned long max_num_nodes = this->batch_service->total_num_of_nodes;
+        double max_ram = Simulation::getHostMemoryCapacity(*(this->batch_service->compute_hosts.begin()));
 
         // Record the start time of the current time (submission times will be just offsets from this time)
         double real_start_time = S4U_Simulation::getClock();
 
         unsigned long counter = 0;
-        for (auto job : this->workload_trace) {
+        std::tuple<std::string, double, double, double, double, unsigned int> job;
+        while (this->workload_trace_reader->getNextJob(job)) {
 
             // Sleep until the submission time
             double sub_time = real_start_time + std::get<1>(job);
@@ -79,63 +62,43 @@ namespace wrench {
                 wrench::S4U_Simulation::sleep(sleeptime);
 
             // Get job information
-            std::string job_id = std::get<0>(job);
             double time = std::get<2>(job);
             double requested_time = std::get<3>(job);
             if (this->use_actual_runtimes_as_requested_runtimes) {
                 requested_time = time;
             }
-            double requested_ram = std::get<4>(job);
-            int num_nodes = std::get<5>(job);
-
-            // Create the set of tasks
-            std::vector<WorkflowTask *> to_submit;
-            for (int i = 0; i < num_nodes; i++) {
-                double time_fudge = 1; // 1 second seems to make it all work!
-                double task_flops = num_cores_per_node * (core_flop_rate * std::max<double>(0, time - time_fudge));
-                double parallel_efficiency = 1.0;
-                WorkflowTask *task = workflow->addTask(
-                        this->getName() + "_job_" + std::to_string(job_count) + "_task_" + std::to_string(i),
-                        task_flops,
-                        num_cores_per_node, num_cores_per_node, parallel_efficiency,
-                        requested_ram);
-                to_submit.push_back(task);
-            }
-
-            // Create a Standard Job with only the tasks
-            StandardJob *standard_job;
+            // Capping to ram, silently
+            double requested_ram = std::min<double>(std::get<4>(job), max_ram);
+            // Capping to max number of nodes, silently
+            unsigned long num_nodes = std::min<unsigned long>(std::get<5>(job), max_num_nodes);
+            auto time_in_minutes = (unsigned long) (1 + requested_time / 60); // Time in minutes (note the +1)
+
+            // Create a background batch job (no workflow objects are involved)
+            std::shared_ptr<BatchJob> batch_job;
             try {
-                standard_job = job_manager->createStandardJob(to_submit, {});
+                batch_job = std::shared_ptr<BatchJob>(new BatchJob(this->batch_service->generateUniqueJobID(),
+                                                                   time_in_minutes, num_nodes, this->num_cores_per_node,
+                                                                   time, requested_ram, S4U_Simulation::getClock()));
             } catch (std::invalid_argument &e) {
-                WRENCH_INFO("Couldn't create a standard job: %s (ignoring)", e.what());
+                WRENCH_INFO("Couldn't create a background job: %s (ignoring)", e.what());
                 continue;
             }
-            job_count++;
-
-            // Create the batch-specific argument
-            std::map<std::string, std::string> batch_job_args;
-            batch_job_args["-N"] = std::to_string(num_nodes); // Number of nodes/taks
-            batch_job_args["-t"] = std::to_string(1 + requested_time / 60); // Time in minutes (note the +1)
-            batch_job_args["-c"] = std::to_string(num_cores_per_node); //number of cores per task
-            batch_job_args["-color"] = "green";
 
             // Submit this job to the batch service
-            WRENCH_INFO("#%lu: Submitting a [-N:%s, -t:%s, -c:%s] job",
-                        counter++,
-                        batch_job_args["-N"].c_str(),
-                        batch_job_args["-t"].c_str(),
-                        batch_job_args["-c"].c_str());
+            WRENCH_INFO("#%lu: Submitting a [-N:%lu, -t:%lu, -c:%lu] job",
+                        counter++, num_nodes, time_in_minutes, this->num_cores_per_node);
             try {
-                job_manager->submitJob(standard_job, this->batch_service, batch_job_args);
-            } catch (WorkflowExecutionException &e) {
-                WRENCH_INFO("Couldn't submit a replayed job: %s (ignoring)", e.getCause()->toString().c_str());
+                S4U_Mailbox::dputMessage(this->batch_service->mailbox_name,
+                                         new BatchComputeServiceJobRequestMessage(
+                                                 "", batch_job,
+                                                 this->batch_service->getMessagePayloadValue(
+                                                         BatchComputeServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
+            } catch (std::shared_ptr<NetworkError> &cause) {
+                WRENCH_INFO("Couldn't submit a replayed job: %s (ignoring)", cause->toString().c_str());
             }
 
         }
 
-        // Memory leak: workflow
-        // Not clear how to fix this since we can't delete it until all tasks are completed...
-        // And yet when we get here there are still running tasks...
         return 0;
     }
 
@@ -12,6 +12,7 @@
 #define WRENCH_WORKLOADTRACEFILEREPLAYER_H
 
 #include "wrench/services/Service.h"
+#include "wrench/util/TraceFileLoader.h"
 
 /***********************/
 /** \cond INTERNAL    **/
@@ -22,21 +23,23 @@ namespace wrench {
     class BatchComputeService;
 
     /**
-     * @brief A service that goes through a job submission trace (as loaded
-     * by a TraceFileLoader), and "replays" it on a given BatchComputeService.
+     * @brief A service that goes through a job submission trace (as read, one
+     * job at a time, by a TraceFileReader), and "replays" it on a given BatchComputeService
+     * as background jobs (which are not associated to any workflow and only hold the
+     * resources they are allocated for their runtime).
      */
-    class WorkloadTraceFileReplayer : public WMS {
+    class WorkloadTraceFileReplayer : public Service {
 
     public:
         WorkloadTraceFileReplayer(std::string hostname,
                                   std::shared_ptr<BatchComputeService> batch_service,
                                   unsigned long num_cores_per_node,
                                   bool use_actual_runtimes_as_requested_runtimes,
-                                  std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> &workload_trace
+                                  std::shared_ptr<TraceFileReader> workload_trace_reader
         );
 
     private:
-        std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> &workload_trace;
+        std::shared_ptr<TraceFileReader> workload_trace_reader;
         std::shared_ptr<BatchComputeService> batch_service;
         unsigned long num_cores_per_node;
         bool use_actual_runtimes_as_requested_runtimes;
@@ -8,6 +8,7 @@
  *
  */
 
+#include <algorithm>
 #include <cfloat>
 #include <numeric>
 #include <wrench/workflow/failure_causes/JobTypeNotSupported.h>
@@ -183,6 +184,66 @@ namespace wrench {
         }
     }
 
+    /**
+     * @brief Create several identical BareMetalComputeService VMs with a single request to the service
+     *        (either all VMs are created, or none is)
+     *
+     * @param num_vms: the number of VMs to create
+     * @param num_cores: the number of cores for each VM
+     * @param ram_memory: the RAM memory capacity of each VM
+     * @param property_list: a property list for the BareMetalComputeServices that will run on the VMs ({} means "use all defaults")
+     * @param messagepayload_list: a message payload list for the BareMetalComputeServices that will run on the VMs ({} means "use all defaults")
+     *
+     * @return A list of VM names
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::invalid_argument
+     * @throw std::runtime_error
+     */
+    std::vector<std::string> CloudComputeService::createVMs(unsigned long num_vms,
+                                                            unsigned long num_cores,
+                                                            double ram_memory,
+                                                            std::map<std::string, std::string> property_list,
+                                                            std::map<std::string, double> messagepayload_list) {
+
+        if (num_vms == 0) {
+            throw std::invalid_argument(
+                    "CloudComputeService::createVMs(): the number of VMs should be greater than 0");
+        }
+        if (num_cores == ComputeService::ALL_CORES) {
+            throw std::invalid_argument(
+                    "CloudComputeService::createVMs(): the VMs' number of cores cannot be ComputeService::ALL_CORES");
+        }
+        if (ram_memory == ComputeService::ALL_RAM) {
+            throw std::invalid_argument(
+                    "CloudComputeService::createVMs(): the VMs' memory requirement cannot be ComputeService::ALL_RAM");
+        }
+
+        assertServiceIsUp();
+
+        // send a "create vms" message to the daemon's mailbox_name
+        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("create_vms");
+
+        std::shared_ptr<SimulationMessage> answer_message = sendRequest(
+                answer_mailbox,
+                new CloudComputeServiceCreateVMsRequestMessage(
+                        answer_mailbox,
+                        num_vms, num_cores, ram_memory, property_list, messagepayload_list,
+                        this->getMessagePayloadValue(
+                                CloudComputeServiceMessagePayload::CREATE_VM_REQUEST_MESSAGE_PAYLOAD)));
+
+        if (auto msg = std::dynamic_pointer_cast<CloudComputeServiceCreateVMsAnswerMessage>(answer_message)) {
+            if (not msg->success) {
+                throw WorkflowExecutionException(msg->failure_cause);
+            } else {
+                return msg->vm_names;
+            }
+        } else {
+            throw std::runtime_error(
+                    "CloudComputeService::createVMs(): Unexpected [" + answer_message->getName() + "] message");
+        }
+    }
+
     /**
      * @brief Shutdown an active VM
      *
@@ -530,6 +591,8 @@ namespace wrench {
                     this->hostname.c_str(),
                     this->mailbox_name.c_str());
 
+        this->indexExecutionHosts();
+
         /** Main loop **/
         while (this->processNextMessage()) {
             // no specific action
@@ -624,6 +687,11 @@ namespace wrench {
                             msg->messagepayload_list);
             return true;
 
+        } else if (auto msg = std::dynamic_pointer_cast<CloudComputeServiceCreateVMsRequestMessage>(message)) {
+            processCreateVMs(msg->answer_mailbox, msg->num_vms, msg->num_cores, msg->ram_memory, msg->property_list,
+                             msg->messagepayload_list);
+            return true;
+
         } else if (auto msg = std::dynamic_pointer_cast<CloudComputeServiceShutdownVMRequestMessage>(message)) {
             processShutdownVM(msg->answer_mailbox, msg->vm_name);
             return true;
@@ -710,17 +778,7 @@ namespace wrench {
         CloudComputeServiceCreateVMAnswerMessage *msg_to_send_back;
 
         // Check that there is at least one physical host that could support the VM
-        bool found_a_host = false;
-        for (auto const &host : this->execution_hosts) {
-            auto total_num_cores = Simulation::getHostNumCores(host);
-            auto total_ram = Simulation::getHostMemoryCapacity(host);
-            if ((requested_num_cores <= total_num_cores) and (requested_ram <= total_ram)) {
-                found_a_host = true;
-                break;
-            }
-        }
-
-        if (not found_a_host) {
+        if (not this->canAccommodateVM(requested_num_cores, requested_ram)) {
             WRENCH_INFO("Not host on this service can accommodate this VM");
             std::string empty = std::string();
             msg_to_send_back =
@@ -733,18 +791,7 @@ namespace wrench {
                                     CloudComputeServiceMessagePayload::CREATE_VM_ANSWER_MESSAGE_PAYLOAD));
         } else {
 
-            // Pick a VM name (and being paranoid about mistakenly picking an actual hostname!)
-            std::string vm_name = "";
-
-            if (desired_vm_name.empty()) {
-                do {
-                    vm_name = this->getName() + "_vm" + std::to_string(CloudComputeService::VM_ID++);
-                } while (S4U_Simulation::hostExists(vm_name));
-            } else {
-                if (this->vm_list.find(desired_vm_name) == this->vm_list.end()) {
-                    vm_name = desired_vm_name;
-                }
-            }
+            std::string vm_name = this->pickVMName(desired_vm_name);
 
             if (vm_name.empty()) {
                 std::string empty = std::string();
@@ -783,6 +830,91 @@ namespace wrench {
         return;
     }
 
+    /**
+     * @brief Create several identical BareMetalComputeService VMs (either all VMs are created, or none is)
+     *
+     * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param num_vms: the number of VMs to create
+     * @param requested_num_cores: the number of cores of each VM
+     * @param requested_ram: the RAM capacity of each VM
+     * @param property_list: a property list for the BareMetalComputeServices that will run on the VMs ({} means "use all defaults")
+     * @param messagepayload_list: a message payload list for the BareMetalComputeServices that will run on the VMs ({} means "use all defaults")
+     */
+    void CloudComputeService::processCreateVMs(const std::string &answer_mailbox,
+                                               unsigned long num_vms,
+                                               unsigned long requested_num_cores,
+                                               double requested_ram,
+                                               std::map<std::string, std::string> property_list,
+                                               std::map<std::string, double> messagepayload_list) {
+
+        WRENCH_INFO("Asked to create %lu VMs with %lu cores and %lf RAM",
+                    num_vms, requested_num_cores, requested_ram);
+
+        CloudComputeServiceCreateVMsAnswerMessage *msg_to_send_back;
+
+        // Check that there is at least one physical host that could support the VMs
+        if (not this->canAccommodateVM(requested_num_cores, requested_ram)) {
+            WRENCH_INFO("No host on this service can accommodate these VMs");
+            msg_to_send_back =
+                    new CloudComputeServiceCreateVMsAnswerMessage(
+                            false,
+                            {},
+                            std::shared_ptr<FailureCause>(
+                                    new NotEnoughResources(nullptr, this->getSharedPtr<CloudComputeService>())),
+                            this->getMessagePayloadValue(
+                                    CloudComputeServiceMessagePayload::CREATE_VM_ANSWER_MESSAGE_PAYLOAD));
+        } else {
+
+            std::vector<std::string> vm_names;
+            vm_names.reserve(num_vms);
+            for (unsigned long i = 0; i < num_vms; i++) {
+                std::string vm_name = this->pickVMName("");
+                auto vm = std::shared_ptr<S4U_VirtualMachine>(
+                        new S4U_VirtualMachine(vm_name, requested_num_cores, requested_ram, property_list,
+                                               messagepayload_list));
+                // Add the VM to the list of VMs, with (for now) a nullptr compute service
+                this->vm_list[vm_name] = std::make_pair(vm, nullptr);
+                vm_names.push_back(vm_name);
+            }
+
+            WRENCH_INFO("Created %lu VMs with %lu cores and %lf RAM",
+                        num_vms, requested_num_cores, requested_ram);
+
+            msg_to_send_back = new CloudComputeServiceCreateVMsAnswerMessage(
+                    true,
+                    vm_names,
+                    nullptr,
+                    this->getMessagePayloadValue(
+                            CloudComputeServiceMessagePayload::CREATE_VM_ANSWER_MESSAGE_PAYLOAD));
+        }
+
+        // Send reply
+        S4U_Mailbox::dputMessage(answer_mailbox, msg_to_send_back);
+    }
+
+    /**
+     * @brief Pick a name for a new VM
+     *
+     * @param desired_vm_name: the desired VM name ("" means "pick a name for me")
+     * @return a VM name, or "" if the desired name is already taken
+     */
+    std::string CloudComputeService::pickVMName(const std::string &desired_vm_name) {
+
+        // Pick a VM name (and being paranoid about mistakenly picking an actual hostname!)
+        std::string vm_name = "";
+
+        if (desired_vm_name.empty()) {
+            do {
+                vm_name = this->getName() + "_vm" + std::to_string(CloudComputeService::VM_ID++);
+            } while (S4U_Simulation::hostExists(vm_name));
+        } else {
+            if (this->vm_list.find(desired_vm_name) == this->vm_list.end()) {
+                vm_name = desired_vm_name;
+            }
+        }
+        return vm_name;
+    }
+
     /**
      * @brief: Process a VM shutdown request
      *
@@ -810,7 +942,6 @@ namespace wrench {
                             CloudComputeServiceMessagePayload::SHUTDOWN_VM_ANSWER_MESSAGE_PAYLOAD));
         } else {
 
-            std::string pm = vm->getPhysicalHostname();
             // Stop the Compute Service
             cs->stop();
             // We do not shut down the VM. This will be done when the CloudComputeService is notified
@@ -818,8 +949,7 @@ namespace wrench {
             vm->shutdown();
 
             // Update internal data structures
-            this->used_ram_per_execution_host[pm] -= vm->getMemory();
-            this->used_cores_per_execution_host[pm] -= vm->getNumCores();
+            this->releaseVMResources(vm_name);
 
             msg_to_send_back = new CloudComputeServiceShutdownVMAnswerMessage(
                     true,
@@ -837,96 +967,211 @@ namespace wrench {
      *        available RAM using one of the several resource allocation algorithms.
      * @param desired_num_cores: desired number of cores
      * @param desired_ram: desired amount of RAM
-     * @oaram desired_host: name of a desired host ("" if none)
-     * @return
+     * @param desired_host: name of a desired host ("" if none)
+     * @return a hostname, or "" if no host can accommodate the request
      */
     std::string
     CloudComputeService::findHost(unsigned long desired_num_cores, double desired_ram, std::string desired_host) {
-        // Find a physical host to start the VM
-        std::vector<std::string> possible_hosts;
-        for (auto const &host : this->execution_hosts) {
 
-
-            if ((not desired_host.empty()) and (host != desired_host)) {
-                continue;
+        if (not desired_host.empty()) {
+            auto capacity = this->execution_host_capacities.find(desired_host);
+            if ((capacity == this->execution_host_capacities.end()) or (not this->isHostUsable(desired_host))) {
+                return "";
             }
-
-            // Check that host is up
-            if (not Simulation::isHostOn(host)) {
-                continue;
+            auto available_ram = capacity->second.ram - this->used_ram_per_execution_host[desired_host];
+            auto num_available_cores = capacity->second.num_cores - this->used_cores_per_execution_host[desired_host];
+            if ((desired_ram > available_ram) or (desired_num_cores > num_available_cores)) {
+                return "";
             }
+            return desired_host;
+        }
 
-            // Check that host has a non-zero compute speed
-            if (Simulation::getHostFlopRate(host) <= 0) {
-                continue;
+        std::string vm_resource_allocation_algorithm = this->getPropertyValueAsString(
+                CloudComputeServiceProperty::VM_RESOURCE_ALLOCATION_ALGORITHM);
+
+        if (vm_resource_allocation_algorithm == "first-fit") {
+            // Descend the segment tree towards the leftmost host that fits
+            return this->findFirstFitHost(1, desired_num_cores, desired_ram);
+
+        } else if (vm_resource_allocation_algorithm == "best-fit-ram-first") {
+            // The host with the least available RAM that fits (and then the fewest available cores)
+            for (auto it = this->hosts_by_available_ram.lower_bound(std::make_tuple(desired_ram, 0UL, std::string()));
+                 it != this->hosts_by_available_ram.end(); ++it) {
+                if ((std::get<1>(*it) >= desired_num_cores) and this->isHostUsable(std::get<2>(*it))) {
+                    return std::get<2>(*it);
+                }
             }
 
-            // Check for RAM
-            auto total_ram = Simulation::getHostMemoryCapacity(host);
-            auto available_ram = total_ram - this->used_ram_per_execution_host[host];
-            if (desired_ram > available_ram) {
-                continue;
+        } else if (vm_resource_allocation_algorithm == "best-fit-cores-first") {
+            // The host with the fewest available cores that fit (and then the least available RAM)
+            for (auto it = this->hosts_by_available_cores.lower_bound(
+                    std::make_tuple(desired_num_cores, desired_ram, std::string()));
+                 it != this->hosts_by_available_cores.end(); ++it) {
+                if ((std::get<1>(*it) >= desired_ram) and this->isHostUsable(std::get<2>(*it))) {
+                    return std::get<2>(*it);
+                }
             }
+        }
+
+        return "";
+    }
+
+    /**
+     * @brief A helper method that finds, in the first-fit segment tree, the first host in the execution
+     *        host list that has enough available resources (since a subtree whose maximum available RAM
+     *        and cores fit may not contain any host that fits, this may visit all hosts in the worst case)
+     * @param node: the index of the segment tree node at which to start the search (1 is the root)
+     * @param desired_num_cores: desired number of cores
+     * @param desired_ram: desired amount of RAM
+     * @return a hostname, or "" if no host in the node's subtree can accommodate the request
+     */
+    std::string CloudComputeService::findFirstFitHost(unsigned long node,
+                                                      unsigned long desired_num_cores, double desired_ram) {
+
+        if ((this->first_fit_tree[node].first < desired_ram) or
+            (this->first_fit_tree[node].second < desired_num_cores)) {
+            return "";
+        }
+
+        if (node >= this->first_fit_tree_num_leaves) {
+            auto const &host = this->execution_hosts[node - this->first_fit_tree_num_leaves];
+            return (this->isHostUsable(host) ? host : "");
+        }
+
+        auto host = this->findFirstFitHost(2 * node, desired_num_cores, desired_ram);
+        if (host.empty()) {
+            host = this->findFirstFitHost(2 * node + 1, desired_num_cores, desired_ram);
+        }
+        return host;
+    }
+
+    /**
+     * @brief Determine whether a host can currently run VMs
+     * @param host: the hostname
+     * @return true if the host is on and has a non-zero compute speed
+     */
+    bool CloudComputeService::isHostUsable(const std::string &host) {
+        return Simulation::isHostOn(host) and (Simulation::getHostFlopRate(host) > 0);
+    }
 
-            // Check for cores
-            auto total_num_cores = Simulation::getHostNumCores(host);
-            auto num_available_cores = total_num_cores - this->used_cores_per_execution_host[host];
-            if (desired_num_cores > num_available_cores) {
+    /**
+     * @brief Determine whether at least one execution host has enough total capacity to run a VM
+     * @param num_cores: the VM's number of cores
+     * @param ram: the VM's RAM capacity
+     * @return true or false
+     */
+    bool CloudComputeService::canAccommodateVM(unsigned long num_cores, double ram) {
+        // The first host with at least that much RAM is paired with the largest number of cores
+        // of any such host
+        auto it = std::lower_bound(this->largest_host_capacities.begin(), this->largest_host_capacities.end(),
+                                   std::make_pair(ram, 0UL));
+        return (it != this->largest_host_capacities.end()) and (it->second >= num_cores);
+    }
+
+    /**
+     * @brief Build the capacity index of the execution hosts from their total capacities
+     *        and from the resources currently used by VMs
+     */
+    void CloudComputeService::indexExecutionHosts() {
+
+        this->execution_host_capacities.clear();
+        this->hosts_by_available_ram.clear();
+        this->hosts_by_available_cores.clear();
+        this->largest_host_capacities.clear();
+
+        this->first_fit_tree_num_leaves = 1;
+        while (this->first_fit_tree_num_leaves < this->execution_hosts.size()) {
+            this->first_fit_tree_num_leaves *= 2;
+        }
+        // Nodes that correspond to no (or to a duplicate) host can never fit
+        this->first_fit_tree.assign(2 * this->first_fit_tree_num_leaves, std::make_pair(-1.0, 0UL));
+
+        for (unsigned long i = 0; i < this->execution_hosts.size(); i++) {
+            auto const &host = this->execution_hosts[i];
+            if (this->execution_host_capacities.find(host) != this->execution_host_capacities.end()) {
                 continue;
             }
-
-            possible_hosts.push_back(host);
+            HostCapacity capacity;
+            capacity.position = i;
+            capacity.num_cores = Simulation::getHostNumCores(host);
+            capacity.ram = Simulation::getHostMemoryCapacity(host);
+            this->execution_host_capacities[host] = capacity;
+            this->largest_host_capacities.emplace_back(capacity.ram, capacity.num_cores);
+            this->updateHostResourceUsage(host, 0, 0, true);
         }
 
-        // Did we find a viable host?
-        if (possible_hosts.empty()) {
-            return "";
+        std::sort(this->largest_host_capacities.begin(), this->largest_host_capacities.end());
+        for (long i = (long) this->largest_host_capacities.size() - 2; i >= 0; i--) {
+            this->largest_host_capacities[i].second = std::max(this->largest_host_capacities[i].second,
+                                                               this->largest_host_capacities[i + 1].second);
         }
+    }
 
+    /**
+     * @brief Update the resources used on a host and re-index the host
+     * @param host: the hostname
+     * @param num_cores: a number of cores
+     * @param ram: an amount of RAM
+     * @param allocate: true if the resources are allocated, false if they are released
+     */
+    void CloudComputeService::updateHostResourceUsage(const std::string &host, unsigned long num_cores, double ram,
+                                                      bool allocate) {
 
+        auto const &capacity = this->execution_host_capacities.at(host);
+        auto &used_ram = this->used_ram_per_execution_host[host];
+        auto &used_cores = this->used_cores_per_execution_host[host];
 
-        std::string vm_resource_allocation_algorithm = this->getPropertyValueAsString(
-                CloudComputeServiceProperty::VM_RESOURCE_ALLOCATION_ALGORITHM);
-        if (vm_resource_allocation_algorithm == "first-fit") {
-            //don't sort the possible hosts
-        } else if (vm_resource_allocation_algorithm == "best-fit-ram-first") {
-            // Sort the possible hosts to implement best fit (using RAM first)
-            std::sort(possible_hosts.begin(), possible_hosts.end(),
-                      [](std::string const &a, std::string const &b) {
-                          unsigned long a_num_cores = Simulation::getHostNumCores(a);
-                          double a_ram = Simulation::getHostMemoryCapacity(a);
-                          unsigned long b_num_cores = Simulation::getHostNumCores(b);
-                          double b_ram = Simulation::getHostMemoryCapacity(b);
-
-                          if (a_ram != b_ram) {
-                              return a_ram < b_ram;
-                          } else if (a_num_cores < b_num_cores) {
-                              return a_num_cores < b_num_cores;
-                          } else {
-                              return a < b;  // string order
-                          }
-                      });
-        } else if (vm_resource_allocation_algorithm == "best-fit-cores-first") {
-            // Sort the possible hosts to implement best fit (using cores first)
-            std::sort(possible_hosts.begin(), possible_hosts.end(),
-                      [](std::string const &a, std::string const &b) {
-                          unsigned long a_num_cores = Simulation::getHostNumCores(a);
-                          double a_ram = Simulation::getHostMemoryCapacity(a);
-                          unsigned long b_num_cores = Simulation::getHostNumCores(b);
-                          double b_ram = Simulation::getHostMemoryCapacity(b);
-
-                          if (a_num_cores != b_num_cores) {
-                              return a_num_cores < b_num_cores;
-                          } else if (a_ram < b_ram) {
-                              return a_ram < b_ram;
-                          } else {
-                              return a < b;  // string order
-                          }
-                      });
+        this->hosts_by_available_ram.erase(
+                std::make_tuple(capacity.ram - used_ram, capacity.num_cores - used_cores, host));
+        this->hosts_by_available_cores.erase(
+                std::make_tuple(capacity.num_cores - used_cores, capacity.ram - used_ram, host));
+
+        if (allocate) {
+            used_ram += ram;
+            used_cores += num_cores;
+        } else {
+            used_ram -= ram;
+            used_cores -= num_cores;
         }
 
-        auto picked_host = *(possible_hosts.begin());
-        return picked_host;
+        auto available_ram = capacity.ram - used_ram;
+        auto num_available_cores = capacity.num_cores - used_cores;
+        this->hosts_by_available_ram.insert(std::make_tuple(available_ram, num_available_cores, host));
+        this->hosts_by_available_cores.insert(std::make_tuple(num_available_cores, available_ram, host));
+
+        unsigned long node = this->first_fit_tree_num_leaves + capacity.position;
+        this->first_fit_tree[node] = std::make_pair(available_ram, num_available_cores);
+        for (node /= 2; node >= 1; node /= 2) {
+            this->first_fit_tree[node] = std::make_pair(
+                    std::max(this->first_fit_tree[2 * node].first, this->first_fit_tree[2 * node + 1].first),
+                    std::max(this->first_fit_tree[2 * node].second, this->first_fit_tree[2 * node + 1].second));
+        }
+    }
+
+    /**
+     * @brief Charge a VM's resources to a physical host
+     * @param vm_name: the name of the VM
+     * @param pm_name: the name of the physical host
+     */
+    void CloudComputeService::allocateVMResources(const std::string &vm_name, const std::string &pm_name) {
+        auto vm = this->vm_list[vm_name].first;
+        this->updateHostResourceUsage(pm_name, vm->getNumCores(), vm->getMemory(), true);
+        this->vm_resource_allocations[vm_name] = pm_name;
+    }
+
+    /**
+     * @brief Give back the resources charged for a VM to its physical host (does nothing if
+     *        the VM holds no resources, e.g., if they were already released)
+     * @param vm_name: the name of the VM
+     */
+    void CloudComputeService::releaseVMResources(const std::string &vm_name) {
+        auto allocation = this->vm_resource_allocations.find(vm_name);
+        if (allocation == this->vm_resource_allocations.end()) {
+            return;
+        }
+        auto vm = this->vm_list[vm_name].first;
+        this->updateHostResourceUsage(allocation->second, vm->getNumCores(), vm->getMemory(), false);
+        this->vm_resource_allocations.erase(allocation);
     }
 
 
@@ -1005,8 +1250,7 @@ namespace wrench {
                 }
 
                 // Update internal data structures
-                this->used_ram_per_execution_host[picked_host] += vm->getMemory();
-                this->used_cores_per_execution_host[picked_host] += vm->getNumCores();
+                this->allocateVMResources(vm_name, picked_host);
 
                 // Start the service
                 try {
@@ -1149,6 +1393,7 @@ namespace wrench {
                             CloudComputeServiceMessagePayload::DESTROY_VM_ANSWER_MESSAGE_PAYLOAD));
 
         } else {
+            this->releaseVMResources(vm_name);
             this->vm_list.erase(vm_name);
             msg_to_send_back = new CloudComputeServiceDestroyVMAnswerMessage(
                     true,
@@ -1233,32 +1478,16 @@ namespace wrench {
         std::map<std::string, double> ram_availabilities;
 
         for (auto &host : this->execution_hosts) {
+            auto const &capacity = this->execution_host_capacities[host];
             // Total num cores
-            unsigned long total_num_cores = Simulation::getHostNumCores(host);
-            num_cores.insert(std::make_pair(host, (double) total_num_cores));
-            // Idle cores
-            unsigned long num_cores_allocated_to_vms = 0;
-            for (auto &vm_pair : this->vm_list) {
-                auto actual_vm = vm_pair.second.first;
-                if ((actual_vm->getState() != S4U_VirtualMachine::DOWN) and
-                    (actual_vm->getPhysicalHostname() == host)) {
-                    num_cores_allocated_to_vms += actual_vm->getNumCores();
-                }
-            }
-            num_idle_cores.insert(std::make_pair(host, (double) (total_num_cores - num_cores_allocated_to_vms)));
+            num_cores.insert(std::make_pair(host, (double) capacity.num_cores));
+            // Idle cores (running and suspended VMs hold their cores)
+            num_idle_cores.insert(std::make_pair(
+                    host, (double) (capacity.num_cores - this->used_cores_per_execution_host[host])));
             // Total RAM
-            double total_ram = Simulation::getHostMemoryCapacity(host);
-            ram_capacities.insert(std::make_pair(host, total_ram));
+            ram_capacities.insert(std::make_pair(host, capacity.ram));
             // Available RAM
-            double ram_allocated_to_vms = 0;
-            for (auto &vm_pair : this->vm_list) {
-                auto actual_vm = vm_pair.second.first;
-                if ((actual_vm->getState() != S4U_VirtualMachine::DOWN) and
-                    (actual_vm->getPhysicalHostname() == host)) {
-                    ram_allocated_to_vms += actual_vm->getMemory();
-                }
-            }
-            ram_availabilities.insert(std::make_pair(host, total_ram - ram_allocated_to_vms));
+            ram_availabilities.insert(std::make_pair(host, capacity.ram - this->used_ram_per_execution_host[host]));
 
             // Flop rate
             double flop_rate = Simulation::getHostFlopRate(host);
@@ -1303,14 +1532,12 @@ namespace wrench {
                     // WARNING: No the lack of a "break" below which is a hacl
                 case S4U_VirtualMachine::State::RUNNING:
                     // Shut it down
-                    std::string pm = actual_vm->getPhysicalHostname();
                     // Stop the Compute Service
                     cs->stop();
                     // Shutdown the VM
                     actual_vm->shutdown();
                     // Update internal data structures
-                    this->used_ram_per_execution_host[pm] -= actual_vm->getMemory();
-                    this->used_cores_per_execution_host[pm] -= actual_vm->getNumCores();
+                    this->releaseVMResources(vm.first);
                     break;
             }
         }
@@ -1334,17 +1561,11 @@ namespace wrench {
             throw std::runtime_error(
                     "CloudComputeService::processBareMetalComputeServiceTermination(): received a termination notification for an unknown BareMetalComputeService");
         }
-        unsigned long used_cores = this->vm_list[vm_name].first->getNumCores();
-        double used_ram = this->vm_list[vm_name].first->getMemory();
-        std::string pm_name = this->vm_list[vm_name].first->getPhysicalHostname();
-//        WRENCH_INFO("GOT A DEATH NOTIFICATION: %s %ld %lf (exit_code = %d)",
-//                    pm_name.c_str(), used_cores, used_ram, exit_code);
-
         if (this->vm_list[vm_name].first->getState() != S4U_VirtualMachine::State::DOWN) {
             this->vm_list[vm_name].first->shutdown();
         }
-        this->used_cores_per_execution_host[pm_name] -= used_cores;
-        this->used_ram_per_execution_host[pm_name] -= used_ram;
+        // The resources may already have been released, if the VM was shutdown explicitly
+        this->releaseVMResources(vm_name);
         return;
     }
 
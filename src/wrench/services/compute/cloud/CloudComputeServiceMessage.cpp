@@ -104,6 +104,53 @@ namespace wrench {
             CloudComputeServiceMessage("CREATE_VM_ANSWER", payload), success(success), vm_name(vm_name),
             failure_cause(failure_cause) {}
 
+    /**
+     * @brief Constructor
+     *
+     * @param answer_mailbox: the mailbox to which to send the answer
+     * @param num_vms: the number of VMs to create
+     * @param num_cores: the number of cores of each VM
+     * @param ram_memory: the RAM capacity of each VM
+     * @param property_list: a property list for the BareMetalComputeServices that will run on the VMs ({} means "use all defaults")
+     * @param messagepayload_list: a message payload list for the BareMetalComputeServices that will run on the VMs ({} means "use all defaults")
+     * @param payload: the message size in bytes
+     *
+     * @throw std::invalid_argument
+     */
+    CloudComputeServiceCreateVMsRequestMessage::CloudComputeServiceCreateVMsRequestMessage(
+            const std::string &answer_mailbox,
+            unsigned long num_vms,
+            unsigned long num_cores,
+            double ram_memory,
+            std::map<std::string, std::string> property_list,
+            std::map<std::string, double> messagepayload_list,
+            double payload) :
+            CloudComputeServiceMessage("CREATE_VMS_REQUEST", payload),
+            num_vms(num_vms), num_cores(num_cores), ram_memory(ram_memory), property_list(property_list),
+            messagepayload_list(messagepayload_list) {
+
+        if (answer_mailbox.empty() || (num_vms == 0) || (ram_memory < 0.0)) {
+            throw std::invalid_argument(
+                    "CloudComputeServiceCreateVMsRequestMessage::CloudComputeServiceCreateVMsRequestMessage(): Invalid arguments");
+        }
+        this->answer_mailbox = answer_mailbox;
+    }
+
+    /**
+     * @brief Constructor
+     *
+     * @param success: whether the VM creations were successful or not
+     * @param vm_names: the names of the created VMs (if success)
+     * @param failure_cause: the cause of the failure (or nullptr if success)
+     * @param payload: the message size in bytes
+     */
+    CloudComputeServiceCreateVMsAnswerMessage::CloudComputeServiceCreateVMsAnswerMessage(bool success,
+                                                                                         std::vector<std::string> vm_names,
+                                                                                         std::shared_ptr<FailureCause> failure_cause,
+                                                                                         double payload) :
+            CloudComputeServiceMessage("CREATE_VMS_ANSWER", payload), success(success), vm_names(std::move(vm_names)),
+            failure_cause(failure_cause) {}
+
     /**
      * @brief Constructor
      *
@@ -98,6 +98,50 @@ namespace wrench {
         std::shared_ptr<FailureCause> failure_cause;
     };
 
+    /**
+     * @brief A message sent to a CloudComputeService to request the creation of several identical VMs
+     */
+    class CloudComputeServiceCreateVMsRequestMessage : public CloudComputeServiceMessage {
+    public:
+        CloudComputeServiceCreateVMsRequestMessage(const std::string &answer_mailbox,
+                                                   unsigned long num_vms,
+                                                   unsigned long num_cores,
+                                                   double ram_memory,
+                                                   std::map<std::string, std::string> property_list,
+                                                   std::map<std::string, double> messagepayload_list,
+                                                   double payload);
+
+    public:
+        /** @brief The mailbox to which the answer message should be sent */
+        std::string answer_mailbox;
+        /** @brief The number of VMs to create */
+        unsigned long num_vms;
+        /** @brief The number of cores of each VM */
+        unsigned long num_cores;
+        /** @brief The RAM memory capacity of each VM */
+        double ram_memory;
+        /** @brief A property list for the BareMetalComputeServices that will run on the VMs ({} means "use all defaults") */
+        std::map<std::string, std::string> property_list;
+        /** @brief A message payload list for the BareMetalComputeServices that will run on the VMs ({} means "use all defaults") */
+        std::map<std::string, double> messagepayload_list;
+    };
+
+    /**
+     * @brief A message sent by a CloudComputeService in answer to a request for the creation of several VMs
+     */
+    class CloudComputeServiceCreateVMsAnswerMessage : public CloudComputeServiceMessage {
+    public:
+        CloudComputeServiceCreateVMsAnswerMessage(bool success, std::vector<std::string> vm_names,
+                                                  std::shared_ptr<FailureCause> failure_cause, double payload);
+
+        /** @brief Whether the VM creations were successful or not */
+        bool success;
+        /** @brief The VM names if success */
+        std::vector<std::string> vm_names;
+        /** @brief The cause of the failure, or nullptr on success */
+        std::shared_ptr<FailureCause> failure_cause;
+    };
+
     /**
      * @brief A message sent to a CloudComputeService to request a VM shutdown
      */
@@ -61,16 +61,20 @@ namespace wrench {
 
         // Set default and specified message payloads
         this->setMessagePayloads(this->default_messagepayload_values, std::move(messagepayload_list));
+
+        if (this->getPropertyValueAsDouble(HTCondorComputeServiceProperty::NEGOTIATOR_INTERVAL) < 0) {
+            throw std::invalid_argument(
+                    "HTCondorCentralManagerService::HTCondorCentralManagerService(): Invalid NEGOTIATOR_INTERVAL property value");
+        }
     }
 
     /**
      * @brief Destructor
      */
     HTCondorCentralManagerService::~HTCondorCentralManagerService() {
-        this->pending_jobs.clear();
         this->compute_resources.clear();
-        this->compute_resources_map.clear();
         this->running_jobs.clear();
+        this->negotiator = nullptr;
     }
 
     /**
@@ -200,6 +204,14 @@ namespace wrench {
         WRENCH_INFO("HTCondor Service starting on host %s listening on mailbox_name %s",
                     this->hostname.c_str(), this->mailbox_name.c_str());
 
+        // create the negotiator, which will be started once compute resources have been acquired
+        this->negotiator = std::shared_ptr<HTCondorNegotiatorService>(
+                new HTCondorNegotiatorService(
+                        this->hostname,
+                        this->getPropertyValueAsDouble(HTCondorComputeServiceProperty::NEGOTIATOR_INTERVAL),
+                        this->running_jobs, this->mailbox_name));
+        this->negotiator->simulation = this->simulation;
+
         // start the compute resource services
         try {
             for (auto cs : this->compute_resources) {
@@ -218,7 +230,7 @@ namespace wrench {
                         auto vm_cs = virtualized_cluster->startVM(vm_name, host);
                         // set the number of idle cores
                         sum_num_idle_cores = vm_cs->getTotalNumIdleCores();
-                        this->compute_resources_map.insert(std::make_pair(vm_cs, sum_num_idle_cores));
+                        this->negotiator->addComputeResource(vm_cs, sum_num_idle_cores);
                     }
 
                 } else if (auto cloud = dynamic_cast<CloudComputeService *>(cs)) {
@@ -228,7 +240,7 @@ namespace wrench {
 
                     // set the number of available cores
                     sum_num_idle_cores = cs->getTotalNumIdleCores();
-                    this->compute_resources_map.insert(std::make_pair(cs_shared_ptr, sum_num_idle_cores));
+                    this->negotiator->addComputeResource(cs_shared_ptr, sum_num_idle_cores);
                 }
 
             }
@@ -236,21 +248,22 @@ namespace wrench {
             throw std::runtime_error("Unable to acquire compute resources: " + e.getCause()->toString());
         }
 
+        // start the negotiator
+        this->negotiator->start(this->negotiator, true, false); // Daemonized, no auto-restart
+
         // main loop
         while (this->processNextMessage()) {
             if (not this->dispatching_jobs && not this->resources_unavailable) {
 
                 // dispatching standard or pilot jobs
-                if (not this->pending_jobs.empty()) {
+                if (this->negotiator->getNumPendingJobs() > 0) {
 
                     this->dispatching_jobs = true;
-                    auto negotiator = std::shared_ptr<HTCondorNegotiatorService>(
-                            new HTCondorNegotiatorService(this->hostname, this->compute_resources_map,
-                                                          this->running_jobs,
-                                                          this->pending_jobs, this->mailbox_name));
-                    negotiator->simulation = this->simulation;
-                    negotiator->start(negotiator, true, false); // Daemonized, no auto-restart
-
+                    S4U_Mailbox::dputMessage(
+                            this->negotiator->mailbox_name,
+                            new NegotiatorCycleRequestMessage(
+                                    this->getMessagePayloadValue(
+                                            HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_CYCLE_REQUEST_MESSAGE_PAYLOAD)));
                 }
             }
         }
@@ -320,7 +333,7 @@ namespace wrench {
             return true;
 
         } else if (auto msg = std::dynamic_pointer_cast<NegotiatorCompletionMessage>(message)) {
-            processNegotiatorCompletion(msg->scheduled_jobs);
+            processNegotiatorCompletion(msg->scheduled_jobs, msg->cycle_time);
             return true;
 
         } else {
@@ -341,7 +354,7 @@ namespace wrench {
             const std::string &answer_mailbox, StandardJob *job,
             std::map<std::string, std::string> &service_specific_args) {
 
-        this->pending_jobs.push_back(std::make_tuple(job, service_specific_args));
+        this->negotiator->addPendingJob(job, service_specific_args);
         this->resources_unavailable = false;
 
         S4U_Mailbox::dputMessage(
@@ -365,7 +378,7 @@ namespace wrench {
             const std::string &answer_mailbox, PilotJob *job,
             std::map<std::string, std::string> &service_specific_args) {
 
-        this->pending_jobs.push_back(std::make_tuple(job, service_specific_args));
+        this->negotiator->addPendingJob(job, service_specific_args);
         this->resources_unavailable = false;
 
         S4U_Mailbox::dputMessage(
@@ -432,33 +445,24 @@ namespace wrench {
         this->resources_unavailable = false;
 
         auto cs = this->running_jobs.find(job);
-        auto cs_map = this->compute_resources_map.find(cs->second);
-        cs_map->second = cs_map->second + job->getMinimumRequiredNumCores();
-        this->running_jobs.erase(job);
+        this->negotiator->releaseCores(cs->second, job->getMinimumRequiredNumCores());
+        this->running_jobs.erase(cs);
     }
 
     /**
      * @brief Process a negotiator cycle completion
      *
-     * @param scheduled_jobs: list of scheduled jobs upon negotiator cycle completion
+     * @param scheduled_jobs: list of scheduled jobs upon negotiator cycle completion (which the negotiator
+     *        has already removed from its pending jobs)
+     * @param cycle_time: the duration of the negotiation cycle, in seconds
      */
     void HTCondorCentralManagerService::processNegotiatorCompletion(
-            std::vector<wrench::WorkflowJob *> &scheduled_jobs) {
+            std::vector<wrench::WorkflowJob *> &scheduled_jobs, double cycle_time) {
+
+        WRENCH_INFO("Negotiation cycle: %lu matches in %.3lf seconds", scheduled_jobs.size(), cycle_time);
 
         if (scheduled_jobs.empty()) {
             this->resources_unavailable = true;
-            this->dispatching_jobs = false;
-            return;
-        }
-
-        for (auto sjob : scheduled_jobs) {
-            for (auto it = this->pending_jobs.begin(); it != this->pending_jobs.end(); ++it) {
-                auto pjob = std::get<0>(*it);
-                if (sjob == pjob) {
-                    this->pending_jobs.erase(it);
-                    break;
-                }
-            }
         }
 
         this->dispatching_jobs = false;
@@ -469,12 +473,17 @@ namespace wrench {
      */
     void HTCondorCentralManagerService::terminate() {
         this->setStateToDown();
+        if (this->negotiator) {
+            try {
+                this->negotiator->stop();
+            } catch (WorkflowExecutionException &e) {
+                // ignore
+            }
+        }
         for (auto cs : this->compute_resources) {
             cs->stop();
         }
         this->compute_resources.clear();
-        this->compute_resources_map.clear();
-        this->pending_jobs.clear();
         this->running_jobs.clear();
     }
 
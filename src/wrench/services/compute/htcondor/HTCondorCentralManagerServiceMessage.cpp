@@ -24,9 +24,20 @@ namespace wrench {
      * @brief Constructor
      *
      * @param scheduled_jobs: list of pending jobs upon negotiator completion
+     * @param cycle_time: the duration of the negotiation cycle, in seconds
      * @param payload: the message size in bytes
      */
-    NegotiatorCompletionMessage::NegotiatorCompletionMessage(std::vector<WorkflowJob *> scheduled_jobs, double payload)
-            : HTCondorCentralManagerServiceMessage("NEGOTIATOR_DONE", payload), scheduled_jobs(scheduled_jobs) {}
-            
+    NegotiatorCompletionMessage::NegotiatorCompletionMessage(std::vector<WorkflowJob *> scheduled_jobs,
+                                                             double cycle_time, double payload)
+            : HTCondorCentralManagerServiceMessage("NEGOTIATOR_DONE", payload), scheduled_jobs(scheduled_jobs),
+              cycle_time(cycle_time) {}
+
+    /**
+     * @brief Constructor
+     *
+     * @param payload: the message size in bytes
+     */
+    NegotiatorCycleRequestMessage::NegotiatorCycleRequestMessage(double payload)
+            : HTCondorCentralManagerServiceMessage("NEGOTIATOR_CYCLE_REQUEST", payload) {}
+
 }
@@ -11,4 +11,5 @@
 
 namespace wrench {
     SET_MESSAGEPAYLOAD_NAME(HTCondorCentralManagerServiceMessagePayload, HTCONDOR_NEGOTIATOR_DONE_MESSAGE_PAYLOAD);
+    SET_MESSAGEPAYLOAD_NAME(HTCondorCentralManagerServiceMessagePayload, HTCONDOR_NEGOTIATOR_CYCLE_REQUEST_MESSAGE_PAYLOAD);
 }
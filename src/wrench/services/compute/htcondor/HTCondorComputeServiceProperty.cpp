@@ -1,5 +1,5 @@
 /**
- * Copyright (c) 2017. The WRENCH Team.
+ * Copyright (c) 2017-2020. The WRENCH Team.
  *
  * This program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -7,10 +7,10 @@
  * (at your option) any later version.
  */
 
-#include "wrench/services/helpers/HostStateChangeDetectorProperty.h"
+#include "wrench/services/compute/htcondor/HTCondorComputeServiceProperty.h"
 
 namespace wrench {
 
-    SET_PROPERTY_NAME(HostStateChangeDetectorProperty, MONITORING_PERIOD);
+    SET_PROPERTY_NAME(HTCondorComputeServiceProperty, NEGOTIATOR_INTERVAL);
 
-};
+}
@@ -7,6 +7,8 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
+
 #include "wrench/logging/TerminalOutput.h"
 #include "wrench/services/compute/htcondor/HTCondorCentralManagerServiceMessage.h"
 #include "wrench/services/compute/htcondor/HTCondorCentralManagerServiceMessagePayload.h"
@@ -26,19 +28,22 @@ namespace wrench {
      * @brief Constructor
      *
      * @param hostname: the hostname on which to start the service
-     * @param compute_resources: a set of compute resources available via the HTCondor pool
-     * @param running_jobs:
-     * @param pending_jobs: a list of pending jobs
+     * @param negotiator_interval: the minimum time, in seconds, between the starts of two negotiation cycles
+     * @param running_jobs: the running jobs, which are updated when jobs are dispatched
      * @param reply_mailbox: the mailbox to which the "done/failed" message should be sent
      */
     HTCondorNegotiatorService::HTCondorNegotiatorService(
             std::string &hostname,
-            std::map<std::shared_ptr<ComputeService>, unsigned long> &compute_resources,
+            double negotiator_interval,
             std::map<WorkflowJob *, std::shared_ptr<ComputeService>> &running_jobs,
-            std::vector<std::tuple<WorkflowJob *, std::map<std::string, std::string>>> &pending_jobs,
             std::string &reply_mailbox)
             : Service(hostname, "htcondor_negotiator", "htcondor_negotiator"), reply_mailbox(reply_mailbox),
-              compute_resources(&compute_resources), running_jobs(&running_jobs), pending_jobs(pending_jobs) {
+              negotiator_interval(negotiator_interval), running_jobs(&running_jobs) {
+
+        if (negotiator_interval < 0) {
+            throw std::invalid_argument(
+                    "HTCondorNegotiatorService::HTCondorNegotiatorService(): Invalid negotiator interval");
+        }
 
         this->setMessagePayloads(this->default_messagepayload_values, messagepayload_list);
     }
@@ -47,21 +52,103 @@ namespace wrench {
      * @brief Destructor
      */
     HTCondorNegotiatorService::~HTCondorNegotiatorService() {
-        this->pending_jobs.clear();
+        this->clear();
+    }
+
+    /**
+     * @brief Compare the priority between two pending jobs
+     *
+     * @param lhs: a pending job
+     * @param rhs: a pending job
+     *
+     * @return whether the left-hand-side pending job should be dispatched first (i.e., it
+     *         has a higher priority, or the same priority and was submitted earlier)
+     */
+    bool HTCondorNegotiatorService::PendingJobComparator::operator()(const PendingJob &lhs,
+                                                                      const PendingJob &rhs) const {
+        if (lhs.priority != rhs.priority) {
+            return lhs.priority > rhs.priority;
+        }
+        return lhs.sequence_number < rhs.sequence_number;
     }
 
     /**
-     * @brief Compare the priority between two workflow jobs
+     * @brief Add a compute resource to the pool
      *
-     * @param lhs: pointer to a workflow job
-     * @param rhs: pointer to a workflow job
+     * @param compute_resource: the compute resource
+     * @param num_idle_cores: its number of idle cores
+     */
+    void HTCondorNegotiatorService::addComputeResource(const std::shared_ptr<ComputeService> &compute_resource,
+                                                       unsigned long num_idle_cores) {
+        if (compute_resource->supportsPilotJobs()) {
+            this->pilot_job_compute_resources.push_back(compute_resource);
+        }
+        this->setNumIdleCores(compute_resource, num_idle_cores);
+    }
+
+    /**
+     * @brief Release cores of a compute resource (e.g., because a job has completed)
+     *
+     * @param compute_resource: the compute resource
+     * @param num_cores: the number of released cores
+     */
+    void HTCondorNegotiatorService::releaseCores(const std::shared_ptr<ComputeService> &compute_resource,
+                                                 unsigned long num_cores) {
+        auto it = this->num_idle_cores.find(compute_resource);
+        if (it == this->num_idle_cores.end()) {
+            return;
+        }
+        this->setNumIdleCores(compute_resource, it->second + num_cores);
+    }
+
+    /**
+     * @brief Add a job to the pending jobs
      *
-     * @return whether the priority of the left-hand-side workflow job is higher
+     * @param job: the job
+     * @param service_specific_args: the service-specific arguments
      */
-    bool HTCondorNegotiatorService::JobPriorityComparator::operator()(
-            std::tuple<WorkflowJob *, std::map<std::string, std::string>> &lhs,
-            std::tuple<WorkflowJob *, std::map<std::string, std::string>> &rhs) {
-        return std::get<0>(lhs)->getPriority() > std::get<0>(rhs)->getPriority();
+    void HTCondorNegotiatorService::addPendingJob(WorkflowJob *job,
+                                                  const std::map<std::string, std::string> &service_specific_args) {
+        this->pending_jobs.insert(PendingJob{job->getPriority(), this->num_submitted_jobs++, job, service_specific_args});
+    }
+
+    /**
+     * @brief Get the number of pending jobs
+     *
+     * @return a number of jobs
+     */
+    unsigned long HTCondorNegotiatorService::getNumPendingJobs() {
+        return this->pending_jobs.size();
+    }
+
+    /**
+     * @brief Forget all pending jobs and compute resources
+     */
+    void HTCondorNegotiatorService::clear() {
+        this->pending_jobs.clear();
+        this->num_idle_cores.clear();
+        this->idle_cores_index.clear();
+        this->pilot_job_compute_resources.clear();
+    }
+
+    /**
+     * @brief Set the number of idle cores of a compute resource, keeping the idle core index up to date
+     *
+     * @param compute_resource: the compute resource
+     * @param num_idle_cores: its number of idle cores
+     */
+    void HTCondorNegotiatorService::setNumIdleCores(const std::shared_ptr<ComputeService> &compute_resource,
+                                                    unsigned long num_idle_cores) {
+        auto it = this->num_idle_cores.find(compute_resource);
+        if (it != this->num_idle_cores.end()) {
+            this->idle_cores_index.erase(std::make_pair(it->second, compute_resource));
+            it->second = num_idle_cores;
+        } else {
+            this->num_idle_cores.insert(std::make_pair(compute_resource, num_idle_cores));
+        }
+        if (compute_resource->supportsStandardJobs()) {
+            this->idle_cores_index.insert(std::make_pair(num_idle_cores, compute_resource));
+        }
     }
 
     /**
@@ -76,79 +163,153 @@ namespace wrench {
         WRENCH_INFO("HTCondor Negotiator Service starting on host %s listening on mailbox_name %s",
                     this->hostname.c_str(), this->mailbox_name.c_str());
 
-        std::vector<WorkflowJob *> scheduled_jobs;
+        while (true) {
+            double timeout = -1.0;
+            if (this->cycle_requested) {
+                timeout = std::max<double>(0, this->next_cycle_date - S4U_Simulation::getClock());
+                if (timeout == 0) {
+                    this->cycle_requested = false;
+                    this->runNegotiationCycle();
+                    continue;
+                }
+            }
+            if (not this->processNextMessage(timeout)) {
+                break;
+            }
+        }
 
-        // sort tasks by priority
-        std::sort(this->pending_jobs.begin(), this->pending_jobs.end(), JobPriorityComparator());
+        WRENCH_INFO("HTCondorNegotiator Service on host %s cleanly terminating!",
+                    S4U_Simulation::getHostName().c_str());
+        return 0;
+    }
 
-        for (auto entry : this->pending_jobs) {
+    /**
+     * @brief Wait for and react to any incoming message
+     *
+     * @param timeout: a timeout in seconds (<0 means never timeout)
+     *
+     * @return false if the daemon should terminate, true otherwise
+     *
+     * @throw std::runtime_error
+     */
+    bool HTCondorNegotiatorService::processNextMessage(double timeout) {
 
-            auto job = std::get<0>(entry);
-            auto service_specific_arguments = std::get<1>(entry);
+        std::shared_ptr<SimulationMessage> message = nullptr;
 
-            // STANDARD JOB
-            if (auto standard_job = dynamic_cast<StandardJob *>(job)) {
-                for (auto &item : *this->compute_resources) {
+        try {
+            message = S4U_Mailbox::getMessage(this->mailbox_name, timeout);
+        } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+        }
 
-                    if (not item.first->supportsStandardJobs()) {
-                        continue;
-                    }
+        WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
 
-                    if (item.second >= standard_job->getMinimumRequiredNumCores()) {
+        if (auto msg = std::dynamic_pointer_cast<ServiceStopDaemonMessage>(message)) {
+            this->clear();
+            // This is Synchronous
+            try {
+                S4U_Mailbox::putMessage(
+                        msg->ack_mailbox,
+                        new ServiceDaemonStoppedMessage(
+                                this->getMessagePayloadValue(
+                                        HTCondorCentralManagerServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+            } catch (std::shared_ptr<NetworkError> &cause) {
+                return false;
+            }
+            return false;
 
-                        WRENCH_INFO("Dispatching job %s with %ld tasks", standard_job->getName().c_str(),
-                                    standard_job->getTasks().size());
+        } else if (auto msg = std::dynamic_pointer_cast<NegotiatorCycleRequestMessage>(message)) {
+            this->cycle_requested = true;
+            return true;
 
-                        for (auto task : standard_job->getTasks()) {
-                            // temporary printing task IDs
-                            WRENCH_INFO("    Task ID: %s", task->getID().c_str());
-                        }
+        } else {
+            throw std::runtime_error("HTCondorNegotiatorService::processNextMessage(): Unexpected [" +
+                                     message->getName() + "] message");
+        }
+    }
 
-                        WRENCH_INFO("---> %lu", service_specific_arguments.size());
+    /**
+     * @brief Perform a negotiation cycle, i.e., dispatch pending jobs in priority order to
+     *        compute resources that can accommodate them, and notify the central manager
+     */
+    void HTCondorNegotiatorService::runNegotiationCycle() {
 
-                        standard_job->pushCallbackMailbox(this->reply_mailbox);
-                        item.first->submitStandardJob(standard_job, service_specific_arguments);
-                        this->running_jobs->insert(std::make_pair(job, item.first));
-                        scheduled_jobs.push_back(job);
-                        item.second -= standard_job->getMinimumRequiredNumCores();
+        double cycle_start_date = S4U_Simulation::getClock();
+        this->next_cycle_date = cycle_start_date + this->negotiator_interval;
 
-                        WRENCH_INFO("Dispatched job %s with %ld tasks", standard_job->getName().c_str(),
-                                    standard_job->getTasks().size());
-                        break;
-                    }
-                }
+        std::vector<WorkflowJob *> scheduled_jobs;
 
-            } else if (auto pilot_job = dynamic_cast<PilotJob *>(job)) { // PILOT JOB
+        auto it = this->pending_jobs.begin();
+        while (it != this->pending_jobs.end()) {
 
-                for (auto &item : *this->compute_resources) {
-                    if (not item.first->supportsPilotJobs()) {
-                        continue;
-                    }
+            // Stop early if no pending job can be dispatched
+            if (this->pilot_job_compute_resources.empty() and
+                (this->idle_cores_index.empty() or (this->idle_cores_index.rbegin()->first == 0))) {
+                break;
+            }
 
-                    pilot_job->pushCallbackMailbox(this->reply_mailbox);
-                    item.first->submitPilotJob(pilot_job, service_specific_arguments);
-                    this->running_jobs->insert(std::make_pair(job, item.first));
-                    scheduled_jobs.push_back(job);
+            auto job = it->job;
+            std::shared_ptr<ComputeService> compute_resource = nullptr;
 
-                    WRENCH_INFO("Dispatched pilot job %s", pilot_job->getName().c_str());
-                    break;
+            if (auto standard_job = dynamic_cast<StandardJob *>(job)) {
+                // Best fit: the resource with the fewest idle cores among those with enough idle cores
+                auto required_num_cores = standard_job->getMinimumRequiredNumCores();
+                auto resource = this->idle_cores_index.lower_bound(
+                        std::make_pair(required_num_cores, std::shared_ptr<ComputeService>(nullptr)));
+                if (resource != this->idle_cores_index.end()) {
+                    compute_resource = resource->second;
+                    this->setNumIdleCores(compute_resource, resource->first - required_num_cores);
+                }
+            } else if (dynamic_cast<PilotJob *>(job)) {
+                if (not this->pilot_job_compute_resources.empty()) {
+                    compute_resource = this->pilot_job_compute_resources.front();
                 }
             }
-        }
 
-        // Send the callback to the originator
-        try {
-            S4U_Mailbox::putMessage(
-                    this->reply_mailbox, new NegotiatorCompletionMessage(
-                            scheduled_jobs, this->getMessagePayloadValue(
-                                    HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_DONE_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            return 1;
+            if (compute_resource == nullptr) {
+                ++it;
+                continue;
+            }
+
+            // Remove the job from the pending jobs before submitting it, as submitting
+            // it takes simulated time during which other jobs may be added
+            auto service_specific_arguments = it->service_specific_args;
+            it = this->pending_jobs.erase(it);
+
+            if (auto standard_job = dynamic_cast<StandardJob *>(job)) {
+
+                WRENCH_INFO("Dispatching job %s with %ld tasks", standard_job->getName().c_str(),
+                            standard_job->getTasks().size());
+
+                standard_job->pushCallbackMailbox(this->reply_mailbox);
+                compute_resource->submitStandardJob(standard_job, service_specific_arguments);
+                this->running_jobs->insert(std::make_pair(job, compute_resource));
+                scheduled_jobs.push_back(job);
+
+                WRENCH_INFO("Dispatched job %s with %ld tasks", standard_job->getName().c_str(),
+                            standard_job->getTasks().size());
+
+            } else if (auto pilot_job = dynamic_cast<PilotJob *>(job)) {
+
+                pilot_job->pushCallbackMailbox(this->reply_mailbox);
+                compute_resource->submitPilotJob(pilot_job, service_specific_arguments);
+                this->running_jobs->insert(std::make_pair(job, compute_resource));
+                scheduled_jobs.push_back(job);
+
+                WRENCH_INFO("Dispatched pilot job %s", pilot_job->getName().c_str());
+            }
         }
 
-        WRENCH_INFO("HTCondorNegotiator Service on host %s cleanly terminating!",
-                    S4U_Simulation::getHostName().c_str());
-        return 0;
+        double cycle_time = S4U_Simulation::getClock() - cycle_start_date;
+        WRENCH_INFO("Negotiation cycle completed in %.3lf seconds: %lu matches, %lu pending jobs left",
+                    cycle_time, scheduled_jobs.size(), this->pending_jobs.size());
+
+        // Send the callback to the originator (asynchronously, as the originator may
+        // be waiting for this service to stop)
+        S4U_Mailbox::dputMessage(
+                this->reply_mailbox, new NegotiatorCompletionMessage(
+                        scheduled_jobs, cycle_time, this->getMessagePayloadValue(
+                                HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_DONE_MESSAGE_PAYLOAD)));
     }
 
 }
@@ -99,8 +99,10 @@ namespace wrench {
      * @brief Synchronously migrate a VM to another physical host
      *
      * @param vm_name: virtual machine hostname
-     * @param dest_pm_hostname: the name of the destination physical machine host
+     * @param dest_pm_hostname: the name of the destination physical machine host, which must be
+     *        one of the service's execution hosts (the service only accounts for resources on those hosts)
      *
+     * @throw WorkflowExecutionException
      * @throw std::invalid_argument
      */
     void VirtualizedClusterComputeService::migrateVM(const std::string &vm_name, const std::string &dest_pm_hostname) {
@@ -144,6 +146,8 @@ namespace wrench {
                     this->hostname.c_str(),
                     this->mailbox_name.c_str());
 
+        this->indexExecutionHosts();
+
         /** Main loop **/
         while (this->processNextMessage()) {
             // no specific action
@@ -253,7 +257,8 @@ namespace wrench {
      *
      * @param answer_mailbox: the mailbox to which the answer message should be sent
      * @param vm_name: the name of the VM host
-     * @param dest_pm_hostname: the name of the destination physical machine host
+     * @param dest_pm_hostname: the name of the destination physical machine host (the migration
+     *        fails, with a NotEnoughResources failure cause, if it is not one of the execution hosts)
      *
      * @throw std::runtime_error
      */
@@ -270,12 +275,18 @@ namespace wrench {
 
         auto vm = vm_pair.first;
 
-        // Check that the target host has sufficient resources
-        double dest_available_ram = Simulation::getHostMemoryCapacity(dest_pm_hostname) -
-                                    this->used_ram_per_execution_host[dest_pm_hostname];
-        double dest_available_cores =
-                Simulation::getHostNumCores(dest_pm_hostname) - this->used_cores_per_execution_host[dest_pm_hostname];
-        if ((dest_available_ram < vm->getMemory()) or (dest_available_cores < vm->getNumCores())) {
+        // Check that the target host is an execution host with sufficient resources
+        auto dest_capacity = this->execution_host_capacities.find(dest_pm_hostname);
+        bool dest_has_enough_resources = false;
+        if (dest_capacity != this->execution_host_capacities.end()) {
+            double dest_available_ram =
+                    dest_capacity->second.ram - this->used_ram_per_execution_host[dest_pm_hostname];
+            unsigned long dest_available_cores =
+                    dest_capacity->second.num_cores - this->used_cores_per_execution_host[dest_pm_hostname];
+            dest_has_enough_resources = ((dest_available_ram >= vm->getMemory()) and
+                                         (dest_available_cores >= vm->getNumCores()));
+        }
+        if (not dest_has_enough_resources) {
             msg_to_send_back = new VirtualizedClusterComputeServiceMigrateVMAnswerMessage(
                     false,
                     std::shared_ptr<FailureCause>(
@@ -284,8 +295,10 @@ namespace wrench {
                             VirtualizedClusterComputeServiceMessagePayload::MIGRATE_VM_ANSWER_MESSAGE_PAYLOAD));
 
         } else {
-            // Do the migrationa
+            // Do the migration, and move the VM's resources to the destination host
             vm->migrate(dest_pm_hostname);
+            this->releaseVMResources(vm_name);
+            this->allocateVMResources(vm_name, dest_pm_hostname);
             msg_to_send_back = new VirtualizedClusterComputeServiceMigrateVMAnswerMessage(
                     true,
                     nullptr,
@@ -8,6 +8,8 @@
  */
 
 
+#include <algorithm>
+
 #include "FileRegistryMessage.h"
 
 namespace wrench {
@@ -165,4 +167,141 @@ namespace wrench {
             FileRegistryMessage("ADD_ENTRY_ANSWER", payload) {
     }
 
+    /**
+     * @brief Constructor
+     * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param files: the files to look up
+     * @param payload: the message size in bytes
+     */
+    FileRegistryFileLookupsRequestMessage::FileRegistryFileLookupsRequestMessage(std::string answer_mailbox,
+                                                                                 std::vector<WorkflowFile *> files,
+                                                                                 double payload) :
+            FileRegistryMessage("FILE_LOOKUPS_REQUEST", payload) {
+        if (answer_mailbox.empty() || (std::find(files.begin(), files.end(), nullptr) != files.end())) {
+            throw std::invalid_argument(
+                    "FileRegistryFileLookupsRequestMessage::FileRegistryFileLookupsRequestMessage(): Invalid argument");
+        }
+        this->answer_mailbox = answer_mailbox;
+        this->files = std::move(files);
+    }
+
+    /**
+     * @brief Constructor
+     * @param locations: the set of locations of each file that was looked up
+     * @param payload: the message size in bytes
+     */
+    FileRegistryFileLookupsAnswerMessage::FileRegistryFileLookupsAnswerMessage(
+            std::map<WorkflowFile *, std::set<std::shared_ptr<FileLocation>>> locations,
+            double payload) :
+            FileRegistryMessage("FILE_LOOKUPS_ANSWER", payload) {
+        this->locations = std::move(locations);
+    }
+
+    /**
+     * @brief Constructor
+     * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param entries: the <file, location> entries to remove
+     * @param payload: the message size in bytes
+     */
+    FileRegistryRemoveEntriesRequestMessage::FileRegistryRemoveEntriesRequestMessage(
+            std::string answer_mailbox,
+            std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> entries,
+            double payload) :
+            FileRegistryMessage("REMOVE_ENTRIES_REQUEST", payload) {
+        if (answer_mailbox.empty()) {
+            throw std::invalid_argument(
+                    "FileRegistryRemoveEntriesRequestMessage::FileRegistryRemoveEntriesRequestMessage(): Invalid argument");
+        }
+        for (auto const &e : entries) {
+            if ((e.first == nullptr) || (e.second == nullptr)) {
+                throw std::invalid_argument(
+                        "FileRegistryRemoveEntriesRequestMessage::FileRegistryRemoveEntriesRequestMessage(): Invalid argument");
+            }
+        }
+        this->answer_mailbox = answer_mailbox;
+        this->entries = std::move(entries);
+    }
+
+    /**
+     * @brief Constructor
+     * @param successes: whether the removal of each entry was successful
+     * @param payload: the message size in bytes
+     */
+    FileRegistryRemoveEntriesAnswerMessage::FileRegistryRemoveEntriesAnswerMessage(std::vector<bool> successes,
+                                                                                   double payload) :
+            FileRegistryMessage("REMOVE_ENTRIES_ANSWER", payload) {
+        this->successes = std::move(successes);
+    }
+
+    /**
+     * @brief Constructor
+     * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param entries: the <file, location> entries to add
+     * @param payload: the message size in bytes
+     */
+    FileRegistryAddEntriesRequestMessage::FileRegistryAddEntriesRequestMessage(
+            std::string answer_mailbox,
+            std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> entries,
+            double payload) :
+            FileRegistryMessage("ADD_ENTRIES_REQUEST", payload) {
+        if (answer_mailbox.empty()) {
+            throw std::invalid_argument(
+                    "FileRegistryAddEntriesRequestMessage::FileRegistryAddEntriesRequestMessage(): Invalid argument");
+        }
+        for (auto const &e : entries) {
+            if ((e.first == nullptr) || (e.second == nullptr)) {
+                throw std::invalid_argument(
+                        "FileRegistryAddEntriesRequestMessage::FileRegistryAddEntriesRequestMessage(): Invalid argument");
+            }
+        }
+        this->answer_mailbox = answer_mailbox;
+        this->entries = std::move(entries);
+    }
+
+    /**
+     * @brief Constructor
+     * @param payload: the message size in bytes
+     */
+    FileRegistryAddEntriesAnswerMessage::FileRegistryAddEntriesAnswerMessage(double payload) :
+            FileRegistryMessage("ADD_ENTRIES_ANSWER", payload) {
+    }
+
+    /**
+     * @brief Constructor
+     * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param files: the files to look up
+     * @param reference_host: the host from which network proximity is measured
+     * @param network_proximity_service: the network proximity service to be used
+     * @param payload: the message size in bytes
+     */
+    FileRegistryFileLookupsByProximityRequestMessage::FileRegistryFileLookupsByProximityRequestMessage(
+            std::string answer_mailbox,
+            std::vector<WorkflowFile *> files,
+            std::string reference_host,
+            std::shared_ptr<NetworkProximityService> network_proximity_service,
+            double payload) :
+            FileRegistryMessage("FILE_LOOKUPS_BY_PROXIMITY_REQUEST", payload) {
+        if (answer_mailbox.empty() || (std::find(files.begin(), files.end(), nullptr) != files.end()) ||
+            reference_host.empty() || (network_proximity_service == nullptr)) {
+            throw std::invalid_argument(
+                    "FileRegistryFileLookupsByProximityRequestMessage::FileRegistryFileLookupsByProximityRequestMessage(): Invalid argument");
+        }
+        this->answer_mailbox = answer_mailbox;
+        this->files = std::move(files);
+        this->reference_host = reference_host;
+        this->network_proximity_service = network_proximity_service;
+    }
+
+    /**
+     * @brief Constructor
+     * @param locations: the <distance, location> pairs of each file that was looked up, by increasing distance
+     * @param payload: the message size in bytes
+     */
+    FileRegistryFileLookupsByProximityAnswerMessage::FileRegistryFileLookupsByProximityAnswerMessage(
+            std::map<WorkflowFile *, std::vector<std::pair<double, std::shared_ptr<FileLocation>>>> locations,
+            double payload) :
+            FileRegistryMessage("FILE_LOOKUPS_BY_PROXIMITY_ANSWER", payload) {
+        this->locations = std::move(locations);
+    }
+
 };
@@ -169,6 +169,116 @@ namespace wrench {
         FileRegistryAddEntryAnswerMessage(double payload);
     };
 
+    /**
+     * @brief A message sent to a FileRegistryService to request lookups for several files
+     */
+    class FileRegistryFileLookupsRequestMessage : public FileRegistryMessage {
+    public:
+        FileRegistryFileLookupsRequestMessage(std::string answer_mailbox, std::vector<WorkflowFile *> files,
+                                              double payload);
+
+        /** @brief The mailbox to which the answer message should be sent */
+        std::string answer_mailbox;
+        /** @brief The files to lookup */
+        std::vector<WorkflowFile *> files;
+    };
+
+    /**
+     * @brief A message sent by a FileRegistryService in answer to a request for lookups of several files
+     */
+    class FileRegistryFileLookupsAnswerMessage : public FileRegistryMessage {
+    public:
+        FileRegistryFileLookupsAnswerMessage(std::map<WorkflowFile *, std::set<std::shared_ptr<FileLocation>>> locations,
+                                             double payload);
+
+        /** @brief The (possibly empty) set of locations of each file that was looked up */
+        std::map<WorkflowFile *, std::set<std::shared_ptr<FileLocation>>> locations;
+    };
+
+    /**
+     * @brief A message sent to a FileRegistryService to request the removal of several entries
+     */
+    class FileRegistryRemoveEntriesRequestMessage : public FileRegistryMessage {
+    public:
+        FileRegistryRemoveEntriesRequestMessage(std::string answer_mailbox,
+                                                std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> entries,
+                                                double payload);
+
+        /** @brief The mailbox to which the answer message should be sent */
+        std::string answer_mailbox;
+        /** @brief The entries to remove */
+        std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> entries;
+    };
+
+    /**
+     * @brief A message sent by a FileRegistryService in answer to a request for the removal of several entries
+     */
+    class FileRegistryRemoveEntriesAnswerMessage : public FileRegistryMessage {
+    public:
+        FileRegistryRemoveEntriesAnswerMessage(std::vector<bool> successes, double payload);
+
+        /** @brief Whether the removal of each entry (in request order) was successful or not */
+        std::vector<bool> successes;
+    };
+
+    /**
+     * @brief A message sent to a FileRegistryService to request the addition of several entries
+     */
+    class FileRegistryAddEntriesRequestMessage : public FileRegistryMessage {
+    public:
+        FileRegistryAddEntriesRequestMessage(std::string answer_mailbox,
+                                             std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> entries,
+                                             double payload);
+
+        /** @brief The mailbox to which the answer message should be sent */
+        std::string answer_mailbox;
+        /** @brief The entries to add */
+        std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> entries;
+    };
+
+    /**
+     * @brief A message sent by a FileRegistryService in answer to a request for the addition of several entries
+     */
+    class FileRegistryAddEntriesAnswerMessage : public FileRegistryMessage {
+    public:
+        FileRegistryAddEntriesAnswerMessage(double payload);
+    };
+
+    /**
+     * @brief A message sent to a FileRegistryService to request lookups for several files, with the
+     *        locations of each file ranked by network proximity to a reference host
+     */
+    class FileRegistryFileLookupsByProximityRequestMessage : public FileRegistryMessage {
+    public:
+        FileRegistryFileLookupsByProximityRequestMessage(std::string answer_mailbox, std::vector<WorkflowFile *> files,
+                                                         std::string reference_host,
+                                                         std::shared_ptr<NetworkProximityService> network_proximity_service,
+                                                         double payload);
+
+        /** @brief The mailbox to which the answer message should be sent */
+        std::string answer_mailbox;
+        /** @brief The files to lookup */
+        std::vector<WorkflowFile *> files;
+        /** @brief The host from which network proximity is measured */
+        std::string reference_host;
+        /** @brief The network proximity service to be used */
+        std::shared_ptr<NetworkProximityService> network_proximity_service;
+    };
+
+    /**
+     * @brief A message sent by a FileRegistryService in answer to a request for lookups of several files
+     *        ranked by network proximity
+     */
+    class FileRegistryFileLookupsByProximityAnswerMessage : public FileRegistryMessage {
+    public:
+        FileRegistryFileLookupsByProximityAnswerMessage(
+                std::map<WorkflowFile *, std::vector<std::pair<double, std::shared_ptr<FileLocation>>>> locations,
+                double payload);
+
+        /** @brief The <distance, location> pairs of each file that was looked up, by increasing distance */
+        std::map<WorkflowFile *, std::vector<std::pair<double, std::shared_ptr<FileLocation>>>> locations;
+    };
+
     /***********************/
     /** \endcond          **/
     /***********************/
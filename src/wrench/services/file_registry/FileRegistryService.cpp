@@ -18,6 +18,7 @@
 
 #include "wrench/services/file_registry/FileRegistryService.h"
 #include "FileRegistryMessage.h"
+#include "../network_proximity/NetworkProximityMessage.h"
 #include <wrench/services/storage/StorageService.h>
 #include <wrench/workflow/WorkflowFile.h>
 #include <wrench/exceptions/WorkflowExecutionException.h>
@@ -44,6 +45,20 @@ namespace wrench {
 
       this->setProperties(this->default_property_values, property_list);
       this->setMessagePayloads(this->default_messagepayload_values, messagepayload_list);
+
+      unsigned long num_shards = this->getPropertyValueAsUnsignedLong(FileRegistryServiceProperty::NUM_SHARDS);
+      if (num_shards < 1) {
+        throw std::invalid_argument(
+                "FileRegistryService::FileRegistryService(): Invalid NUM_SHARDS property value (should be at least 1)");
+      }
+
+      // Create the other shards, which will be started by main()
+      std::map<std::string, std::string> shard_property_list = property_list;
+      shard_property_list[FileRegistryServiceProperty::NUM_SHARDS] = "1";
+      for (unsigned long i = 1; i < num_shards; i++) {
+        this->shards.push_back(std::shared_ptr<FileRegistryService>(
+                new FileRegistryService(hostname, shard_property_list, messagepayload_list)));
+      }
     }
 
     FileRegistryService::~FileRegistryService() {
@@ -70,7 +85,8 @@ namespace wrench {
       std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_entry");
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name, new FileRegistryFileLookupRequestMessage(answer_mailbox, file,
+        S4U_Mailbox::putMessage(this->getShard(this->getShardIndex(file))->mailbox_name,
+                                new FileRegistryFileLookupRequestMessage(answer_mailbox, file,
                                                                                              this->getMessagePayloadValue(
                                                                                                      FileRegistryServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
       } catch (std::shared_ptr<NetworkError> &cause) {
@@ -127,7 +143,7 @@ namespace wrench {
       std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_entry_by_proximity");
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->getShard(this->getShardIndex(file))->mailbox_name,
                                 new FileRegistryFileLookupByProximityRequestMessage(answer_mailbox, file,
                                                                                     reference_host,
                                                                                     network_proximity_service,
@@ -173,7 +189,7 @@ namespace wrench {
       std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("add_entry");
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->getShard(this->getShardIndex(file))->mailbox_name,
                                 new FileRegistryAddEntryRequestMessage(answer_mailbox, file, location,
                                                                        this->getMessagePayloadValue(
                                                                                FileRegistryServiceMessagePayload::ADD_ENTRY_REQUEST_MESSAGE_PAYLOAD)));
@@ -216,7 +232,7 @@ namespace wrench {
       std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("remove_entry");
 
       try {
-        S4U_Mailbox::putMessage(this->mailbox_name,
+        S4U_Mailbox::putMessage(this->getShard(this->getShardIndex(file))->mailbox_name,
                                 new FileRegistryRemoveEntryRequestMessage(answer_mailbox, file, location,
                                                                           this->getMessagePayloadValue(
                                                                                   FileRegistryServiceMessagePayload::REMOVE_ENTRY_REQUEST_MESSAGE_PAYLOAD)));
@@ -244,6 +260,314 @@ namespace wrench {
     }
 
 
+    /**
+     * @brief Lookup entries for several files in a single request
+     * @param files: the files to lookup
+     * @return a map of the (possibly empty) set of locations of each file
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::invalid_argument
+     * @throw std::runtime_error
+     */
+    std::map<WorkflowFile *, std::set<std::shared_ptr<FileLocation>>>
+    FileRegistryService::lookupEntries(std::vector<WorkflowFile *> files) {
+
+      if (std::find(files.begin(), files.end(), nullptr) != files.end()) {
+        throw std::invalid_argument("FileRegistryService::lookupEntries(): Invalid argument");
+      }
+
+      if (files.empty()) {
+        return {};
+      }
+
+      assertServiceIsUp();
+
+      // Split the files by shard
+      std::vector<std::vector<WorkflowFile *>> shard_files(this->shards.size() + 1);
+      for (auto const &file : files) {
+        shard_files[this->getShardIndex(file)].push_back(file);
+      }
+
+      // Send one request to each involved shard (so that shards process their requests concurrently)
+      std::vector<std::string> answer_mailboxes(shard_files.size());
+      for (unsigned long i = 0; i < shard_files.size(); i++) {
+        if (shard_files[i].empty()) {
+          continue;
+        }
+        answer_mailboxes[i] = S4U_Mailbox::generateUniqueMailboxName("lookup_entries");
+        double payload = (double) shard_files[i].size() *
+                         this->getMessagePayloadValue(FileRegistryServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD);
+        try {
+          S4U_Mailbox::putMessage(this->getShard(i)->mailbox_name,
+                                  new FileRegistryFileLookupsRequestMessage(answer_mailboxes[i], shard_files[i], payload));
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          throw WorkflowExecutionException(cause);
+        }
+      }
+
+      // Gather the answers
+      std::map<WorkflowFile *, std::set<std::shared_ptr<FileLocation>>> locations;
+      for (auto const &answer_mailbox : answer_mailboxes) {
+        if (answer_mailbox.empty()) {
+          continue;
+        }
+
+        std::shared_ptr<SimulationMessage> message = nullptr;
+
+        try {
+          message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          throw WorkflowExecutionException(cause);
+        }
+
+        if (auto msg = std::dynamic_pointer_cast<FileRegistryFileLookupsAnswerMessage>(message)) {
+          locations.insert(msg->locations.begin(), msg->locations.end());
+        } else {
+          throw std::runtime_error(
+                  "FileRegistryService::lookupEntries(): Unexpected [" + message->getName() + "] message");
+        }
+      }
+      return locations;
+    }
+
+    /**
+     * @brief Lookup entries for several files in a single request, with the locations of each file ranked by
+     *        network distance from a reference host (as determined by a network proximity service). The
+     *        ranking is done by the file registry service, based on proximity data pushed to it by the network
+     *        proximity service, so that no per-location proximity lookup is needed.
+     * @param files: the files to lookup
+     * @param reference_host: reference host from which network proximity values are to be measured
+     * @param network_proximity_service: the network proximity service to use
+     * @return a map of the (possibly empty) list of <distance, location> pairs of each file, sorted by
+     *         increasing distance (locations at equal distances are all kept, in a deterministic order)
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::invalid_argument
+     * @throw std::runtime_error
+     */
+    std::map<WorkflowFile *, std::vector<std::pair<double, std::shared_ptr<FileLocation>>>>
+    FileRegistryService::lookupEntries(std::vector<WorkflowFile *> files,
+                                       std::string reference_host,
+                                       std::shared_ptr<NetworkProximityService> network_proximity_service) {
+
+      if ((std::find(files.begin(), files.end(), nullptr) != files.end()) or (network_proximity_service == nullptr)) {
+        throw std::invalid_argument("FileRegistryService::lookupEntries(): Invalid argument");
+      }
+
+      // check to see if the 'reference_host' is valid
+      std::vector<std::string> monitored_hosts = network_proximity_service->getHostnameList();
+      if (std::find(monitored_hosts.cbegin(), monitored_hosts.cend(), reference_host) == monitored_hosts.cend()) {
+        throw std::invalid_argument(
+                "FileRegistryService::lookupEntries(): Invalid argument, host " + reference_host +
+                " does not exist");
+      }
+
+      if (files.empty()) {
+        return {};
+      }
+
+      assertServiceIsUp();
+
+      // Split the files by shard
+      std::vector<std::vector<WorkflowFile *>> shard_files(this->shards.size() + 1);
+      for (auto const &file : files) {
+        shard_files[this->getShardIndex(file)].push_back(file);
+      }
+
+      // Send one request to each involved shard (so that shards process their requests concurrently)
+      std::vector<std::string> answer_mailboxes(shard_files.size());
+      for (unsigned long i = 0; i < shard_files.size(); i++) {
+        if (shard_files[i].empty()) {
+          continue;
+        }
+        answer_mailboxes[i] = S4U_Mailbox::generateUniqueMailboxName("lookup_entries_by_proximity");
+        double payload = (double) shard_files[i].size() *
+                         this->getMessagePayloadValue(FileRegistryServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD);
+        try {
+          S4U_Mailbox::putMessage(this->getShard(i)->mailbox_name,
+                                  new FileRegistryFileLookupsByProximityRequestMessage(answer_mailboxes[i],
+                                                                                       shard_files[i],
+                                                                                       reference_host,
+                                                                                       network_proximity_service,
+                                                                                       payload));
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          throw WorkflowExecutionException(cause);
+        }
+      }
+
+      // Gather the answers
+      std::map<WorkflowFile *, std::vector<std::pair<double, std::shared_ptr<FileLocation>>>> locations;
+      for (auto const &answer_mailbox : answer_mailboxes) {
+        if (answer_mailbox.empty()) {
+          continue;
+        }
+
+        std::shared_ptr<SimulationMessage> message = nullptr;
+
+        try {
+          message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          throw WorkflowExecutionException(cause);
+        }
+
+        if (auto msg = std::dynamic_pointer_cast<FileRegistryFileLookupsByProximityAnswerMessage>(message)) {
+          locations.insert(msg->locations.begin(), msg->locations.end());
+        } else {
+          throw std::runtime_error(
+                  "FileRegistryService::lookupEntries(): Unexpected [" + message->getName() + "] message");
+        }
+      }
+      return locations;
+    }
+
+    /**
+     * @brief Add several entries in a single request
+     * @param entries: a list of <file, location> entries
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::invalid_argument
+     * @throw std::runtime_error
+     */
+    void FileRegistryService::addEntries(
+            std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> entries) {
+
+      for (auto const &e : entries) {
+        if ((e.first == nullptr) || (e.second == nullptr)) {
+          throw std::invalid_argument("FileRegistryService::addEntries(): Invalid argument");
+        }
+      }
+
+      if (entries.empty()) {
+        return;
+      }
+
+      assertServiceIsUp();
+
+      // Split the entries by shard
+      std::vector<std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>>> shard_entries(
+              this->shards.size() + 1);
+      for (auto const &e : entries) {
+        shard_entries[this->getShardIndex(e.first)].push_back(e);
+      }
+
+      // Send one request to each involved shard (so that shards process their requests concurrently)
+      std::vector<std::string> answer_mailboxes(shard_entries.size());
+      for (unsigned long i = 0; i < shard_entries.size(); i++) {
+        if (shard_entries[i].empty()) {
+          continue;
+        }
+        answer_mailboxes[i] = S4U_Mailbox::generateUniqueMailboxName("add_entries");
+        double payload = (double) shard_entries[i].size() *
+                         this->getMessagePayloadValue(FileRegistryServiceMessagePayload::ADD_ENTRY_REQUEST_MESSAGE_PAYLOAD);
+        try {
+          S4U_Mailbox::putMessage(this->getShard(i)->mailbox_name,
+                                  new FileRegistryAddEntriesRequestMessage(answer_mailboxes[i], shard_entries[i], payload));
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          throw WorkflowExecutionException(cause);
+        }
+      }
+
+      // Wait for the answers
+      for (auto const &answer_mailbox : answer_mailboxes) {
+        if (answer_mailbox.empty()) {
+          continue;
+        }
+
+        std::shared_ptr<SimulationMessage> message = nullptr;
+
+        try {
+          message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          throw WorkflowExecutionException(cause);
+        }
+
+        if (not std::dynamic_pointer_cast<FileRegistryAddEntriesAnswerMessage>(message)) {
+          throw std::runtime_error(
+                  "FileRegistryService::addEntries(): Unexpected [" + message->getName() + "] message");
+        }
+      }
+    }
+
+    /**
+     * @brief Remove several entries in a single request
+     * @param entries: a list of <file, location> entries
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::invalid_argument
+     * @throw std::runtime_error
+     */
+    void FileRegistryService::removeEntries(
+            std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>> entries) {
+
+      for (auto const &e : entries) {
+        if ((e.first == nullptr) || (e.second == nullptr)) {
+          throw std::invalid_argument("FileRegistryService::removeEntries(): Invalid argument");
+        }
+      }
+
+      if (entries.empty()) {
+        return;
+      }
+
+      assertServiceIsUp();
+
+      // Split the entries by shard (keeping track of their indices in the request)
+      std::vector<std::vector<std::pair<WorkflowFile *, std::shared_ptr<FileLocation>>>> shard_entries(
+              this->shards.size() + 1);
+      std::vector<std::vector<unsigned long>> shard_entry_indices(this->shards.size() + 1);
+      for (unsigned long i = 0; i < entries.size(); i++) {
+        auto shard_index = this->getShardIndex(entries[i].first);
+        shard_entries[shard_index].push_back(entries[i]);
+        shard_entry_indices[shard_index].push_back(i);
+      }
+
+      // Send one request to each involved shard (so that shards process their requests concurrently)
+      std::vector<std::string> answer_mailboxes(shard_entries.size());
+      for (unsigned long i = 0; i < shard_entries.size(); i++) {
+        if (shard_entries[i].empty()) {
+          continue;
+        }
+        answer_mailboxes[i] = S4U_Mailbox::generateUniqueMailboxName("remove_entries");
+        double payload = (double) shard_entries[i].size() *
+                         this->getMessagePayloadValue(FileRegistryServiceMessagePayload::REMOVE_ENTRY_REQUEST_MESSAGE_PAYLOAD);
+        try {
+          S4U_Mailbox::putMessage(this->getShard(i)->mailbox_name,
+                                  new FileRegistryRemoveEntriesRequestMessage(answer_mailboxes[i], shard_entries[i],
+                                                                              payload));
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          throw WorkflowExecutionException(cause);
+        }
+      }
+
+      // Wait for the answers
+      for (unsigned long i = 0; i < answer_mailboxes.size(); i++) {
+        if (answer_mailboxes[i].empty()) {
+          continue;
+        }
+
+        std::shared_ptr<SimulationMessage> message = nullptr;
+
+        try {
+          message = S4U_Mailbox::getMessage(answer_mailboxes[i], this->network_timeout);
+        } catch (std::shared_ptr<NetworkError> &cause) {
+          throw WorkflowExecutionException(cause);
+        }
+
+        if (auto msg = std::dynamic_pointer_cast<FileRegistryRemoveEntriesAnswerMessage>(message)) {
+          for (unsigned long j = 0; j < shard_entry_indices[i].size(); j++) {
+            if (!msg->successes.at(j)) {
+              auto const &e = entries[shard_entry_indices[i][j]];
+              WRENCH_WARN("Attempted to remove non-existent (%s,%s) entry from file registry service (ignored)",
+                          e.first->getID().c_str(), e.second->toString().c_str());
+            }
+          }
+        } else {
+          throw std::runtime_error(
+                  "FileRegistryService::removeEntries(): Unexpected [" + message->getName() + "] message");
+        }
+      }
+    }
+
     /**
      * @brief Main method of the daemon
      *
@@ -255,6 +579,12 @@ namespace wrench {
 
       WRENCH_INFO("File Registry Service starting on host %s!", S4U_Simulation::getHostName().c_str());
 
+      // Start the other shards, if any
+      for (auto const &shard : this->shards) {
+        shard->simulation = this->simulation;
+        shard->start(shard, true, false); // Daemonized, no auto-restart
+      }
+
       /** Main loop **/
       while (this->processNextMessage()) {
 
@@ -287,6 +617,24 @@ namespace wrench {
       if (auto msg = std::dynamic_pointer_cast<ServiceStopDaemonMessage>(message)) {
         // This is Synchronous
         try {
+          // Stop the other shards
+          for (auto const &shard : this->shards) {
+            if (shard->isUp()) {
+              shard->stop();
+            }
+          }
+          // Stop receiving proximity data
+          for (auto const &nps : this->subscribed_network_proximity_services) {
+            if (nps->isUp()) {
+              S4U_Mailbox::dputMessage(nps->mailbox_name,
+                                       new NetworkProximitySnapshotUnsubscriptionRequestMessage(
+                                               this->mailbox_name,
+                                               nps->getMessagePayloadValue(
+                                                       NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
+            }
+          }
+          this->subscribed_network_proximity_services.clear();
+          this->network_proximity_snapshots.clear();
           S4U_Mailbox::putMessage(msg->ack_mailbox,
                                   new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
                                           FileRegistryServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
@@ -297,10 +645,7 @@ namespace wrench {
 
       } else if (auto msg = std::dynamic_pointer_cast<FileRegistryFileLookupRequestMessage>(message)) {
 
-        std::set<std::shared_ptr<FileLocation>> locations = {};
-        if (this->entries.find(msg->file) != this->entries.end()) {
-          locations = this->entries[msg->file];
-        }
+        std::set<std::shared_ptr<FileLocation>> locations = this->lookupEntryInDatabase(msg->file);
         // Simulate a lookup overhead
         S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
 
@@ -312,21 +657,11 @@ namespace wrench {
 
       } else if (auto msg = std::dynamic_pointer_cast<FileRegistryFileLookupByProximityRequestMessage>(message)) {
 
-        std::string reference_host = msg->reference_host;
-
-        std::set<std::shared_ptr<FileLocation>> all_file_locations = {};
-        if (this->entries.find(msg->file) != this->entries.end()) {
-          all_file_locations = this->entries[msg->file];
-        }
-
-        double proximity;
         std::map<double, std::shared_ptr<FileLocation>> map_to_return;
-        auto itr = map_to_return.cbegin();
-
-        for (auto &location: all_file_locations) {
-          proximity = std::get<0>(msg->network_proximity_service->getHostPairDistance(
-                  std::make_pair(reference_host, location->getStorageService()->getHostname())));
-          itr = map_to_return.insert(itr, std::make_pair(proximity, location));
+        for (auto const &l : this->rankEntriesByProximity(msg->file, msg->reference_host,
+                                                          msg->network_proximity_service)) {
+          // Keep the first (i.e., highest-ranked) of the locations that are at the same distance
+          map_to_return.insert(l);
         }
 
         S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
@@ -362,12 +697,253 @@ namespace wrench {
                                                                                   FileRegistryServiceMessagePayload::REMOVE_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
         return true;
 
+      } else if (auto msg = std::dynamic_pointer_cast<FileRegistryFileLookupsRequestMessage>(message)) {
+
+        std::map<WorkflowFile *, std::set<std::shared_ptr<FileLocation>>> locations;
+        for (auto const &file : msg->files) {
+          locations[file] = this->lookupEntryInDatabase(file);
+        }
+        // Simulate one lookup overhead per file
+        S4U_Simulation::compute((double) msg->files.size() *
+                                getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
+
+        double payload = (double) msg->files.size() *
+                         this->getMessagePayloadValue(FileRegistryServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD);
+        S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                 new FileRegistryFileLookupsAnswerMessage(locations, payload));
+        return true;
+
+      } else if (auto msg = std::dynamic_pointer_cast<FileRegistryFileLookupsByProximityRequestMessage>(message)) {
+
+        std::map<WorkflowFile *, std::vector<std::pair<double, std::shared_ptr<FileLocation>>>> locations;
+        for (auto const &file : msg->files) {
+          locations[file] = this->rankEntriesByProximity(file, msg->reference_host, msg->network_proximity_service);
+        }
+        // Simulate one lookup overhead per file
+        S4U_Simulation::compute((double) msg->files.size() *
+                                getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
+
+        double payload = (double) msg->files.size() *
+                         this->getMessagePayloadValue(FileRegistryServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD);
+        S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                 new FileRegistryFileLookupsByProximityAnswerMessage(locations, payload));
+        return true;
+
+      } else if (auto msg = std::dynamic_pointer_cast<NetworkProximitySnapshotMessage>(message)) {
+        // An update pushed by a network proximity service (ignored if we are no longer subscribed)
+        auto snapshot = this->network_proximity_snapshots.find(msg->network_proximity_service);
+        if (snapshot != this->network_proximity_snapshots.end()) {
+          snapshot->second.update(msg->snapshot);
+        }
+        return true;
+
+      } else if (auto msg = std::dynamic_pointer_cast<FileRegistryAddEntriesRequestMessage>(message)) {
+        for (auto const &e : msg->entries) {
+          addEntryToDatabase(e.first, e.second);
+        }
+
+        // Simulate one add overhead per entry
+        S4U_Simulation::compute((double) msg->entries.size() *
+                                getPropertyValueAsDouble(FileRegistryServiceProperty::ADD_ENTRY_COMPUTE_COST));
+
+        double payload = (double) msg->entries.size() *
+                         this->getMessagePayloadValue(FileRegistryServiceMessagePayload::ADD_ENTRY_ANSWER_MESSAGE_PAYLOAD);
+        S4U_Mailbox::dputMessage(msg->answer_mailbox, new FileRegistryAddEntriesAnswerMessage(payload));
+        return true;
+
+      } else if (auto msg = std::dynamic_pointer_cast<FileRegistryRemoveEntriesRequestMessage>(message)) {
+
+        std::vector<bool> successes;
+        successes.reserve(msg->entries.size());
+        for (auto const &e : msg->entries) {
+          successes.push_back(removeEntryFromDatabase(e.first, e.second));
+        }
+
+        // Simulate one removal overhead per entry
+        S4U_Simulation::compute((double) msg->entries.size() *
+                                getPropertyValueAsDouble(FileRegistryServiceProperty::REMOVE_ENTRY_COMPUTE_COST));
+
+        double payload = (double) msg->entries.size() *
+                         this->getMessagePayloadValue(FileRegistryServiceMessagePayload::REMOVE_ENTRY_ANSWER_MESSAGE_PAYLOAD);
+        S4U_Mailbox::dputMessage(msg->answer_mailbox, new FileRegistryRemoveEntriesAnswerMessage(successes, payload));
+        return true;
+
       } else {
         throw std::runtime_error(
                 "FileRegistryService::processNextMessage(): Unexpected [" + message->getName() + "] message");
       }
     }
 
+    /**
+     * @brief Internal method to determine which shard is responsible for a file
+     * @param file: a file
+     * @return a shard index (0 being this service)
+     */
+    unsigned long FileRegistryService::getShardIndex(WorkflowFile *file) {
+      if (this->shards.empty()) {
+        return 0;
+      }
+      // FNV-1a hash of the file ID (unlike std::hash, it maps files to the same shards on all platforms)
+      uint64_t hash = 14695981039346656037ULL;
+      for (auto const &c : file->getID()) {
+        hash ^= (unsigned char) c;
+        hash *= 1099511628211ULL;
+      }
+      return (unsigned long) (hash % (this->shards.size() + 1));
+    }
+
+    /**
+     * @brief Internal method to retrieve a shard
+     * @param shard_index: a shard index (0 being this service)
+     * @return a shard
+     */
+    FileRegistryService *FileRegistryService::getShard(unsigned long shard_index) {
+      return (shard_index == 0) ? this : this->shards.at(shard_index - 1).get();
+    }
+
+    /**
+     * @brief Internal method to get the ID of a location, interning the location if it hasn't been seen before
+     *        (reusing the ID of a released location, if any)
+     * @param location: a location
+     * @return a location ID
+     */
+    unsigned long FileRegistryService::internLocation(const std::shared_ptr<FileLocation> &location) {
+      auto &ids = this->location_ids[location->getStorageService().get()];
+      std::string path = location->getFullAbsolutePath();
+      auto it = ids.find(path);
+      if (it != ids.end()) {
+        return it->second;
+      }
+      unsigned long id;
+      if (not this->free_location_ids.empty()) {
+        id = this->free_location_ids.back();
+        this->free_location_ids.pop_back();
+        this->locations[id] = location;
+        this->location_num_entries[id] = 0;
+      } else {
+        id = this->locations.size();
+        this->locations.push_back(location);
+        this->location_num_entries.push_back(0);
+      }
+      ids.insert(std::make_pair(path, id));
+      return id;
+    }
+
+    /**
+     * @brief Internal method to release an interned location that is no longer in any entry
+     * @param id: a location ID
+     */
+    void FileRegistryService::releaseLocation(unsigned long id) {
+      auto ss_ids = this->location_ids.find(this->locations[id]->getStorageService().get());
+      ss_ids->second.erase(this->locations[id]->getFullAbsolutePath());
+      if (ss_ids->second.empty()) {
+        this->location_ids.erase(ss_ids);
+      }
+      this->locations[id] = nullptr;
+      this->free_location_ids.push_back(id);
+    }
+
+    /**
+     * @brief Internal method to lookup the locations of a file in the database
+     * @param file: a file
+     * @return the (possibly empty) set of locations of the file
+     */
+    std::set<std::shared_ptr<FileLocation>> FileRegistryService::lookupEntryInDatabase(WorkflowFile *file) {
+
+      auto shard = this->getShard(this->getShardIndex(file));
+      if (shard != this) {
+        return shard->lookupEntryInDatabase(file);
+      }
+
+      std::set<std::shared_ptr<FileLocation>> result;
+      auto entry = this->entries.find(file->getID());
+      if (entry != this->entries.end()) {
+        for (auto const &id : entry->second) {
+          result.insert(this->locations[id]);
+        }
+      }
+      return result;
+    }
+
+    /**
+     * @brief Internal method to rank the locations of a file by network distance from a reference host
+     * @param file: a file
+     * @param reference_host: the host from which network proximity is measured
+     * @param network_proximity_service: the network proximity service whose proximity data should be used
+     * @return a list of <distance, location> pairs, sorted by increasing distance (ties are kept in database order)
+     */
+    std::vector<std::pair<double, std::shared_ptr<FileLocation>>>
+    FileRegistryService::rankEntriesByProximity(WorkflowFile *file, const std::string &reference_host,
+                                                const std::shared_ptr<NetworkProximityService> &network_proximity_service) {
+
+      std::vector<std::pair<double, std::shared_ptr<FileLocation>>> ranked;
+
+      auto entry = this->entries.find(file->getID());
+      if (entry == this->entries.end()) {
+        return ranked;
+      }
+
+      auto snapshot = this->getNetworkProximitySnapshot(network_proximity_service);
+      ranked.reserve(entry->second.size());
+      for (auto const &id : entry->second) {
+        auto const &location = this->locations[id];
+        double distance = NetworkProximityService::NOT_AVAILABLE;
+        if (snapshot) {
+          distance = snapshot->getHostPairDistance(reference_host, location->getStorageService()->getHostname());
+        }
+        ranked.push_back(std::make_pair(distance, location));
+      }
+      std::stable_sort(ranked.begin(), ranked.end(),
+                       [](const std::pair<double, std::shared_ptr<FileLocation>> &lhs,
+                          const std::pair<double, std::shared_ptr<FileLocation>> &rhs) {
+                           return lhs.first < rhs.first;
+                       });
+      return ranked;
+    }
+
+    /**
+     * @brief Internal method to retrieve the proximity data of a network proximity service, subscribing
+     *        to its updates (which are then pushed to this service's mailbox) on first use
+     * @param network_proximity_service: a network proximity service
+     * @return the proximity data, or nullptr if it could not be obtained (e.g., the service is down)
+     *
+     * @throw std::runtime_error
+     */
+    NetworkProximitySnapshot *FileRegistryService::getNetworkProximitySnapshot(
+            const std::shared_ptr<NetworkProximityService> &network_proximity_service) {
+
+      auto snapshot = this->network_proximity_snapshots.find(network_proximity_service.get());
+      if (snapshot != this->network_proximity_snapshots.end()) {
+        return &(snapshot->second);
+      }
+
+      if (not network_proximity_service->isUp()) {
+        return nullptr;
+      }
+
+      std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("network_proximity_snapshot");
+
+      std::shared_ptr<SimulationMessage> message = nullptr;
+      try {
+        S4U_Mailbox::putMessage(network_proximity_service->mailbox_name,
+                                new NetworkProximitySnapshotSubscriptionRequestMessage(
+                                        answer_mailbox, this->mailbox_name,
+                                        network_proximity_service->getMessagePayloadValue(
+                                                NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
+        message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+      } catch (std::shared_ptr<NetworkError> &cause) {
+        return nullptr;
+      }
+
+      if (auto msg = std::dynamic_pointer_cast<NetworkProximitySnapshotMessage>(message)) {
+        this->subscribed_network_proximity_services.insert(network_proximity_service);
+        return &(this->network_proximity_snapshots[network_proximity_service.get()] = msg->snapshot);
+      } else {
+        throw std::runtime_error(
+                "FileRegistryService::getNetworkProximitySnapshot(): Unexpected [" + message->getName() + "] message");
+      }
+    }
+
     /**
      * Internal method to add an entry to the database
      * @param file: a file
@@ -375,15 +951,18 @@ namespace wrench {
      */
     void FileRegistryService::addEntryToDatabase(WorkflowFile *file, std::shared_ptr<FileLocation> location) {
 
-      if (this->entries.find(file) == this->entries.end()) {
-        this->entries[file] = {};
+      auto shard = this->getShard(this->getShardIndex(file));
+      if (shard != this) {
+        shard->addEntryToDatabase(file, location);
+        return;
       }
-      for (auto e : this->entries[file]) {
-        if (FileLocation::equal(e, location)) {
-          return;
-        }
+
+      unsigned long id = this->internLocation(location);
+      auto &ids = this->entries[file->getID()];
+      if (std::find(ids.begin(), ids.end(), id) == ids.end()) {
+        ids.push_back(id);
+        this->location_num_entries[id]++;
       }
-      this->entries[file].insert(location);
     }
 
     /**
@@ -396,16 +975,38 @@ namespace wrench {
     bool
     FileRegistryService::removeEntryFromDatabase(WorkflowFile *file, std::shared_ptr<FileLocation> location) {
 
-      if (this->entries.find(file) != this->entries.end()) {
-        for (auto const &l : this->entries[file]) {
-          if (FileLocation::equal(l, location)) {
-            this->entries[file].erase(l);
-            return true;
+      auto shard = this->getShard(this->getShardIndex(file));
+      if (shard != this) {
+        return shard->removeEntryFromDatabase(file, location);
+      }
 
-          }
-        }
+      auto entry = this->entries.find(file->getID());
+      if (entry == this->entries.end()) {
+        return false;
+      }
+      auto ss_ids = this->location_ids.find(location->getStorageService().get());
+      if (ss_ids == this->location_ids.end()) {
+        return false;
+      }
+      auto id = ss_ids->second.find(location->getFullAbsolutePath());
+      if (id == ss_ids->second.end()) {
+        return false;
+      }
+
+      auto &ids = entry->second;
+      auto it = std::find(ids.begin(), ids.end(), id->second);
+      if (it == ids.end()) {
+        return false;
+      }
+      *it = ids.back();
+      ids.pop_back();
+      if (ids.empty()) {
+        this->entries.erase(entry);
+      }
+      if (--this->location_num_entries[id->second] == 0) {
+        this->releaseLocation(id->second);
       }
-      return false;
+      return true;
     }
 
 };
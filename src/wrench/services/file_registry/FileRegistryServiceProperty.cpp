@@ -14,5 +14,6 @@ namespace wrench {
     SET_PROPERTY_NAME(FileRegistryServiceProperty, LOOKUP_COMPUTE_COST);
     SET_PROPERTY_NAME(FileRegistryServiceProperty, ADD_ENTRY_COMPUTE_COST);
     SET_PROPERTY_NAME(FileRegistryServiceProperty, REMOVE_ENTRY_COMPUTE_COST);
+    SET_PROPERTY_NAME(FileRegistryServiceProperty, NUM_SHARDS);
 };
 
@@ -158,4 +158,54 @@ namespace wrench {
         this->xy_coordinate = xy_coordinate;
         this->timestamp = timestamp;
     }
+
+    /**
+     * @brief Constructor
+     * @param answer_mailbox: the mailbox to which the initial (full) snapshot should be sent
+     * @param subscriber_mailbox: the mailbox to which snapshot updates should be pushed
+     * @param payload: the message size in bytes
+     */
+    NetworkProximitySnapshotSubscriptionRequestMessage::NetworkProximitySnapshotSubscriptionRequestMessage(
+            std::string answer_mailbox, std::string subscriber_mailbox, double payload) :
+            NetworkProximityMessage("SNAPSHOT_SUBSCRIPTION_REQUEST", payload) {
+        if (answer_mailbox.empty() || subscriber_mailbox.empty()) {
+            throw std::invalid_argument(
+                    "NetworkProximitySnapshotSubscriptionRequestMessage::NetworkProximitySnapshotSubscriptionRequestMessage(): Invalid argument");
+        }
+        this->answer_mailbox = answer_mailbox;
+        this->subscriber_mailbox = subscriber_mailbox;
+    }
+
+    /**
+     * @brief Constructor
+     * @param subscriber_mailbox: the mailbox to which snapshot updates were pushed
+     * @param payload: the message size in bytes
+     */
+    NetworkProximitySnapshotUnsubscriptionRequestMessage::NetworkProximitySnapshotUnsubscriptionRequestMessage(
+            std::string subscriber_mailbox, double payload) :
+            NetworkProximityMessage("SNAPSHOT_UNSUBSCRIPTION_REQUEST", payload) {
+        if (subscriber_mailbox.empty()) {
+            throw std::invalid_argument(
+                    "NetworkProximitySnapshotUnsubscriptionRequestMessage::NetworkProximitySnapshotUnsubscriptionRequestMessage(): Invalid argument");
+        }
+        this->subscriber_mailbox = subscriber_mailbox;
+    }
+
+    /**
+     * @brief Constructor
+     * @param network_proximity_service: the network proximity service whose data this is
+     * @param snapshot: a (full or partial) snapshot
+     * @param payload: the message size in bytes
+     */
+    NetworkProximitySnapshotMessage::NetworkProximitySnapshotMessage(NetworkProximityService *network_proximity_service,
+                                                                     NetworkProximitySnapshot snapshot,
+                                                                     double payload) :
+            NetworkProximityMessage("SNAPSHOT", payload) {
+        if (network_proximity_service == nullptr) {
+            throw std::invalid_argument(
+                    "NetworkProximitySnapshotMessage::NetworkProximitySnapshotMessage(): Invalid argument");
+        }
+        this->network_proximity_service = network_proximity_service;
+        this->snapshot = std::move(snapshot);
+    }
 }
@@ -11,6 +11,7 @@
 #define WRENCH_NETWORKPROXIMITYMESSAGE_H
 
 #include <wrench/services/network_proximity/NetworkProximityDaemon.h>
+#include <wrench/services/network_proximity/NetworkProximityService.h>
 #include <wrench/services/ServiceMessage.h>
 
 namespace wrench {
@@ -148,6 +149,48 @@ namespace wrench {
         double timestamp;
     };
 
+    /**
+     * @brief A message sent to a NetworkProximityService to subscribe to snapshots of its proximity data
+     */
+    class NetworkProximitySnapshotSubscriptionRequestMessage : public NetworkProximityMessage {
+    public:
+        NetworkProximitySnapshotSubscriptionRequestMessage(std::string answer_mailbox, std::string subscriber_mailbox,
+                                                           double payload);
+
+        /** @brief The mailbox to which the initial (full) snapshot should be sent */
+        std::string answer_mailbox;
+
+        /** @brief The mailbox to which snapshot updates should be pushed */
+        std::string subscriber_mailbox;
+    };
+
+    /**
+     * @brief A message sent to a NetworkProximityService to unsubscribe from snapshots of its proximity data
+     */
+    class NetworkProximitySnapshotUnsubscriptionRequestMessage : public NetworkProximityMessage {
+    public:
+        NetworkProximitySnapshotUnsubscriptionRequestMessage(std::string subscriber_mailbox, double payload);
+
+        /** @brief The mailbox to which snapshot updates were pushed */
+        std::string subscriber_mailbox;
+    };
+
+    /**
+     * @brief A message sent by a NetworkProximityService to a subscriber, with a full snapshot
+     *        of its proximity data or with an update to it
+     */
+    class NetworkProximitySnapshotMessage : public NetworkProximityMessage {
+    public:
+        NetworkProximitySnapshotMessage(NetworkProximityService *network_proximity_service,
+                                        NetworkProximitySnapshot snapshot, double payload);
+
+        /** @brief The network proximity service whose data this is */
+        NetworkProximityService *network_proximity_service;
+
+        /** @brief The (full or partial) snapshot */
+        NetworkProximitySnapshot snapshot;
+    };
+
     /***********************/
     /** \endcond          **/
     /***********************/
@@ -11,6 +11,8 @@
 #include <fstream>
 #include <limits>
 #include <iomanip>
+#include <climits>
+#include <algorithm>
 
 #include <boost/algorithm/string.hpp>
 
@@ -31,6 +33,117 @@ namespace wrench {
 
     constexpr double NetworkProximityService::NOT_AVAILABLE;
 
+    /**
+     * @brief Compute the FNV-1a hash of a string (unlike std::hash, its value is the same on all platforms)
+     * @param str: a string
+     * @return the hash
+     */
+    static uint64_t fnv1aHash(const std::string &str) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (auto const &c : str) {
+            hash ^= (unsigned char) c;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Compute an analytical proximity estimate between two hosts from the platform's network
+     *        route: the time to transfer a message over the route, possibly perturbed by a noise that
+     *        is deterministic for a given (seed, host pair)
+     * @param host1: the source hostname
+     * @param host2: the destination hostname
+     * @param message_size: the message size (in bytes)
+     * @param max_noise: the maximum relative noise
+     * @param seed: the noise seed
+     * @return the estimate (or NetworkProximityService::NOT_AVAILABLE if a host is unknown)
+     */
+    static double analyticalDistance(const std::string &host1, const std::string &host2,
+                                     double message_size, double max_noise, unsigned long seed) {
+        if (host1 == host2) {
+            return 0.0;
+        }
+
+        std::pair<double, double> route;
+        try {
+            route = S4U_Simulation::getRouteLatencyAndBandwidth(host1, host2);
+        } catch (std::invalid_argument &e) {
+            return NetworkProximityService::NOT_AVAILABLE;
+        }
+
+        double distance = route.first + message_size / route.second;
+
+        if (max_noise > 0.0) {
+            // Only use fully specified hashing/generation, so that the noise is the same on all platforms
+            uint64_t hash1 = fnv1aHash(host1);
+            uint64_t hash2 = fnv1aHash(host2);
+            std::seed_seq seq{(uint32_t) seed, (uint32_t) ((uint64_t) seed >> 32),
+                              (uint32_t) hash1, (uint32_t) (hash1 >> 32),
+                              (uint32_t) hash2, (uint32_t) (hash2 >> 32)};
+            std::mt19937 noise_rng(seq);
+            double uniform = (double) noise_rng() / 4294967296.0; // in [0, 1)
+            distance *= 1.0 - max_noise + 2.0 * max_noise * uniform;
+        }
+        return distance;
+    }
+
+    /**
+     * @brief Compute the Vivaldi distance between two coordinates
+     * @param c1: the components of the first coordinate
+     * @param c2: the components of the second coordinate
+     * @param dimensions: the number of (non-height) components
+     * @param height: whether the coordinates have a height component (stored after the other components)
+     * @return the distance
+     */
+    static double vivaldiDistance(const double *c1, const double *c2, unsigned long dimensions, bool height) {
+        double sum = 0.0;
+        for (unsigned long d = 0; d < dimensions; d++) {
+            double diff = c2[d] - c1[d];
+            sum += diff * diff;
+        }
+        double distance = std::sqrt(sum);
+        if (height) {
+            distance += c1[dimensions] + c2[dimensions];
+        }
+        return distance;
+    }
+
+    /**
+     * @brief Apply a Vivaldi update to the coordinate of a sender, given an error direction. The
+     *        non-height components are processed by coordinate plane (i.e., pairs of components, seen as complex
+     *        numbers) to which the complex sensitivity (0.25 + 0.25i) is applied. All loops run
+     *        over contiguous arrays so that the compiler can vectorize them.
+     * @param sender: the components of the sender coordinate (updated in place)
+     * @param direction: the error direction (overwritten)
+     * @param dimensions: the number of (non-height) components
+     * @param height: whether the coordinates have a height component (stored after the other components)
+     * @param error: the difference between the measured and the estimated distance
+     */
+    static void vivaldiKernel(double *sender, double *direction, unsigned long dimensions, bool height,
+                              double error) {
+        const double sensitivity = 0.25;
+        unsigned long stride = dimensions + (height ? 1 : 0);
+
+        for (unsigned long d = 0; d < stride; d++) {
+            direction[d] *= error;
+        }
+
+        unsigned long num_planes = dimensions / 2;
+        for (unsigned long p = 0; p < num_planes; p++) {
+            double re = direction[2 * p];
+            double im = direction[2 * p + 1];
+            sender[2 * p] += re * sensitivity - im * sensitivity;
+            sender[2 * p + 1] += re * sensitivity + im * sensitivity;
+        }
+        if (dimensions % 2) {
+            sender[dimensions - 1] += direction[dimensions - 1] * sensitivity;
+        }
+
+        if (height) {
+            sender[dimensions] = std::max<double>(0.0, sender[dimensions] + direction[dimensions] * sensitivity);
+        }
+    }
+
     /**
      * @brief Destructor
      */
@@ -64,6 +177,18 @@ namespace wrench {
 
         validateProperties();
 
+        this->vivaldi = boost::iequals(
+                this->getPropertyValueAsString(NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE),
+                "vivaldi");
+        this->analytical = boost::iequals(
+                this->getPropertyValueAsString(NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE),
+                "analytical");
+        this->vivaldi_dimensions = this->getPropertyValueAsUnsignedLong(
+                NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_DIMENSIONS);
+        this->vivaldi_height = this->getPropertyValueAsBoolean(
+                NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_HEIGHT);
+        this->vivaldi_stride = this->vivaldi_dimensions + (this->vivaldi_height ? 1 : 0);
+
         // Seed the master_rng
         this->master_rng.seed((unsigned int) (this->getPropertyValueAsDouble(
                 wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_PEER_LOOKUP_SEED)));
@@ -203,8 +328,11 @@ namespace wrench {
 
         WRENCH_INFO("Network Proximity Service starting on host %s!", S4U_Simulation::getHostName().c_str());
 
-        // Create  and start network daemons
+        // Create  and start network daemons (none are needed for analytical estimates)
         for (auto h : this->hosts_in_network) {
+            if (this->analytical) {
+                break;
+            }
             std::shared_ptr<NetworkProximityDaemon> np_daemon = std::shared_ptr<NetworkProximityDaemon>(
                     new NetworkProximityDaemon(this->simulation, h, this->mailbox_name,
                                                this->getPropertyValueAsDouble(
@@ -216,17 +344,23 @@ namespace wrench {
                                                this->messagepayload_list));
             this->network_daemons.push_back(np_daemon);
 
-            // if this network service type is 'vivaldi', setup the coordinate lookup table
-            if (boost::iequals(
-                    this->getPropertyValueAsString(NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE),
-                    "vivaldi")) {
-//          this->coordinate_lookup_table.insert(std::pair<std::string, std::complex<double>>(h, (0.0)));
-                this->coordinate_lookup_table.insert(
-                        std::make_pair(h, std::make_pair((0.0), Simulation::getCurrentSimulatedDate())));
-
+            // if this network service type is 'vivaldi', assign the host an index in the coordinate arrays
+            if (this->vivaldi) {
+                this->vivaldi_host_indices.insert(std::make_pair(h, this->vivaldi_host_indices.size()));
             }
         }
 
+        // Set up all coordinates at the origin
+        if (this->vivaldi) {
+            this->vivaldi_coordinates.assign(this->vivaldi_host_indices.size() * this->vivaldi_stride, 0.0);
+            this->vivaldi_timestamps.assign(this->vivaldi_host_indices.size(), Simulation::getCurrentSimulatedDate());
+            this->vivaldi_direction.assign(this->vivaldi_stride, 0.0);
+        }
+
+        if (not this->analytical) {
+            this->computePeerSubsets();
+        }
+
         // Start all network daemons
         try {
             for (auto &network_daemon : this->network_daemons) {
@@ -282,6 +416,8 @@ namespace wrench {
                 }
                 this->network_daemons.clear();
                 this->hosts_in_network.clear();
+                this->daemon_indices.clear();
+                this->peer_subsets.clear();
                 S4U_Mailbox::putMessage(msg->ack_mailbox,
                                         new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
                                                 NetworkProximityServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
@@ -294,21 +430,18 @@ namespace wrench {
             double timestamp = NetworkProximityService::NOT_AVAILABLE;
 
 
-            std::string network_service_type = this->getPropertyValueAsString("NETWORK_PROXIMITY_SERVICE_TYPE");
-
             if (msg->hosts.first == msg->hosts.second) {
                 proximity_value = 0.0;
                 timestamp = Simulation::getCurrentSimulatedDate();
             } else {
 
-                if (boost::iequals(network_service_type, "vivaldi")) {
-                    auto host1 = this->coordinate_lookup_table.find(msg->hosts.first);
-                    auto host2 = this->coordinate_lookup_table.find(msg->hosts.second);
-
-                    if (host1 != this->coordinate_lookup_table.end() && host2 != this->coordinate_lookup_table.end()) {
-                        proximity_value = std::sqrt(norm(host2->second.first - host1->second.first));
-                        timestamp = std::min(host1->second.second, host2->second.second);
+                if (this->analytical) {
+                    proximity_value = this->getAnalyticalDistance(msg->hosts.first, msg->hosts.second);
+                    if (proximity_value != NetworkProximityService::NOT_AVAILABLE) {
+                        timestamp = Simulation::getCurrentSimulatedDate();
                     }
+                } else if (this->vivaldi) {
+                    proximity_value = this->getVivaldiDistance(msg->hosts.first, msg->hosts.second, &timestamp);
                 } else { // alltoall
                     if (this->entries.find(msg->hosts) != this->entries.end()) {
                         proximity_value = std::get<0>(this->entries[msg->hosts]);
@@ -333,12 +466,12 @@ namespace wrench {
 //                    "NetworkProximityService::processNextMessage()::Adding proximity value between %s and %s into the database", msg->hosts.first.c_str(), msg->hosts.second.c_str());
             this->addEntryToDatabase(msg->hosts, msg->proximity_value);
 
-            if (boost::iequals(
-                    this->getPropertyValueAsString(NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE),
-                    "vivaldi")) {
+            if (this->vivaldi) {
                 vivaldiUpdate(msg->proximity_value, msg->hosts.first, msg->hosts.second);
             }
 
+            this->pushSnapshotUpdate(msg->hosts);
+
             return true;
 
         } else if (auto msg = std::dynamic_pointer_cast<NextContactDaemonRequestMessage>(message)) {
@@ -361,16 +494,30 @@ namespace wrench {
             return true;
         } else if (auto msg = std::dynamic_pointer_cast<CoordinateLookupRequestMessage>(message)) {
             std::string requested_host = msg->requested_host;
-            auto const coordinate_itr = this->coordinate_lookup_table.find(requested_host);
+            auto const index_itr = this->vivaldi_host_indices.find(requested_host);
             CoordinateLookupAnswerMessage *msg_to_send_back = nullptr;
 
-            if (coordinate_itr != this->coordinate_lookup_table.cend()) {
+            if (this->analytical) {
+                // Landmark coordinates: the analytical distances from the first two hosts in the network
+                double x = this->getAnalyticalDistance(this->hosts_in_network[0], requested_host);
+                double y = this->getAnalyticalDistance(this->hosts_in_network[1], requested_host);
+                bool success = (x != NetworkProximityService::NOT_AVAILABLE) and
+                               (y != NetworkProximityService::NOT_AVAILABLE);
+                msg_to_send_back = new CoordinateLookupAnswerMessage(requested_host,
+                                                                     success,
+                                                                     success ? std::make_pair(x, y) : std::make_pair(0.0, 0.0),
+                                                                     success ? Simulation::getCurrentSimulatedDate() : 0,
+                                                                     this->getMessagePayloadValue(
+                                                                             NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD));
+            } else if (index_itr != this->vivaldi_host_indices.cend()) {
+                // The (x,y) pair holds the first two components of the coordinate
+                const double *coordinate = &(this->vivaldi_coordinates[index_itr->second * this->vivaldi_stride]);
                 msg_to_send_back  = new CoordinateLookupAnswerMessage(requested_host,
                                                                       true,
                                                                       std::make_pair(
-                                                                              coordinate_itr->second.first.real(),
-                                                                              coordinate_itr->second.first.imag()),
-                                                                      coordinate_itr->second.second,
+                                                                              coordinate[0],
+                                                                              this->vivaldi_dimensions > 1 ? coordinate[1] : 0.0),
+                                                                      this->vivaldi_timestamps[index_itr->second],
                                                                       this->getMessagePayloadValue(
                                                                               NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD));
             } else {
@@ -386,6 +533,18 @@ namespace wrench {
 
             S4U_Mailbox::dputMessage(msg->answer_mailbox,                     msg_to_send_back);
             return true;
+
+        } else if (auto msg = std::dynamic_pointer_cast<NetworkProximitySnapshotSubscriptionRequestMessage>(message)) {
+            this->snapshot_subscriber_mailboxes.insert(msg->subscriber_mailbox);
+            S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                     new NetworkProximitySnapshotMessage(this, this->getSnapshot(),
+                                                                         this->getMessagePayloadValue(
+                                                                                 NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+            return true;
+
+        } else if (auto msg = std::dynamic_pointer_cast<NetworkProximitySnapshotUnsubscriptionRequestMessage>(message)) {
+            this->snapshot_subscriber_mailboxes.erase(msg->subscriber_mailbox);
+            return true;
         } else {
             throw std::runtime_error(
                     "NetworkProximityService::processNextMessage(): Unexpected [" + message->getName() + "] message");
@@ -394,49 +553,133 @@ namespace wrench {
     }
 
     /**
-     * @brief Internal method to choose a communication peer for the requesting network proximity daemon
-     * @param sender_daemon: the network daemon requesting a peer to communicate with next
-     * @return a shared_ptr to the network daemon that is the selected communication peer
+     * @brief Internal method to pre-compute, for each network proximity daemon, the subset of other daemons
+     *        from which its measurement peers are picked, so that picking a peer is O(1). The subset
+     *        of each daemon is a random (seeded by the daemon's mailbox name) selection of
+     *        NETWORK_DAEMON_COMMUNICATION_COVERAGE of the other daemons. When the coverage is 1.0 no subset is stored,
+     *        and peers are picked uniformly among all other daemons.
      */
-    std::shared_ptr<NetworkProximityDaemon>
-    NetworkProximityService::getCommunicationPeer(const std::shared_ptr<NetworkProximityDaemon> sender_daemon) {
+    void NetworkProximityService::computePeerSubsets() {
 
-//        WRENCH_INFO("Obtaining communication peer for %s", sender_daemon->mailbox_name.c_str());
+        this->daemon_indices.clear();
+        this->peer_subsets.clear();
 
         // coverage will be (0 < coverage <= 1.0) if this is a 'vivaldi' network service
         // else if it is an 'alltoall' network service, coverage is set at 1.0
-        double coverage = this->getPropertyValueAsDouble("NETWORK_DAEMON_COMMUNICATION_COVERAGE");
+        double coverage = this->getPropertyValueAsDouble(
+                NetworkProximityServiceProperty::NETWORK_DAEMON_COMMUNICATION_COVERAGE);
         unsigned long max_pool_size = this->network_daemons.size() - 1;
-
-        // if the network_service type is 'alltoall', sender_daemon selects from a pool of all other network daemons
-        // if the network_service type is 'vivaldi', sender_daemon selects from a subset of the max_pool_size
         unsigned long pool_size = (unsigned long) (std::ceil(coverage * max_pool_size));
 
-        std::hash<std::string> hash_func;
-        std::default_random_engine sender_rng;
-        // uniform distribution to be used by the sending daemon's rng
-        std::uniform_int_distribution<unsigned long> s_udist;
+        // uniform distribution, to be used with the master rng, over positions in a peer pool
+        this->peer_udist = std::uniform_int_distribution<unsigned long>(0, pool_size - 1);
+
+        for (unsigned long index = 0; index < this->network_daemons.size(); ++index) {
+            this->daemon_indices[this->network_daemons[index].get()] = index;
+        }
 
-        // uniform distribution to be used by master rng
-        static std::uniform_int_distribution<unsigned long> m_udist(0, pool_size - 1);
+        if (pool_size == max_pool_size) {
+            return;
+        }
 
+        std::hash<std::string> hash_func;
         std::vector<unsigned long> peer_list;
+        peer_list.reserve(max_pool_size);
+
+        for (unsigned long sender = 0; sender < this->network_daemons.size(); ++sender) {
+            // all the network daemons EXCEPT the sender get pushed into this vector
+            peer_list.clear();
+            for (unsigned long index = 0; index < this->network_daemons.size(); ++index) {
+                if (index != sender) {
+                    peer_list.push_back(index);
+                }
+            }
 
-        // all the network daemons EXCEPT the sender get pushed into this vector
-        for (unsigned long index = 0; index < this->network_daemons.size(); ++index) {
-            if (this->network_daemons[index]->mailbox_name != sender_daemon->mailbox_name) {
-                peer_list.push_back(index);
+            // rng seeded uniquely for the sending daemon
+            std::default_random_engine sender_rng(
+                    (unsigned long) hash_func(this->network_daemons[sender]->mailbox_name));
+
+            // partial Fisher-Yates shuffle: only the first pool_size positions are needed
+            for (unsigned long i = 0; i < pool_size; ++i) {
+                std::uniform_int_distribution<unsigned long> s_udist(i, peer_list.size() - 1);
+                std::swap(peer_list[i], peer_list[s_udist(sender_rng)]);
             }
+
+            this->peer_subsets.emplace_back(peer_list.begin(), peer_list.begin() + pool_size);
         }
+    }
 
-        // set the seed unique to the sending daemon
-        sender_rng.seed((unsigned long) hash_func(sender_daemon->mailbox_name));
+    /**
+     * @brief Internal method to choose a communication peer for the requesting network proximity daemon
+     * @param sender_daemon: the network daemon requesting a peer to communicate with next
+     * @return a shared_ptr to the network daemon that is the selected communication peer
+     */
+    std::shared_ptr<NetworkProximityDaemon>
+    NetworkProximityService::getCommunicationPeer(const std::shared_ptr<NetworkProximityDaemon> sender_daemon) {
 
-        std::shuffle(peer_list.begin(), peer_list.end(), sender_rng);
+        auto sender_itr = this->daemon_indices.find(sender_daemon.get());
+        if (sender_itr == this->daemon_indices.end()) {
+            throw std::runtime_error(
+                    "NetworkProximityService::getCommunicationPeer(): Unknown network proximity daemon");
+        }
+        unsigned long sender_index = sender_itr->second;
+        unsigned long position = this->peer_udist(this->master_rng);
 
-        unsigned long chosen_peer_index = peer_list.at(m_udist(master_rng));
+        unsigned long chosen_peer_index;
+        if (this->peer_subsets.empty()) {
+            // the pool is all the other daemons: skip over the sender
+            chosen_peer_index = (position < sender_index) ? position : position + 1;
+        } else {
+            chosen_peer_index = this->peer_subsets[sender_index][position];
+        }
 
-        return std::shared_ptr<NetworkProximityDaemon>(this->network_daemons.at(chosen_peer_index));
+        return this->network_daemons[chosen_peer_index];
+    }
+
+    /**
+     * @brief Internal method to compute the Vivaldi distance between two hosts
+     * @param host1: a hostname
+     * @param host2: a hostname
+     * @param timestamp: a pointer to a double set to the oldest timestamp of the two coordinates (unchanged if unknown)
+     * @return the distance between the two hosts (or NOT_AVAILABLE if a host is unknown)
+     */
+    double NetworkProximityService::getVivaldiDistance(const std::string &host1, const std::string &host2,
+                                                       double *timestamp) {
+        auto index1 = this->vivaldi_host_indices.find(host1);
+        auto index2 = this->vivaldi_host_indices.find(host2);
+
+        if ((index1 == this->vivaldi_host_indices.end()) or (index2 == this->vivaldi_host_indices.end())) {
+            return NetworkProximityService::NOT_AVAILABLE;
+        }
+
+        *timestamp = std::min(this->vivaldi_timestamps[index1->second], this->vivaldi_timestamps[index2->second]);
+        return vivaldiDistance(&(this->vivaldi_coordinates[index1->second * this->vivaldi_stride]),
+                               &(this->vivaldi_coordinates[index2->second * this->vivaldi_stride]),
+                               this->vivaldi_dimensions, this->vivaldi_height);
+    }
+
+    /**
+     * @brief Internal method to get the analytical distance between two hosts, which is computed
+     *        on the first request and cached
+     * @param host1: a hostname
+     * @param host2: a hostname
+     * @return the distance between the two hosts (or NOT_AVAILABLE if a host is unknown)
+     */
+    double NetworkProximityService::getAnalyticalDistance(const std::string &host1, const std::string &host2) {
+        auto key = std::make_pair(host1, host2);
+        auto cached = this->analytical_cache.find(key);
+        if (cached != this->analytical_cache.end()) {
+            return cached->second;
+        }
+        double distance = analyticalDistance(host1, host2,
+                                             this->getPropertyValueAsDouble(
+                                                     NetworkProximityServiceProperty::NETWORK_PROXIMITY_MESSAGE_SIZE),
+                                             this->getPropertyValueAsDouble(
+                                                     NetworkProximityServiceProperty::NETWORK_PROXIMITY_ANALYTICAL_NOISE),
+                                             this->getPropertyValueAsUnsignedLong(
+                                                     NetworkProximityServiceProperty::NETWORK_PROXIMITY_PEER_LOOKUP_SEED));
+        this->analytical_cache.insert(std::make_pair(key, distance));
+        return distance;
     }
 
     /**
@@ -445,70 +688,53 @@ namespace wrench {
      * @param sender_hostname: the host at which the sending network daemon resides
      * @param peer_hostname: the host at which the receiving network daemon resides
      */
-    void NetworkProximityService::vivaldiUpdate(double proximity_value, std::string sender_hostname,
-                                                std::string peer_hostname) {
-
-        const std::complex<double> sensitivity(0.25, 0.25);
+    void NetworkProximityService::vivaldiUpdate(double proximity_value, const std::string &sender_hostname,
+                                                const std::string &peer_hostname) {
 
-        std::complex<double> sender_coordinates, peer_coordinates;
-
-        auto search = this->coordinate_lookup_table.find(
-                sender_hostname);
-        if (search != this->coordinate_lookup_table.end()) {
-            sender_coordinates = search->second.first;
+        auto sender_index = this->vivaldi_host_indices.find(sender_hostname);
+        auto peer_index = this->vivaldi_host_indices.find(peer_hostname);
+        if ((sender_index == this->vivaldi_host_indices.end()) or (peer_index == this->vivaldi_host_indices.end())) {
+            return;
         }
 
-        search = this->coordinate_lookup_table.find(peer_hostname);
-        if (search != this->coordinate_lookup_table.end()) {
-            peer_coordinates = search->second.first;
-        }
+        unsigned long stride = this->vivaldi_stride;
+        unsigned long dimensions = this->vivaldi_dimensions;
+        double *sender_coordinates = &(this->vivaldi_coordinates[sender_index->second * stride]);
+        const double *peer_coordinates = &(this->vivaldi_coordinates[peer_index->second * stride]);
+        double *direction = this->vivaldi_direction.data();
 
-        double estimated_distance = std::sqrt(norm(peer_coordinates - sender_coordinates));
+        double estimated_distance = vivaldiDistance(sender_coordinates, peer_coordinates, dimensions,
+                                                    this->vivaldi_height);
         double error = proximity_value - estimated_distance;
 
-        std::complex<double> error_direction, scaled_direction;
-
         // if both coordinates are at the origin, we need a random direction vector
         if (estimated_distance == 0.0) {
-            // TODO: maybe use time(0) from <ctime> as seed: This is just done once! Or just use master_rng?
             static std::default_random_engine direction_rng(0);
             static std::uniform_real_distribution<double> dir_dist(-0.00000000001, 0.00000000001);
 
-            error_direction.real(dir_dist(direction_rng));
-            error_direction.imag(dir_dist(direction_rng));
+            for (unsigned long d = 0; d < dimensions; d++) {
+                direction[d] = dir_dist(direction_rng);
+            }
+            if (this->vivaldi_height) {
+                direction[dimensions] = std::abs(dir_dist(direction_rng));
+            }
         } else {
-            error_direction = sender_coordinates - peer_coordinates;
-        }
-
-        // scaled_direction will get start to approach 0 when error_direction gets small
-        scaled_direction = error_direction * error;
-
-        // compute the updated sender coordinates
-        auto updated_sender_coordinates = sender_coordinates + (scaled_direction * sensitivity);
-
-        // update the coordinate_lookup_table with the updated sender_coordinates
-        search = this->coordinate_lookup_table.find(sender_hostname);
-        if (search != this->coordinate_lookup_table.end()) {
-            search->second.first = updated_sender_coordinates;
-            search->second.second = Simulation::getCurrentSimulatedDate();
+            for (unsigned long d = 0; d < dimensions; d++) {
+                direction[d] = sender_coordinates[d] - peer_coordinates[d];
+            }
+            if (this->vivaldi_height) {
+                direction[dimensions] = sender_coordinates[dimensions] + peer_coordinates[dimensions];
+            }
         }
 
-        WRENCH_DEBUG("Vivaldi updated coordinates of %s from (%f,%f) to (%f,%f)", sender_hostname.c_str(),
-                     sender_coordinates.real(), sender_coordinates.imag(), updated_sender_coordinates.real(),
-                     updated_sender_coordinates.imag());
+        // the update approaches 0 as the error gets small
+        vivaldiKernel(sender_coordinates, direction, dimensions, this->vivaldi_height, error);
 
-        // WRITING VIVALDI RESULTS FOR DEBUGGING
-//        std::ofstream output("/home/ryan/Dropbox/Spring18/GRAD_PROJECT/vivaldi_visual/coordinate_table.txt", std::ofstream::app);
-//
-//        std::map<std::string, std::complex<double>>::iterator it;
-//        output.precision(std::numeric_limits<double>::max_digits10);
-//        for (it = this->coordinate_lookup_table.begin(); it != this->coordinate_lookup_table.end(); ++it) {
-//            output << std::setw(15) << it->first + " | " << std::fixed << it->second.real() << " | " << std::fixed << it->second.imag() << std::endl;
-//        }
-//        output << "*" << std::endl;
-//        output.close();
-        // END WRITING VIVALDI RESULTS
+        this->vivaldi_timestamps[sender_index->second] = Simulation::getCurrentSimulatedDate();
 
+        WRENCH_DEBUG("Vivaldi updated coordinates of %s (distance to %s: %lf -> %lf)", sender_hostname.c_str(),
+                     peer_hostname.c_str(), estimated_distance,
+                     vivaldiDistance(sender_coordinates, peer_coordinates, dimensions, this->vivaldi_height));
     }
 
     /**
@@ -530,7 +756,8 @@ namespace wrench {
         std::string network_service_type = this->getPropertyValueAsString(
                 NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE);
 
-        if (!boost::iequals(network_service_type, "alltoall") && !boost::iequals(network_service_type, "vivaldi")) {
+        if (!boost::iequals(network_service_type, "alltoall") && !boost::iequals(network_service_type, "vivaldi") &&
+            !boost::iequals(network_service_type, "analytical")) {
             throw std::invalid_argument(
                     error_prefix + "Invalid network proximity service type '" +
                     network_service_type +
@@ -600,6 +827,32 @@ namespace wrench {
 //                                            NetworkProximityServiceMessagePayload::NETWORK_DAEMON_MEASUREMENT_REPORTING_PAYLOAD));
 //      }
 
+        if (boost::iequals(network_service_type, "vivaldi")) {
+            unsigned long dimensions;
+            try {
+                dimensions = this->getPropertyValueAsUnsignedLong(
+                        NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_DIMENSIONS);
+                this->getPropertyValueAsBoolean(NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_HEIGHT);
+            } catch (std::invalid_argument &e) {
+                throw std::invalid_argument(error_prefix + e.what());
+            }
+            if ((dimensions < 1) or (dimensions == ULONG_MAX)) {
+                throw std::invalid_argument(error_prefix + "Invalid NETWORK_PROXIMITY_VIVALDI_DIMENSIONS value " +
+                                            this->getPropertyValueAsString(
+                                                    NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_DIMENSIONS));
+            }
+        }
+
+        if (boost::iequals(network_service_type, "analytical")) {
+            double noise = this->getPropertyValueAsDouble(
+                    NetworkProximityServiceProperty::NETWORK_PROXIMITY_ANALYTICAL_NOISE);
+            if ((noise < 0) or (noise >= 1)) {
+                throw std::invalid_argument(error_prefix + "Invalid NETWORK_PROXIMITY_ANALYTICAL_NOISE value " +
+                                            this->getPropertyValueAsString(
+                                                    NetworkProximityServiceProperty::NETWORK_PROXIMITY_ANALYTICAL_NOISE));
+            }
+        }
+
         if (this->getPropertyValueAsDouble(NetworkProximityServiceProperty::LOOKUP_OVERHEAD) < 0) {
             throw std::invalid_argument(error_prefix + "Invalid LOOKUP_OVERHEAD value " +
                                         this->getPropertyValueAsString(
@@ -634,4 +887,125 @@ namespace wrench {
     std::vector<std::string> NetworkProximityService::getHostnameList() {
         return this->hosts_in_network;
     }
+
+    /**
+     * @brief Internal method to build a full snapshot of the proximity data
+     * @return a snapshot
+     */
+    NetworkProximitySnapshot NetworkProximityService::getSnapshot() {
+        NetworkProximitySnapshot snapshot;
+        snapshot.vivaldi = this->vivaldi;
+        snapshot.vivaldi_dimensions = this->vivaldi_dimensions;
+        snapshot.vivaldi_height = this->vivaldi_height;
+        if (this->analytical) {
+            // Subscribers compute (and cache) the same deterministic estimates locally
+            snapshot.analytical = true;
+            snapshot.analytical_message_size = this->getPropertyValueAsDouble(
+                    NetworkProximityServiceProperty::NETWORK_PROXIMITY_MESSAGE_SIZE);
+            snapshot.analytical_noise = this->getPropertyValueAsDouble(
+                    NetworkProximityServiceProperty::NETWORK_PROXIMITY_ANALYTICAL_NOISE);
+            snapshot.analytical_seed = this->getPropertyValueAsUnsignedLong(
+                    NetworkProximityServiceProperty::NETWORK_PROXIMITY_PEER_LOOKUP_SEED);
+        } else if (snapshot.vivaldi) {
+            for (auto const &h : this->vivaldi_host_indices) {
+                auto begin = this->vivaldi_coordinates.begin() + h.second * this->vivaldi_stride;
+                snapshot.coordinates[h.first] = std::make_pair(
+                        std::vector<double>(begin, begin + this->vivaldi_stride), this->vivaldi_timestamps[h.second]);
+            }
+        } else {
+            snapshot.entries = this->entries;
+        }
+        return snapshot;
+    }
+
+    /**
+     * @brief Internal method to push the proximity data that a new measurement has changed to all subscribers
+     * @param hosts: the pair of hosts that was measured
+     */
+    void NetworkProximityService::pushSnapshotUpdate(std::pair<std::string, std::string> hosts) {
+        if (this->snapshot_subscriber_mailboxes.empty()) {
+            return;
+        }
+
+        NetworkProximitySnapshot update;
+        update.vivaldi = this->vivaldi;
+        update.vivaldi_dimensions = this->vivaldi_dimensions;
+        update.vivaldi_height = this->vivaldi_height;
+        if (update.vivaldi) {
+            // Only the coordinates of the sender host are updated by a measurement
+            auto index = this->vivaldi_host_indices.find(hosts.first);
+            if (index == this->vivaldi_host_indices.end()) {
+                return;
+            }
+            auto begin = this->vivaldi_coordinates.begin() + index->second * this->vivaldi_stride;
+            update.coordinates[hosts.first] = std::make_pair(
+                    std::vector<double>(begin, begin + this->vivaldi_stride), this->vivaldi_timestamps[index->second]);
+        } else {
+            update.entries.insert(std::make_pair(hosts, this->entries[hosts]));
+        }
+
+        for (auto const &mailbox : this->snapshot_subscriber_mailboxes) {
+            S4U_Mailbox::dputMessage(mailbox,
+                                     new NetworkProximitySnapshotMessage(this, update,
+                                                                         this->getMessagePayloadValue(
+                                                                                 NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+        }
+    }
+
+    /**
+     * @brief Merge a (partial) snapshot into this snapshot
+     * @param update: a snapshot
+     */
+    void NetworkProximitySnapshot::update(const NetworkProximitySnapshot &update) {
+        this->vivaldi = update.vivaldi;
+        this->vivaldi_dimensions = update.vivaldi_dimensions;
+        this->vivaldi_height = update.vivaldi_height;
+        this->analytical = update.analytical;
+        this->analytical_message_size = update.analytical_message_size;
+        this->analytical_noise = update.analytical_noise;
+        this->analytical_seed = update.analytical_seed;
+        for (auto const &e : update.entries) {
+            this->entries[e.first] = e.second;
+        }
+        for (auto const &c : update.coordinates) {
+            this->coordinates[c.first] = c.second;
+        }
+    }
+
+    /**
+     * @brief Compute the distance between two hosts, in the same way as NetworkProximityService::getHostPairDistance()
+     * @param host1: a hostname
+     * @param host2: a hostname
+     * @return the proximity value between the two hosts (or NetworkProximityService::NOT_AVAILABLE if none)
+     */
+    double NetworkProximitySnapshot::getHostPairDistance(const std::string &host1, const std::string &host2) const {
+        if (host1 == host2) {
+            return 0.0;
+        }
+        if (this->analytical) {
+            auto key = std::make_pair(host1, host2);
+            auto cached = this->analytical_cache.find(key);
+            if (cached != this->analytical_cache.end()) {
+                return cached->second;
+            }
+            double distance = analyticalDistance(host1, host2, this->analytical_message_size,
+                                                 this->analytical_noise, this->analytical_seed);
+            this->analytical_cache.insert(std::make_pair(key, distance));
+            return distance;
+        }
+        if (this->vivaldi) {
+            auto c1 = this->coordinates.find(host1);
+            auto c2 = this->coordinates.find(host2);
+            if ((c1 != this->coordinates.end()) and (c2 != this->coordinates.end())) {
+                return vivaldiDistance(c1->second.first.data(), c2->second.first.data(),
+                                       this->vivaldi_dimensions, this->vivaldi_height);
+            }
+        } else {
+            auto e = this->entries.find(std::make_pair(host1, host2));
+            if (e != this->entries.end()) {
+                return e->second.first;
+            }
+        }
+        return NetworkProximityService::NOT_AVAILABLE;
+    }
 }
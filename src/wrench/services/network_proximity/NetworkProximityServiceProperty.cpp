@@ -26,4 +26,10 @@ namespace wrench {
     SET_PROPERTY_NAME(NetworkProximityServiceProperty, NETWORK_DAEMON_COMMUNICATION_COVERAGE);
 
     SET_PROPERTY_NAME(NetworkProximityServiceProperty, NETWORK_PROXIMITY_PEER_LOOKUP_SEED);
+
+    SET_PROPERTY_NAME(NetworkProximityServiceProperty, NETWORK_PROXIMITY_VIVALDI_DIMENSIONS);
+
+    SET_PROPERTY_NAME(NetworkProximityServiceProperty, NETWORK_PROXIMITY_VIVALDI_HEIGHT);
+
+    SET_PROPERTY_NAME(NetworkProximityServiceProperty, NETWORK_PROXIMITY_ANALYTICAL_NOISE);
 };
\ No newline at end of file
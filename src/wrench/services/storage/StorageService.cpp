@@ -408,46 +408,66 @@ namespace wrench {
     }
 
     /**
-     * @brief Synchronously and sequentially read a set of files from storage services
+     * @brief Synchronously read a set of files from storage services, in file ID order, with
+     *        at most some number of reads in progress at a time
      *
      * @param locations: a map of files to locations
+     * @param max_num_concurrent_operations: the maximum number of concurrent reads (1: files are read sequentially)
+     * @param callback: a callback invoked when each file read starts, completes, or fails (nullptr: none)
      *
      * @throw std::runtime_error
+     * @throw std::invalid_argument
      * @throw WorkflowExecutionException
      */
-    void StorageService::readFiles(std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations) {
-        StorageService::writeOrReadFiles(READ, std::move(locations));
+    void StorageService::readFiles(std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations,
+                                   unsigned long max_num_concurrent_operations,
+                                   const FileOperationCallback &callback) {
+        StorageService::writeOrReadFiles(READ, std::move(locations), max_num_concurrent_operations, callback);
     }
 
     /**
-     * @brief Synchronously and sequentially upload a set of files from storage services
+     * @brief Synchronously write a set of files to storage services, in file ID order, with
+     *        at most some number of writes in progress at a time
      *
      * @param locations: a map of files to locations
+     * @param max_num_concurrent_operations: the maximum number of concurrent writes (1: files are written sequentially)
+     * @param callback: a callback invoked when each file write starts, completes, or fails (nullptr: none)
      *
      * @throw std::runtime_error
+     * @throw std::invalid_argument
      * @throw WorkflowExecutionException
      */
-    void StorageService::writeFiles(std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations) {
-        StorageService::writeOrReadFiles(WRITE, std::move(locations));
+    void StorageService::writeFiles(std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations,
+                                    unsigned long max_num_concurrent_operations,
+                                    const FileOperationCallback &callback) {
+        StorageService::writeOrReadFiles(WRITE, std::move(locations), max_num_concurrent_operations, callback);
     }
 
     /**
-     * @brief Synchronously and sequentially write/read a set of files to/from storage services
+     * @brief Synchronously write/read a set of files to/from storage services
      *
      * @param action: FileOperation::READ (download) or FileOperation::WRITE
      * @param locations: a map of files to locations
+     * @param max_num_concurrent_operations: the maximum number of concurrent operations
+     * @param callback: a callback invoked when each file operation starts, completes, or fails (nullptr: none)
      *
      * @throw std::runtime_error
+     * @throw std::invalid_argument
      * @throw WorkflowExecutionException
      */
     void StorageService::writeOrReadFiles(FileOperation action,
-                                          std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations) {
+                                          std::map<WorkflowFile *, std::shared_ptr<FileLocation>> locations,
+                                          unsigned long max_num_concurrent_operations,
+                                          const FileOperationCallback &callback) {
 
         for (auto const &f : locations) {
             if ((f.first == nullptr) or (f.second == nullptr)) {
                 throw std::invalid_argument("StorageService::writeOrReadFiles(): invalid argument");
             }
         }
+        if (max_num_concurrent_operations == 0) {
+            throw std::invalid_argument("StorageService::writeOrReadFiles(): the maximum number of concurrent operations should be at least 1");
+        }
 
         // Create a temporary sorted list of files so that the order in which files are read/written is deterministic!
         std::map<std::string, WorkflowFile *> sorted_files;
@@ -455,23 +475,303 @@ namespace wrench {
             sorted_files[f.first->getID()] = f.first;
         }
 
+        if ((max_num_concurrent_operations > 1) and (sorted_files.size() > 1)) {
+            StorageService::writeOrReadFilesConcurrently(action, sorted_files, locations,
+                                                         max_num_concurrent_operations, callback);
+            return;
+        }
+
         for (auto const &f : sorted_files) {
             auto file = f.second;
             auto location = locations[file];
 
-            if (action == READ) {
-                WRENCH_INFO("Reading file %s from location %s",
-                            file->getID().c_str(),
-                            location->toString().c_str());
-                StorageService::readFile(file, location);
-                WRENCH_INFO("File %s read", file->getID().c_str());
+            if (callback) {
+                callback(file, location, FILE_OPERATION_STARTED);
+            }
+            try {
+                if (action == READ) {
+                    WRENCH_INFO("Reading file %s from location %s",
+                                file->getID().c_str(),
+                                location->toString().c_str());
+                    StorageService::readFile(file, location);
+                    WRENCH_INFO("File %s read", file->getID().c_str());
+                } else {
+                    WRENCH_INFO("Writing file %s to location %s",
+                                file->getID().c_str(),
+                                location->toString().c_str());
+                    StorageService::writeFile(file, location);
+                    WRENCH_INFO("File %s written", file->getID().c_str());
+                }
+            } catch (WorkflowExecutionException &e) {
+                if (callback) {
+                    callback(file, location, FILE_OPERATION_FAILED);
+                }
+                throw;
+            }
+            if (callback) {
+                callback(file, location, FILE_OPERATION_COMPLETED);
+            }
+        }
+    }
+
+    /**
+     * @brief Write/read a set of files to/from storage services with several operations in progress
+     *        at a time. Operations are started in file ID order, and each of them goes through the
+     *        same message exchanges as readFile()/writeFile(), but the calling actor waits for
+     *        whichever pending communication completes first rather than for each operation in turn.
+     *        As in readFile()/writeFile(), waiting for an answer or an ack times out after the storage
+     *        service's network timeout, counted from when that wait began. If an operation fails
+     *        (or times out), no further operation is started, the ones in progress are completed
+     *        (or fail), and the first failure is thrown.
+     *
+     * @param action: FileOperation::READ (download) or FileOperation::WRITE
+     * @param sorted_files: the files, sorted by ID
+     * @param locations: a map of files to locations
+     * @param max_num_concurrent_operations: the maximum number of concurrent operations
+     * @param callback: a callback invoked when each file operation starts, completes, or fails (nullptr: none)
+     *
+     * @throw std::runtime_error
+     * @throw WorkflowExecutionException
+     */
+    void StorageService::writeOrReadFilesConcurrently(FileOperation action,
+                                                      const std::map<std::string, WorkflowFile *> &sorted_files,
+                                                      std::map<WorkflowFile *, std::shared_ptr<FileLocation>> &locations,
+                                                      unsigned long max_num_concurrent_operations,
+                                                      const FileOperationCallback &callback) {
+
+        enum Phase {
+            WAITING_FOR_ANSWER,
+            RECEIVING_CHUNKS,
+            SENDING_CHUNKS,
+            WAITING_FOR_ACK
+        };
+
+        struct Operation {
+            WorkflowFile *file;
+            std::shared_ptr<FileLocation> location;
+            std::shared_ptr<StorageService> storage_service;
+            std::string answer_mailbox;
+            std::string data_write_mailbox;
+            double remaining_bytes;
+            bool last_chunk_sent;
+            Phase phase;
+            double deadline;
+            std::shared_ptr<S4U_PendingCommunication> pending_comm;
+        };
+
+        std::vector<std::shared_ptr<Operation>> operations;
+        auto next_file = sorted_files.begin();
+        std::shared_ptr<WorkflowExecutionException> first_failure = nullptr;
+
+        // Start waiting for an answer or an ack, which times out at a fixed date (<0 means: never)
+        auto start_waiting = [](const std::shared_ptr<Operation> &op, Phase phase) {
+            op->phase = phase;
+            double network_timeout = op->storage_service->network_timeout;
+            op->deadline = (network_timeout < 0) ? -1 : S4U_Simulation::getClock() + network_timeout;
+            op->pending_comm = S4U_Mailbox::igetMessage(op->answer_mailbox);
+        };
+
+        // Send the next chunk of a file being written
+        auto send_next_chunk = [](const std::shared_ptr<Operation> &op) {
+            auto buffer_size = (double) op->storage_service->buffer_size;
+            if (op->remaining_bytes > buffer_size) {
+                op->pending_comm = S4U_Mailbox::iputMessage(
+                        op->data_write_mailbox,
+                        new StorageServiceFileContentChunkMessage(op->file, buffer_size, false));
+                op->remaining_bytes -= buffer_size;
             } else {
-                WRENCH_INFO("Writing file %s to location %s",
-                            file->getID().c_str(),
-                            location->toString().c_str());
-                StorageService::writeFile(file, location);
-                WRENCH_INFO("File %s written", file->getID().c_str());
+                op->pending_comm = S4U_Mailbox::iputMessage(
+                        op->data_write_mailbox,
+                        new StorageServiceFileContentChunkMessage(op->file, op->remaining_bytes, true));
+                op->last_chunk_sent = true;
             }
+            op->phase = SENDING_CHUNKS;
+        };
+
+        while (true) {
+
+            // Start operations, up to the limit (unless something has failed)
+            while ((first_failure == nullptr) and (next_file != sorted_files.end()) and
+                   (operations.size() < max_num_concurrent_operations)) {
+                auto op = std::make_shared<Operation>();
+                op->file = next_file->second;
+                op->location = locations[op->file];
+                op->storage_service = op->location->getStorageService();
+                op->last_chunk_sent = false;
+                next_file++;
+
+                if (callback) {
+                    callback(op->file, op->location, FILE_OPERATION_STARTED);
+                }
+
+                try {
+                    assertServiceIsUp(op->storage_service);
+                    if (op->storage_service->buffer_size == 0) {
+                        throw std::runtime_error(
+                                "StorageService::writeOrReadFilesConcurrently(): Zero buffer size not implemented yet");
+                    }
+                    if (action == READ) {
+                        WRENCH_INFO("Reading file %s from location %s",
+                                    op->file->getID().c_str(), op->location->toString().c_str());
+                        op->answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("read_file");
+                        S4U_Mailbox::putMessage(op->storage_service->mailbox_name,
+                                                new StorageServiceFileReadRequestMessage(
+                                                        op->answer_mailbox,
+                                                        op->answer_mailbox,
+                                                        op->file,
+                                                        op->location,
+                                                        op->storage_service->buffer_size,
+                                                        op->storage_service->getMessagePayloadValue(
+                                                                StorageServiceMessagePayload::FILE_READ_REQUEST_MESSAGE_PAYLOAD)));
+                    } else {
+                        WRENCH_INFO("Writing file %s to location %s",
+                                    op->file->getID().c_str(), op->location->toString().c_str());
+                        op->answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("write_file");
+                        S4U_Mailbox::putMessage(op->storage_service->mailbox_name,
+                                                new StorageServiceFileWriteRequestMessage(
+                                                        op->answer_mailbox,
+                                                        op->file,
+                                                        op->location,
+                                                        op->storage_service->buffer_size,
+                                                        op->storage_service->getMessagePayloadValue(
+                                                                StorageServiceMessagePayload::FILE_WRITE_REQUEST_MESSAGE_PAYLOAD)));
+                    }
+                    start_waiting(op, WAITING_FOR_ANSWER);
+                } catch (std::shared_ptr<NetworkError> &cause) {
+                    first_failure = std::make_shared<WorkflowExecutionException>(cause);
+                } catch (WorkflowExecutionException &e) {
+                    first_failure = std::make_shared<WorkflowExecutionException>(e);
+                }
+
+                if (first_failure != nullptr) {
+                    if (callback) {
+                        callback(op->file, op->location, FILE_OPERATION_FAILED);
+                    }
+                    break;
+                }
+                operations.push_back(op);
+            }
+
+            if (operations.empty()) {
+                break;
+            }
+
+            // Wait for something to happen, but no later than the earliest deadline of the operations
+            // that are waiting for an answer or an ack
+            unsigned long earliest_deadline_index = ULONG_MAX;
+            std::vector<S4U_PendingCommunication *> pending_comms;
+            for (unsigned long i = 0; i < operations.size(); i++) {
+                auto const &op = operations[i];
+                pending_comms.push_back(op->pending_comm.get());
+                if (((op->phase == WAITING_FOR_ANSWER) or (op->phase == WAITING_FOR_ACK)) and (op->deadline >= 0)) {
+                    if ((earliest_deadline_index == ULONG_MAX) or
+                        (op->deadline < operations[earliest_deadline_index]->deadline)) {
+                        earliest_deadline_index = i;
+                    }
+                }
+            }
+            double timeout = -1;
+            if (earliest_deadline_index != ULONG_MAX) {
+                timeout = std::max<double>(0, operations[earliest_deadline_index]->deadline - S4U_Simulation::getClock());
+            }
+            unsigned long index = S4U_PendingCommunication::waitForSomethingToHappen(pending_comms, timeout);
+
+            std::shared_ptr<FailureCause> failure_cause = nullptr;
+            std::shared_ptr<SimulationMessage> message = nullptr;
+            if (index == ULONG_MAX) {
+                // The operation with the earliest deadline has timed out, give up on it
+                index = earliest_deadline_index;
+                operations.at(index)->pending_comm->comm_ptr->cancel();
+                failure_cause = std::shared_ptr<NetworkError>(
+                        new NetworkError(NetworkError::RECEIVING, NetworkError::TIMEOUT,
+                                         operations.at(index)->answer_mailbox));
+            }
+
+            // Move the operation along
+            auto op = operations.at(index);
+            bool op_is_done = false;
+            if (failure_cause == nullptr) {
+                try {
+                    message = op->pending_comm->wait();
+                } catch (std::shared_ptr<NetworkError> &cause) {
+                    failure_cause = cause;
+                }
+            }
+
+            if (failure_cause == nullptr) {
+                switch (op->phase) {
+                    case WAITING_FOR_ANSWER:
+                        if (auto msg = std::dynamic_pointer_cast<StorageServiceFileReadAnswerMessage>(message)) {
+                            if (not msg->success) {
+                                failure_cause = msg->failure_cause;
+                                break;
+                            }
+                            op->phase = RECEIVING_CHUNKS;
+                            op->pending_comm = S4U_Mailbox::igetMessage(op->answer_mailbox);
+                        } else if (auto msg = std::dynamic_pointer_cast<StorageServiceFileWriteAnswerMessage>(message)) {
+                            if (not msg->success) {
+                                failure_cause = msg->failure_cause;
+                                break;
+                            }
+                            op->data_write_mailbox = msg->data_write_mailbox_name;
+                            op->remaining_bytes = op->file->getSize();
+                            send_next_chunk(op);
+                        } else {
+                            throw std::runtime_error("StorageService::writeOrReadFilesConcurrently(): Received an unexpected [" +
+                                                     message->getName() + "] message!");
+                        }
+                        break;
+
+                    case RECEIVING_CHUNKS:
+                        if (auto msg = std::dynamic_pointer_cast<StorageServiceFileContentChunkMessage>(message)) {
+                            if (msg->last_chunk) {
+                                start_waiting(op, WAITING_FOR_ACK);
+                            } else {
+                                op->pending_comm = S4U_Mailbox::igetMessage(op->answer_mailbox);
+                            }
+                        } else {
+                            throw std::runtime_error("StorageService::writeOrReadFilesConcurrently(): Received an unexpected [" +
+                                                     message->getName() + "] message!");
+                        }
+                        break;
+
+                    case SENDING_CHUNKS:
+                        if (op->last_chunk_sent) {
+                            start_waiting(op, WAITING_FOR_ACK);
+                        } else {
+                            send_next_chunk(op);
+                        }
+                        break;
+
+                    case WAITING_FOR_ACK:
+                        if (not std::dynamic_pointer_cast<StorageServiceAckMessage>(message)) {
+                            throw std::runtime_error("StorageService::writeOrReadFilesConcurrently(): Received an unexpected [" +
+                                                     message->getName() + "] message!");
+                        }
+                        op_is_done = true;
+                        break;
+                }
+            }
+
+            if (failure_cause != nullptr) {
+                if (first_failure == nullptr) {
+                    first_failure = std::make_shared<WorkflowExecutionException>(failure_cause);
+                }
+                if (callback) {
+                    callback(op->file, op->location, FILE_OPERATION_FAILED);
+                }
+                operations.erase(operations.begin() + index);
+            } else if (op_is_done) {
+                WRENCH_INFO("File %s %s", op->file->getID().c_str(), (action == READ) ? "read" : "written");
+                if (callback) {
+                    callback(op->file, op->location, FILE_OPERATION_COMPLETED);
+                }
+                operations.erase(operations.begin() + index);
+            }
+        }
+
+        if (first_failure != nullptr) {
+            throw *first_failure;
         }
     }
 
@@ -309,6 +309,39 @@ namespace wrench {
         return std::make_pair(this->hasReturnedFromMain(), this->getReturnValue());
     }
 
+/**
+ * @brief Start a (daemonized) actor that waits for a daemon to exit, and then invokes a callback.
+ *        Unlike code invoked from the daemon's on_exit handler, the callback runs in the context of
+ *        a live actor, and can thus block (e.g., lock a mutex, signal a condition variable, send messages).
+ *        If the daemon has already exited, the callback is invoked right away.
+ *
+ * @param daemon: the daemon (which must have been started)
+ * @param hostname: the name of the host on which the watcher actor runs
+ * @param callback: a callback that takes as arguments whether the daemon returned from main() and
+ *        the value returned by main() (if it did)
+ *
+ * @throw std::runtime_error
+ */
+    void S4U_Daemon::startExitWatcher(std::shared_ptr<S4U_Daemon> daemon, const std::string &hostname,
+                                      std::function<void(bool has_returned_from_main, int return_value)> callback) {
+        if (daemon->s4u_actor == nullptr) {
+            throw std::runtime_error("S4U_Daemon::startExitWatcher(): Fatal error: the daemon hasn't been started");
+        }
+        try {
+            simgrid::s4u::Actor::create(("exit_watcher_for_" + daemon->getName()).c_str(),
+                                        simgrid::s4u::Host::by_name(hostname),
+                                        [daemon, callback]() {
+                                            // Daemonized from within, since daemonizing an actor that has
+                                            // already returned terminates the calling actor
+                                            simgrid::s4u::Actor::self()->daemonize();
+                                            auto return_values_from_join = daemon->join();
+                                            callback(return_values_from_join.first, return_values_from_join.second);
+                                        });
+        } catch (simgrid::Exception &e) {
+            throw std::runtime_error("S4U_Daemon::startExitWatcher(): SimGrid actor creation failed... shouldn't happen.");
+        }
+    }
+
 /**
  * @brief Returns true if the daemon has returned from main() (i.e., not brutally killed)
  * @return The true or false
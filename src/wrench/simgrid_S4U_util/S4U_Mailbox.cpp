@@ -100,6 +100,17 @@ namespace wrench {
         return std::shared_ptr<SimulationMessage>(msg);
     }
 
+    /**
+     * @brief Check whether a message has been sent to a mailbox and is waiting to be received,
+     *        so that it can be received without blocking
+     *
+     * @param mailbox_name: the mailbox name
+     * @return true if a message is pending, false otherwise
+     */
+    bool S4U_Mailbox::hasPendingMessage(std::string mailbox_name) {
+        return simgrid::s4u::Mailbox::by_name(mailbox_name)->listen();
+    }
+
     /**
      * @brief Synchronously send a message to a mailbox
      *
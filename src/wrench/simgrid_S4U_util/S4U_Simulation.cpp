@@ -239,6 +239,40 @@ namespace wrench {
         host->turn_on();
     }
 
+    /**
+     * @brief Get the latency and the bandwidth of the network route from a host to another host, as
+     *        defined in the platform description
+     *
+     * @param src_hostname: the name of the source host
+     * @param dst_hostname: the name of the destination host
+     * @return a pair:
+     *      - the route's latency (i.e., the sum of the latencies of its links), in seconds
+     *      - the route's bandwidth (i.e., the bandwidth of its bottleneck link), in bytes/sec (DBL_MAX if the route has no links)
+     *
+     * @throw std::invalid_argument
+     */
+    std::pair<double, double> S4U_Simulation::getRouteLatencyAndBandwidth(const std::string &src_hostname,
+                                                                          const std::string &dst_hostname) {
+        auto src_host = simgrid::s4u::Host::by_name_or_null(src_hostname);
+        if (src_host == nullptr) {
+            throw std::invalid_argument("Unknown hostname " + src_hostname);
+        }
+        auto dst_host = simgrid::s4u::Host::by_name_or_null(dst_hostname);
+        if (dst_host == nullptr) {
+            throw std::invalid_argument("Unknown hostname " + dst_hostname);
+        }
+
+        std::vector<simgrid::s4u::Link *> route;
+        double latency = 0;
+        src_host->route_to(dst_host, route, &latency);
+
+        double bandwidth = DBL_MAX;
+        for (auto const &link : route) {
+            bandwidth = std::min<double>(bandwidth, link->get_bandwidth());
+        }
+        return std::make_pair(latency, bandwidth);
+    }
+
     /**
     * @brief Returns whether a link is on or not
     *
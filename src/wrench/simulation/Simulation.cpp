@@ -19,6 +19,7 @@
 #include "wrench/services/Service.h"
 #include "wrench/services/compute/bare_metal/BareMetalComputeService.h"
 #include "wrench/services/file_registry/FileRegistryService.h"
+#include "wrench/services/helpers/TimerService.h"
 #include "wrench/services/storage/StorageService.h"
 #include "wrench/simulation/Simulation.h"
 #include "simgrid/plugins/energy.h"
@@ -347,7 +348,7 @@ namespace wrench {
             // Check that each input file is staged on the file registry services
             for (auto file : wms->workflow->getInputFiles()) {
                 for (auto frs : this->file_registry_services) {
-                    if (frs->entries.find(file) == frs->entries.end()) {
+                    if (frs->lookupEntryInDatabase(file).empty()) {
                         throw std::runtime_error(
                                 "Workflow input file " + file->getID() + " is not staged on any storage service!");
                     }
@@ -1026,6 +1027,35 @@ namespace wrench {
         return shared_ptr;
     }
 
+    /**
+     * @brief Get the timer service that runs on a host, starting it if need be. There
+     *        is at most one such service per host, which sends the messages of all the
+     *        timers registered on that host.
+     *
+     * @param hostname: the name of the host
+     * @return the timer service
+     *
+     * @throw std::runtime_error
+     * @throw std::shared_ptr<HostError>
+     */
+    std::shared_ptr<TimerService> Simulation::getTimerService(const std::string &hostname) {
+        if (not this->is_running) {
+            throw std::runtime_error("Simulation::getTimerService(): simulation is not running yet");
+        }
+
+        auto it = this->timer_services.find(hostname);
+        if ((it != this->timer_services.end()) and (it->second->isUp())) {
+            return it->second;
+        }
+
+        // Start a new timer service (e.g., the previous one died with its host)
+        auto timer_service = std::shared_ptr<TimerService>(new TimerService(hostname));
+        timer_service->simulation = this;
+        timer_service->start(timer_service, true, false); // Daemonized, no auto-restart
+        this->timer_services[hostname] = timer_service;
+        return timer_service;
+    }
+
     /**
      * @brief Checks that the platform is well defined
      * @throw std::invalid_argument
@@ -839,15 +839,24 @@ namespace wrench {
      * @param file_path: the path to write the file
      * @param writing_file: whether or not the file is written, true by default but will be false when utilized as part
      * of dumpUnifiedJSON
+     * @param sampling_period: if strictly positive, the consumed_energy_trace of each host is resampled at dates t0,
+     *        t0 + sampling_period, t0 + 2 * sampling_period, ... up to the date of its last recorded measurement (t0 being the
+     *        date of its first recorded measurement), by linear interpolation between recorded measurements. This
+     *        is exact for measurements recorded by an event-driven energy meter (see WMS::createEventDrivenEnergyMeter()).
+     *        (default: 0, meaning that recorded measurements are written as is)
      * @throws std::invalid_argument
      * @throws std::runtime_error
      */
-    void SimulationOutput::dumpHostEnergyConsumptionJSON(std::string file_path, bool writing_file) {
+    void SimulationOutput::dumpHostEnergyConsumptionJSON(std::string file_path, bool writing_file, double sampling_period) {
 
         if (file_path.empty()) {
             throw std::invalid_argument("SimulationOutput::dumpHostEnergyConsumptionJSON() requires a valid file_path");
         }
 
+        if (sampling_period < 0) {
+            throw std::invalid_argument("SimulationOutput::dumpHostEnergyConsumptionJSON() requires a non-negative sampling period");
+        }
+
         try {
 
             auto simgrid_engine = simgrid::s4u::Engine::get_instance();
@@ -904,15 +913,25 @@ namespace wrench {
 
                 }
 
+                std::vector<std::pair<double, double>> consumed_energy_trace;
                 for (const auto &energy_consumption_timestamp : this->getTrace<SimulationTimestampEnergyConsumption>()) {
                     if (host->get_name() == energy_consumption_timestamp->getContent()->getHostname()) {
-                        datum["consumed_energy_trace"].push_back({
-                                                                         {"time",   energy_consumption_timestamp->getDate()},
-                                                                         {"joules", energy_consumption_timestamp->getContent()->getConsumption()}
-                                                                 });
+                        consumed_energy_trace.push_back(std::make_pair(energy_consumption_timestamp->getDate(),
+                                                                       energy_consumption_timestamp->getContent()->getConsumption()));
                     }
                 }
 
+                if ((sampling_period > 0) and (not consumed_energy_trace.empty())) {
+                    consumed_energy_trace = resampleEnergyConsumptionTrace(consumed_energy_trace, sampling_period);
+                }
+
+                for (auto const &measurement : consumed_energy_trace) {
+                    datum["consumed_energy_trace"].push_back({
+                                                                     {"time",   measurement.first},
+                                                                     {"joules", measurement.second}
+                                                             });
+                }
+
                 hosts_energy_consumption_information.push_back(datum);
             }
 
@@ -935,6 +954,43 @@ namespace wrench {
         }
     }
 
+    /**
+     * @brief Resample an energy consumption trace at a fixed period, by linear interpolation
+     *        between the trace's measurements
+     * @param trace: a non-empty list of (date, consumed energy) measurements, sorted by date
+     * @param sampling_period: the sampling period (strictly positive)
+     * @return the resampled trace, from the date of the first measurement to the date of the last measurement
+     */
+    std::vector<std::pair<double, double>>
+    SimulationOutput::resampleEnergyConsumptionTrace(const std::vector<std::pair<double, double>> &trace,
+                                                     double sampling_period) {
+        std::vector<std::pair<double, double>> resampled_trace;
+
+        double start_date = trace.front().first;
+        double end_date = trace.back().first;
+        size_t segment = 0;
+
+        for (unsigned long i = 0; start_date + i * sampling_period <= end_date; i++) {
+            double date = start_date + i * sampling_period;
+            // Find the measurements in between which the date falls
+            while ((segment + 1 < trace.size()) and (trace[segment + 1].first < date)) {
+                segment++;
+            }
+            double joules;
+            if ((segment + 1 == trace.size()) or (trace[segment + 1].first == trace[segment].first)) {
+                joules = trace[segment].second;
+            } else {
+                double before_date = trace[segment].first;
+                double after_date = trace[segment + 1].first;
+                joules = trace[segment].second +
+                         (trace[segment + 1].second - trace[segment].second) * (date - before_date) /
+                         (after_date - before_date);
+            }
+            resampled_trace.push_back(std::make_pair(date, joules));
+        }
+        return resampled_trace;
+    }
+
     /**
      * @brief Writes a JSON file containing all hosts, network links, and the routes between each host.
      * 
@@ -10,7 +10,7 @@
 #include "wrench/wms/WMS.h"
 #include "wrench/exceptions/WorkflowExecutionException.h"
 #include "wrench/logging/TerminalOutput.h"
-#include "wrench/services/helpers/Alarm.h"
+#include "wrench/services/helpers/TimerService.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
 #include "wrench/simulation/Simulation.h"
 #include "wms/WMSMessage.h"
@@ -86,8 +86,8 @@ namespace wrench {
     void WMS::checkDeferredStart() {
         if (S4U_Simulation::getClock() < this->start_time) {
 
-            Alarm::createAndStartAlarm(this->simulation, this->start_time, this->hostname, this->mailbox_name,
-                                       new AlarmWMSDeferredStartMessage(0), "wms_start");
+            this->simulation->getTimerService(this->hostname)->setTimer(this->start_time, this->mailbox_name,
+                                                                        new AlarmWMSDeferredStartMessage(0));
 
             // Wait for a message
             std::shared_ptr<SimulationMessage> message = nullptr;
@@ -388,6 +388,22 @@ namespace wrench {
         return energy_meter;
     }
 
+    /**
+     * @brief Instantiate and start an event-driven energy meter, which records energy consumption only
+     *        when the power consumption of a metered host may change (see SimulationOutput::dumpHostEnergyConsumptionJSON()
+     *        to reconstruct periodic measurements)
+     * @param hostnames: the list of metered hosts, as hostnames
+     * @return an energy meter
+     */
+    std::shared_ptr<EnergyMeterService>
+    WMS::createEventDrivenEnergyMeter(const std::vector<std::string> &hostnames) {
+        auto energy_meter_raw_ptr = new EnergyMeterService(this->hostname, hostnames);
+        std::shared_ptr<EnergyMeterService> energy_meter = std::shared_ptr<EnergyMeterService>(energy_meter_raw_ptr);
+        energy_meter->simulation = this->simulation;
+        energy_meter->start(energy_meter, true, false); // Always daemonize, no auto-restart
+        return energy_meter;
+    }
+
 
     /**
      * @brief Get the WMS's pilot scheduler
@@ -411,10 +427,11 @@ namespace wrench {
      * @brief Sets a timer (which, when it goes off, will generate a TimerEvent)
      * @param date: the date at which the timer should go off
      * @param message: a string message that will be in the generated TimerEvent
+     * @return a handle that can be used to cancel the timer
      */
-    void WMS::setTimer(double date, std::string message) {
-        Alarm::createAndStartAlarm(this->simulation, date, this->hostname, this->getWorkflow()->callback_mailbox,
-                                   new AlarmWMSTimerMessage(message, 0), "wms_timer");
+    std::shared_ptr<Timer> WMS::setTimer(double date, std::string message) {
+        return this->simulation->getTimerService(this->hostname)->setTimer(date, this->getWorkflow()->callback_mailbox,
+                                                                           new AlarmWMSTimerMessage(message, 0));
     }
 
 };
@@ -135,6 +135,9 @@ namespace wrench {
 
         // Remove the task from the DAG
         this->dag.removeVertex(task);
+        for (auto const &child : children) {
+            child->updateNotCompletedParentCounts(task, false);
+        }
 
         // Remove the task from the master list
         tasks.erase(tasks.find(task->id));
@@ -182,6 +185,7 @@ namespace wrench {
 
             WRENCH_DEBUG("Adding control dependency %s-->%s", src->getID().c_str(), dst->getID().c_str());
             this->dag.addEdge(src, dst);
+            dst->updateNotCompletedParentCounts(src, true);
 
             dst->updateTopLevel();
 
@@ -211,22 +215,20 @@ namespace wrench {
 
         /* If there is an edge between the two tasks, remove it */
         if (this->dag.doesEdgeExist(src, dst)) {
+            // Remove all (possibly parallel) edges
+            for (auto const &p : this->dag.getParents(dst)) {
+                if (p == src) {
+                    dst->updateNotCompletedParentCounts(src, false);
+                }
+            }
             this->dag.removeEdge(src, dst);
 
             dst->updateTopLevel();
 
             /* Update state */
-            if (dst->getState() == WorkflowTask::State::NOT_READY) {
-                bool ready = true;
-                for (auto const &p :  dst->getParents()) {
-                    if (p->getState() != WorkflowTask::State::COMPLETED) {
-                        ready = false;
-                        break;
-                    }
-                }
-                if (ready) {
-                    dst->setState(WorkflowTask::State::READY);
-                }
+            if ((dst->getState() == WorkflowTask::State::NOT_READY) and
+                (dst->getNumberOfVisiblyNotCompletedParents(false) == 0)) {
+                dst->setState(WorkflowTask::State::READY);
             }
         }
     }
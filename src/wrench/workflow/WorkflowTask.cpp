@@ -285,7 +285,13 @@ namespace wrench {
      */
     void WorkflowTask::setInternalState(WorkflowTask::InternalState state) {
 //      WRENCH_INFO("SETTING %s's INTERNAL STATE TO %s", this->getID().c_str(), WorkflowTask::stateToString(state).c_str());
+        bool was_completed = (this->internal_state == WorkflowTask::InternalState::TASK_COMPLETED);
         this->internal_state = state;
+        this->updateChildrenNotCompletedParentCounts(
+                was_completed,
+                this->visible_state == WorkflowTask::State::COMPLETED,
+                (this->visible_state == WorkflowTask::State::COMPLETED) or
+                (this->upcoming_visible_state == WorkflowTask::State::COMPLETED));
     }
 
     /**
@@ -335,7 +341,14 @@ namespace wrench {
                                      stateToString(state) + " when its internal " +
                                      "state is " + stateToString(this->internal_state));
         }
+        bool was_visibly_completed = (this->visible_state == WorkflowTask::State::COMPLETED);
+        bool was_visibly_or_upcoming_completed =
+                was_visibly_completed or (this->upcoming_visible_state == WorkflowTask::State::COMPLETED);
         this->visible_state = state;
+        this->updateChildrenNotCompletedParentCounts(
+                this->internal_state == WorkflowTask::InternalState::TASK_COMPLETED,
+                was_visibly_completed,
+                was_visibly_or_upcoming_completed);
     }
 
     /**
@@ -344,7 +357,86 @@ namespace wrench {
      * @param state: the task state
      */
     void WorkflowTask::setUpcomingState(WorkflowTask::State state) {
+        bool was_visibly_completed = (this->visible_state == WorkflowTask::State::COMPLETED);
+        bool was_visibly_or_upcoming_completed =
+                was_visibly_completed or (this->upcoming_visible_state == WorkflowTask::State::COMPLETED);
         this->upcoming_visible_state = state;
+        this->updateChildrenNotCompletedParentCounts(
+                this->internal_state == WorkflowTask::InternalState::TASK_COMPLETED,
+                was_visibly_completed,
+                was_visibly_or_upcoming_completed);
+    }
+
+    /**
+     * @brief Get the number of the task's parents whose internal state is not TASK_COMPLETED (a
+     *        parent is counted once per DAG edge)
+     * @return a number of parents
+     */
+    unsigned long WorkflowTask::getNumberOfNotCompletedParents() const {
+        return this->num_not_completed_parents;
+    }
+
+    /**
+     * @brief Get the number of the task's parents whose visible state is not COMPLETED (a parent
+     *        is counted once per DAG edge)
+     * @param count_upcoming_state: if true, a parent whose upcoming visible state is COMPLETED
+     *        (i.e., a WMS is about to find out that it has completed) is counted as completed
+     * @return a number of parents
+     */
+    unsigned long WorkflowTask::getNumberOfVisiblyNotCompletedParents(bool count_upcoming_state) const {
+        return count_upcoming_state ? this->num_visibly_or_upcoming_not_completed_parents
+                                    : this->num_visibly_not_completed_parents;
+    }
+
+    /**
+     * @brief Update the not-completed parent counts when a DAG edge from a parent is added or removed
+     * @param parent: the parent task
+     * @param add: true if the edge was added, false if it was removed
+     */
+    void WorkflowTask::updateNotCompletedParentCounts(const WorkflowTask *parent, bool add) {
+        if (parent->internal_state != WorkflowTask::InternalState::TASK_COMPLETED) {
+            add ? this->num_not_completed_parents++ : this->num_not_completed_parents--;
+        }
+        if (parent->visible_state != WorkflowTask::State::COMPLETED) {
+            add ? this->num_visibly_not_completed_parents++ : this->num_visibly_not_completed_parents--;
+            if (parent->upcoming_visible_state != WorkflowTask::State::COMPLETED) {
+                add ? this->num_visibly_or_upcoming_not_completed_parents++
+                    : this->num_visibly_or_upcoming_not_completed_parents--;
+            }
+        }
+    }
+
+    /**
+     * @brief Update the children's not-completed parent counts after one of this task's states has changed
+     * @param was_completed: whether the internal state was TASK_COMPLETED before the change
+     * @param was_visibly_completed: whether the visible state was COMPLETED before the change
+     * @param was_visibly_or_upcoming_completed: whether the visible or upcoming visible state was COMPLETED before the change
+     */
+    void WorkflowTask::updateChildrenNotCompletedParentCounts(bool was_completed, bool was_visibly_completed,
+                                                              bool was_visibly_or_upcoming_completed) {
+        bool is_completed = (this->internal_state == WorkflowTask::InternalState::TASK_COMPLETED);
+        bool is_visibly_completed = (this->visible_state == WorkflowTask::State::COMPLETED);
+        bool is_visibly_or_upcoming_completed =
+                is_visibly_completed or (this->upcoming_visible_state == WorkflowTask::State::COMPLETED);
+
+        if ((is_completed == was_completed) and (is_visibly_completed == was_visibly_completed) and
+            (is_visibly_or_upcoming_completed == was_visibly_or_upcoming_completed)) {
+            return;
+        }
+
+        for (auto child : this->workflow->getTaskChildren(this)) {
+            if (is_completed != was_completed) {
+                is_completed ? child->num_not_completed_parents-- : child->num_not_completed_parents++;
+            }
+            if (is_visibly_completed != was_visibly_completed) {
+                is_visibly_completed ? child->num_visibly_not_completed_parents--
+                                     : child->num_visibly_not_completed_parents++;
+            }
+            if (is_visibly_or_upcoming_completed != was_visibly_or_upcoming_completed) {
+                is_visibly_or_upcoming_completed ? child->num_visibly_or_upcoming_not_completed_parents--
+                                                 : child->num_visibly_or_upcoming_not_completed_parents++;
+            }
+        }
     }
 
     /**
@@ -397,6 +489,29 @@ namespace wrench {
         this->priority = priority;
     }
 
+    /**
+     * @brief Get the maximum number of input files (resp. output files) that are read (resp. written)
+     *        concurrently when the task runs. By default, this is 1 (i.e., files are read/written sequentially).
+     * @return a number of files
+     */
+    unsigned long WorkflowTask::getMaxNumConcurrentFileOperations() const {
+        return this->max_num_concurrent_file_operations;
+    }
+
+    /**
+     * @brief Set the maximum number of input files (resp. output files) that are read (resp. written)
+     *        concurrently when the task runs
+     * @param max_num_concurrent_file_operations: a number of files (at least 1)
+     *
+     * @throw std::invalid_argument
+     */
+    void WorkflowTask::setMaxNumConcurrentFileOperations(unsigned long max_num_concurrent_file_operations) {
+        if (max_num_concurrent_file_operations == 0) {
+            throw std::invalid_argument("WorkflowTask::setMaxNumConcurrentFileOperations(): argument should be at least 1");
+        }
+        this->max_num_concurrent_file_operations = max_num_concurrent_file_operations;
+    }
+
     /**
      * @brief Get the task average CPU usage
      * @return the task average CPU usage
@@ -0,0 +1,437 @@
+/**
+ * Copyright (c) 2017. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <math.h>
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "wrench/workflow/failure_causes/HostError.h"
+#include "../../include/TestWithFork.h"
+#include "../../include/UniqueTmpPathPrefix.h"
+
+WRENCH_LOG_CATEGORY(bare_metal_compute_service_analytical_jobs_test, "Log category for BareMetalComputeServiceAnalyticalJobsTest");
+
+#define EPSILON 0.01
+
+
+class BareMetalComputeServiceAnalyticalJobsTest : public ::testing::Test {
+
+public:
+    std::shared_ptr<wrench::ComputeService> full_cs = nullptr;
+    std::shared_ptr<wrench::ComputeService> analytical_cs = nullptr;
+
+    void do_AnalyticalVersusFull_test();
+    void do_AnalyticalJobTermination_test();
+    void do_AnalyticalJobHostFailure_test();
+
+    static bool isAboutTheSame(double base, double variable) {
+        return ((std::abs<double>(variable - base) < EPSILON));
+    }
+
+protected:
+    BareMetalComputeServiceAnalyticalJobsTest() {
+
+        // Create the simplest workflow
+        workflow = new wrench::Workflow();
+
+        // Create a platform with two identical quad-core hosts
+        std::string xml = "<?xml version='1.0'?>"
+                          "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                          "<platform version=\"4.1\"> "
+                          "   <zone id=\"AS0\" routing=\"Full\"> "
+                          "       <host id=\"Host1\" speed=\"1f\" core=\"4\"> "
+                          "            <prop id=\"ram\" value=\"1000B\"/> "
+                          "       </host> "
+                          "       <host id=\"Host2\" speed=\"1f\" core=\"4\"> "
+                          "            <prop id=\"ram\" value=\"1000B\"/> "
+                          "       </host> "
+                          "        <link id=\"1\" bandwidth=\"5000GBps\" latency=\"0us\"/>"
+                          "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+                          "   </zone> "
+                          "</platform>";
+        FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+        fprintf(platform_file, "%s", xml.c_str());
+        fclose(platform_file);
+
+    }
+
+    std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+    wrench::Workflow *workflow;
+};
+
+
+/**********************************************************************/
+/**  ANALYTICAL VERSUS FULL-FIDELITY TEST                            **/
+/**********************************************************************/
+
+class AnalyticalVersusFullTestWMS : public wrench::WMS {
+
+public:
+    AnalyticalVersusFullTestWMS(BareMetalComputeServiceAnalyticalJobsTest *test,
+                                const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+
+private:
+
+    BareMetalComputeServiceAnalyticalJobsTest *test;
+
+    // A fork-join job: task1 -> {task2, task3} -> task4
+    std::vector<wrench::WorkflowTask *> createTasks(std::string prefix) {
+        std::vector<wrench::WorkflowTask *> tasks;
+        tasks.push_back(this->getWorkflow()->addTask(prefix + "_task1", 400, 1, 4, 1.0, 0));
+        tasks.push_back(this->getWorkflow()->addTask(prefix + "_task2", 200, 1, 2, 1.0, 0));
+        tasks.push_back(this->getWorkflow()->addTask(prefix + "_task3", 300, 1, 2, 0.5, 0));
+        tasks.push_back(this->getWorkflow()->addTask(prefix + "_task4", 100, 1, 1, 1.0, 0));
+        this->getWorkflow()->addControlDependency(tasks[0], tasks[1]);
+        this->getWorkflow()->addControlDependency(tasks[0], tasks[2]);
+        this->getWorkflow()->addControlDependency(tasks[1], tasks[3]);
+        this->getWorkflow()->addControlDependency(tasks[2], tasks[3]);
+        return tasks;
+    }
+
+    int main() {
+
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        // Run the same job on both services
+        auto full_tasks = createTasks("full");
+        auto analytical_tasks = createTasks("analytical");
+        job_manager->submitJob(job_manager->createStandardJob(full_tasks, {}), this->test->full_cs);
+        job_manager->submitJob(job_manager->createStandardJob(analytical_tasks, {}), this->test->analytical_cs);
+
+        // Wait for completions
+        for (int i = 0; i < 2; i++) {
+            std::shared_ptr<wrench::WorkflowExecutionEvent> event;
+            try {
+                event = this->getWorkflow()->waitForNextExecutionEvent();
+            } catch (wrench::WorkflowExecutionException &e) {
+                throw std::runtime_error("Error while getting an execution event: " + e.getCause()->toString());
+            }
+            if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                throw std::runtime_error("Unexpected execution event: " + event->toString());
+            }
+        }
+
+        // Compare task executions
+        for (unsigned long i = 0; i < full_tasks.size(); i++) {
+            auto full = full_tasks[i];
+            auto analytical = analytical_tasks[i];
+            if (analytical->getState() != wrench::WorkflowTask::State::COMPLETED) {
+                throw std::runtime_error("Analytical task " + analytical->getID() + " should be completed");
+            }
+            if (analytical->getNumCoresAllocated() != full->getNumCoresAllocated()) {
+                throw std::runtime_error("Unexpected number of cores for analytical task " + analytical->getID() +
+                                         ": " + std::to_string(analytical->getNumCoresAllocated()) +
+                                         " (expected: " + std::to_string(full->getNumCoresAllocated()) + ")");
+            }
+            if ((not BareMetalComputeServiceAnalyticalJobsTest::isAboutTheSame(full->getStartDate(), analytical->getStartDate())) or
+                (not BareMetalComputeServiceAnalyticalJobsTest::isAboutTheSame(full->getEndDate(), analytical->getEndDate()))) {
+                throw std::runtime_error("Unexpected dates for analytical task " + analytical->getID() + ": [" +
+                                         std::to_string(analytical->getStartDate()) + ", " +
+                                         std::to_string(analytical->getEndDate()) + "] (expected: [" +
+                                         std::to_string(full->getStartDate()) + ", " +
+                                         std::to_string(full->getEndDate()) + "])");
+            }
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(BareMetalComputeServiceAnalyticalJobsTest, AnalyticalVersusFull) {
+    DO_TEST_WITH_FORK(do_AnalyticalVersusFull_test);
+}
+
+void BareMetalComputeServiceAnalyticalJobsTest::do_AnalyticalVersusFull_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto **argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("analytical_jobs_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create Compute Services
+    ASSERT_NO_THROW(full_cs = simulation->add(
+            new wrench::BareMetalComputeService("Host1", (std::vector<std::string>){"Host1"}, "",
+                                                {{wrench::BareMetalComputeServiceProperty::TASK_STARTUP_OVERHEAD, "1.0"}},
+                                                {})));
+    ASSERT_NO_THROW(analytical_cs = simulation->add(
+            new wrench::BareMetalComputeService("Host2", (std::vector<std::string>){"Host2"}, "",
+                                                {{wrench::BareMetalComputeServiceProperty::TASK_STARTUP_OVERHEAD, "1.0"},
+                                                 {wrench::BareMetalComputeServiceProperty::SIMULATE_JOBS_ANALYTICALLY, "true"}},
+                                                {})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new AnalyticalVersusFullTestWMS(this, {full_cs, analytical_cs}, "Host1")));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  ANALYTICAL JOB TERMINATION TEST                                 **/
+/**********************************************************************/
+
+class AnalyticalJobTerminationTestWMS : public wrench::WMS {
+
+public:
+    AnalyticalJobTerminationTestWMS(BareMetalComputeServiceAnalyticalJobsTest *test,
+                                    const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                    std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+
+private:
+
+    BareMetalComputeServiceAnalyticalJobsTest *test;
+
+    int main() {
+
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        auto task1 = this->getWorkflow()->addTask("task1", 100, 4, 4, 1.0, 0);
+        auto task2 = this->getWorkflow()->addTask("task2", 100, 4, 4, 1.0, 0);
+        this->getWorkflow()->addControlDependency(task1, task2);
+
+        // Submit the job, and check that it does not start any actor
+        auto num_actors = simgrid::s4u::Engine::get_instance()->get_actor_count();
+        auto job = job_manager->createStandardJob({task1, task2}, {});
+        job_manager->submitJob(job, this->test->analytical_cs);
+
+        wrench::Simulation::sleep(10.0);
+        if (simgrid::s4u::Engine::get_instance()->get_actor_count() != num_actors) {
+            throw std::runtime_error("An analytical job should not start any actor");
+        }
+        if (task1->getInternalState() != wrench::WorkflowTask::InternalState::TASK_RUNNING) {
+            throw std::runtime_error("task1 should be running");
+        }
+        if (task1->getExecutionHost() != "Host2") {
+            throw std::runtime_error("task1 should be running on Host2");
+        }
+
+        // The first task completes at time 25
+        wrench::Simulation::sleep(20.0);
+        if (task1->getInternalState() != wrench::WorkflowTask::InternalState::TASK_COMPLETED) {
+            throw std::runtime_error("task1 should be completed");
+        }
+        if (not BareMetalComputeServiceAnalyticalJobsTest::isAboutTheSame(25.0, task1->getEndDate())) {
+            throw std::runtime_error("Unexpected task1 end date: " + std::to_string(task1->getEndDate()));
+        }
+        if (task2->getInternalState() != wrench::WorkflowTask::InternalState::TASK_RUNNING) {
+            throw std::runtime_error("task2 should be running");
+        }
+
+        // Terminate the job
+        job_manager->terminateJob(job);
+        if (task2->getInternalState() != wrench::WorkflowTask::InternalState::TASK_READY) {
+            throw std::runtime_error("task2 should be ready after the job was terminated");
+        }
+
+        // Check that the service is idle (the job's cores have been released)
+        auto idle_cores = this->test->analytical_cs->getPerHostNumIdleCores();
+        if (idle_cores["Host2"] != 4) {
+            throw std::runtime_error("Unexpected number of idle cores: " + std::to_string(idle_cores["Host2"]));
+        }
+
+        // Check that no job completion comes in
+        std::shared_ptr<wrench::WorkflowExecutionEvent> event;
+        try {
+            event = this->getWorkflow()->waitForNextExecutionEvent(100.0);
+        } catch (wrench::WorkflowExecutionException &e) {
+            throw std::runtime_error("Error while getting an execution event: " + e.getCause()->toString());
+        }
+        if (event != nullptr) {
+            throw std::runtime_error("Unexpected execution event: " + event->toString());
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(BareMetalComputeServiceAnalyticalJobsTest, AnalyticalJobTermination) {
+    DO_TEST_WITH_FORK(do_AnalyticalJobTermination_test);
+}
+
+void BareMetalComputeServiceAnalyticalJobsTest::do_AnalyticalJobTermination_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto **argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("analytical_jobs_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create a Compute Service
+    ASSERT_NO_THROW(analytical_cs = simulation->add(
+            new wrench::BareMetalComputeService("Host2", (std::vector<std::string>){"Host2"}, "",
+                                                {{wrench::BareMetalComputeServiceProperty::SIMULATE_JOBS_ANALYTICALLY, "true"}},
+                                                {})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new AnalyticalJobTerminationTestWMS(this, {analytical_cs}, "Host1")));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  ANALYTICAL JOB HOST FAILURE TEST                                **/
+/**********************************************************************/
+
+class AnalyticalJobHostFailureTestWMS : public wrench::WMS {
+
+public:
+    AnalyticalJobHostFailureTestWMS(BareMetalComputeServiceAnalyticalJobsTest *test,
+                                    const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                    std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+
+private:
+
+    BareMetalComputeServiceAnalyticalJobsTest *test;
+
+    int main() {
+
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        auto task1 = this->getWorkflow()->addTask("task1", 100, 2, 2, 1.0, 0);
+        auto task2 = this->getWorkflow()->addTask("task2", 100, 2, 2, 1.0, 0);
+        this->getWorkflow()->addControlDependency(task1, task2);
+
+        auto job = job_manager->createStandardJob({task1, task2}, {});
+        job_manager->submitJob(job, this->test->analytical_cs);
+
+        // Only the running task holds cores
+        wrench::Simulation::sleep(10.0);
+        auto idle_cores = this->test->analytical_cs->getPerHostNumIdleCores();
+        if (idle_cores["Host2"] != 2) {
+            throw std::runtime_error("Unexpected number of idle cores: " + std::to_string(idle_cores["Host2"]));
+        }
+
+        // Turn off the host, which should fail the job
+        wrench::Simulation::turnOffHost("Host2");
+
+        std::shared_ptr<wrench::WorkflowExecutionEvent> event;
+        try {
+            event = this->getWorkflow()->waitForNextExecutionEvent();
+        } catch (wrench::WorkflowExecutionException &e) {
+            throw std::runtime_error("Error while getting an execution event: " + e.getCause()->toString());
+        }
+        auto real_event = std::dynamic_pointer_cast<wrench::StandardJobFailedEvent>(event);
+        if (not real_event) {
+            throw std::runtime_error("Unexpected execution event: " + event->toString());
+        }
+        if (not std::dynamic_pointer_cast<wrench::HostError>(real_event->failure_cause)) {
+            throw std::runtime_error("Unexpected failure cause: " + real_event->failure_cause->toString());
+        }
+        if (task1->getInternalState() != wrench::WorkflowTask::InternalState::TASK_READY) {
+            throw std::runtime_error("task1 should be ready after the job has failed");
+        }
+        if (not BareMetalComputeServiceAnalyticalJobsTest::isAboutTheSame(10.0, task1->getFailureDate())) {
+            throw std::runtime_error("Unexpected task1 failure date: " + std::to_string(task1->getFailureDate()));
+        }
+
+        // Check that the job's cores have been released
+        wrench::Simulation::turnOnHost("Host2");
+        idle_cores = this->test->analytical_cs->getPerHostNumIdleCores();
+        if (idle_cores["Host2"] != 4) {
+            throw std::runtime_error("Unexpected number of idle cores: " + std::to_string(idle_cores["Host2"]));
+        }
+
+        // Check that no job completion comes in
+        try {
+            event = this->getWorkflow()->waitForNextExecutionEvent(100.0);
+        } catch (wrench::WorkflowExecutionException &e) {
+            throw std::runtime_error("Error while getting an execution event: " + e.getCause()->toString());
+        }
+        if (event != nullptr) {
+            throw std::runtime_error("Unexpected execution event: " + event->toString());
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(BareMetalComputeServiceAnalyticalJobsTest, AnalyticalJobHostFailure) {
+    DO_TEST_WITH_FORK(do_AnalyticalJobHostFailure_test);
+}
+
+void BareMetalComputeServiceAnalyticalJobsTest::do_AnalyticalJobHostFailure_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto **argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("analytical_jobs_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create a Compute Service (not on its compute host, which gets turned off)
+    ASSERT_NO_THROW(analytical_cs = simulation->add(
+            new wrench::BareMetalComputeService("Host1", (std::vector<std::string>){"Host2"}, "",
+                                                {{wrench::BareMetalComputeServiceProperty::SIMULATE_JOBS_ANALYTICALLY, "true"}},
+                                                {})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new AnalyticalJobHostFailureTestWMS(this, {analytical_cs}, "Host1")));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
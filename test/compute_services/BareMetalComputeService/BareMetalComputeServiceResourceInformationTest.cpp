@@ -163,6 +163,13 @@ private:
         throw std::runtime_error("getTTL() should return +inf for compute service #1");
       }
 
+      // Subscribe to resource availability updates from compute service #1
+      auto subscription = std::dynamic_pointer_cast<wrench::BareMetalComputeService>(
+              this->test->compute_service1)->subscribeToResourceAvailability();
+      if (subscription->getTotalNumIdleCores() != 8) {
+        throw std::runtime_error("Subscription should initially report 8 idle cores for compute service #1");
+      }
+
       // Create a job that will use cores on compute service #1
       wrench::WorkflowTask *t1 = this->getWorkflow()->addTask("task1", 60.0000, 3, 3, 1.0, 0);
       wrench::WorkflowTask *t2 = this->getWorkflow()->addTask("task2", 60000000000.0001, 2, 2, 1.0, 0);
@@ -197,12 +204,44 @@ private:
 
       this->test->compute_service1->getPerHostAvailableMemoryCapacity(); // coverage
 
+      // The subscription view should agree with the RPC-based answers
+      if (subscription->getTotalNumIdleCores() != 3) {
+        throw std::runtime_error("Subscription should report 3 idle cores for compute service #1");
+      }
+      if (subscription->getPerHostNumIdleCores() != num_idle_cores) {
+        throw std::runtime_error("Subscription per-host idle core counts should match getPerHostNumIdleCores()");
+      }
+      subscription->getPerHostAvailableMemoryCapacity(); // coverage
+
       // Wait for the workflow execution event
       auto event = this->getWorkflow()->waitForNextExecutionEvent();
       if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
         throw std::runtime_error("Unexpected workflow execution event!");
       }
 
+      if (subscription->getTotalNumIdleCores() != 8) {
+        throw std::runtime_error("Subscription should report 8 idle cores for compute service #1 after job completion");
+      }
+      subscription->cancel();
+      bool success = true;
+      try {
+        subscription->getTotalNumIdleCores();
+      } catch (std::runtime_error &e) {
+        success = false;
+      }
+      if (success) {
+        throw std::runtime_error("Should not be able to query a cancelled subscription");
+      }
+
+      // A subscription that goes out of scope is cancelled
+      {
+        auto scoped_subscription = std::dynamic_pointer_cast<wrench::BareMetalComputeService>(
+                this->test->compute_service1)->subscribeToResourceAvailability();
+        if (scoped_subscription->getTotalNumIdleCores() != 8) {
+          throw std::runtime_error("Subscription should initially report 8 idle cores for compute service #1");
+        }
+      }
+
 
       this->getWorkflow()->removeTask(t1);
       this->getWorkflow()->removeTask(t2);
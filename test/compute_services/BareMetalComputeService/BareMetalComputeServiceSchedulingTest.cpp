@@ -38,6 +38,7 @@ public:
     void do_RAMPressure_test();
     void do_LoadBalancing1_test();
     void do_LoadBalancing2_test();
+    void do_HostIndex_test();
 
 
     static bool isJustABitGreater(double base, double variable) {
@@ -54,7 +55,7 @@ protected:
         // Create the simplest workflow
         workflow = new wrench::Workflow();
 
-        // Create a two-host quad-core platform file
+        // Create a three-host quad-core platform file
         std::string xml = "<?xml version='1.0'?>"
                           "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
                           "<platform version=\"4.1\"> "
@@ -62,7 +63,7 @@ protected:
                           "       <host id=\"Host1\" speed=\"1f\" core=\"4\"> "
                           "            <prop id=\"ram\" value=\"1000B\"/> "
                           "       </host> "
-                          "       <host id=\"Host2\" speed=\"1f\" core=\"4\"> "
+                          "       <host id=\"Host2\" speed=\"1f,2f\" pstate=\"0\" core=\"4\"> "
                           "            <prop id=\"ram\" value=\"1000B\"/> "
                           "       </host> "
                           "       <host id=\"Host3\" speed=\"3f\" core=\"4\"> "
@@ -503,3 +504,161 @@ void BareMetalComputeServiceTestScheduling::do_LoadBalancing2_test() {
     free(argv[0]);
     free(argv);
 }
+
+
+
+
+/**********************************************************************/
+/**  HOST INDEX TEST                                                 **/
+/**********************************************************************/
+
+class HostIndexTestWMS : public wrench::WMS {
+
+public:
+    HostIndexTestWMS(BareMetalComputeServiceTestScheduling *test,
+                     const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                     const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                     std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, storage_services, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+
+private:
+
+    BareMetalComputeServiceTestScheduling *test;
+    std::shared_ptr<wrench::JobManager> job_manager;
+
+    void submitTask(wrench::WorkflowTask *task, std::string service_specific_arg) {
+        wrench::StandardJob *j = this->job_manager->createStandardJob(task, {});
+        std::map<std::string, std::string> cs_specific_args;
+        cs_specific_args.insert(std::make_pair(task->getID(), service_specific_arg));
+        this->job_manager->submitJob(j, this->test->cs, cs_specific_args);
+    }
+
+    void waitForTaskCompletion(wrench::WorkflowTask *expected_task, std::string expected_host) {
+        std::shared_ptr<wrench::WorkflowExecutionEvent> event;
+        try {
+            event = this->getWorkflow()->waitForNextExecutionEvent();
+        } catch (wrench::WorkflowExecutionException &e) {
+            throw std::runtime_error("Error while getting an execution event: " + e.getCause()->toString());
+        }
+        auto real_event = std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event);
+        if (not real_event) {
+            throw std::runtime_error("Unexpected execution event: " + event->toString());
+        }
+        wrench::WorkflowTask *task = *(real_event->standard_job->getTasks().begin());
+        if (task != expected_task) {
+            throw std::runtime_error("Unexpected task completion: " + task->getID() +
+                                     " (expected " + expected_task->getID() + ")");
+        }
+        if (task->getExecutionHost() != expected_host) {
+            throw std::runtime_error("Task " + task->getID() + " should have run on " + expected_host +
+                                     " but ran on " + task->getExecutionHost());
+        }
+    }
+
+    int main() {
+
+        // Create a job manager
+        this->job_manager = this->createJobManager();
+
+        auto workflow = this->getWorkflow();
+
+        // Both hosts are idle: the tie is broken by host name
+        auto task1 = workflow->addTask("task1", 100, 1, 1, 1.0, 0);
+        this->submitTask(task1, "");
+        // Host1 is running a thread
+        auto task2 = workflow->addTask("task2", 10, 1, 1, 1.0, 0);
+        this->submitTask(task2, "");
+        this->waitForTaskCompletion(task2, "Host2");
+
+        // Host2 is back to zero running threads, so a 2-core task has a lower load there
+        auto task3 = workflow->addTask("task3", 40, 2, 2, 1.0, 0);
+        this->submitTask(task3, "");
+        // Host1 is now the less loaded host
+        auto task4 = workflow->addTask("task4", 10, 1, 1, 1.0, 0);
+        this->submitTask(task4, "");
+        this->waitForTaskCompletion(task4, "Host1");
+        this->waitForTaskCompletion(task3, "Host2");
+        this->waitForTaskCompletion(task1, "Host1");
+
+        // Both hosts are idle, but Host2 is now twice as fast
+        this->simulation->setPstate("Host2", 1);
+        wrench::Simulation::sleep(1.0);
+        auto task5 = workflow->addTask("task5", 10, 1, 1, 1.0, 0);
+        this->submitTask(task5, "");
+        this->waitForTaskCompletion(task5, "Host2");
+
+        // Both hosts are idle and equally fast again
+        this->simulation->setPstate("Host2", 0);
+        wrench::Simulation::sleep(1.0);
+        auto task6 = workflow->addTask("task6", 10, 1, 1, 1.0, 0);
+        this->submitTask(task6, "");
+        this->waitForTaskCompletion(task6, "Host1");
+
+        // Host1 is off
+        wrench::Simulation::turnOffHost("Host1");
+        auto task7 = workflow->addTask("task7", 10, 1, 1, 1.0, 0);
+        this->submitTask(task7, "");
+        this->waitForTaskCompletion(task7, "Host2");
+        wrench::Simulation::turnOnHost("Host1");
+        wrench::Simulation::sleep(1.0);
+
+        // Required host, even though another host is less loaded
+        auto task8 = workflow->addTask("task8", 20, 1, 1, 1.0, 0);
+        this->submitTask(task8, "Host2:1");
+        auto task9 = workflow->addTask("task9", 10, 2, 2, 1.0, 0);
+        this->submitTask(task9, "Host2:2");
+        this->waitForTaskCompletion(task9, "Host2");
+        this->waitForTaskCompletion(task8, "Host2");
+        if (not BareMetalComputeServiceTestScheduling::isAboutTheSame(task8->getStartDate(), task9->getStartDate())) {
+            throw std::runtime_error("Tasks on the required host should have run concurrently");
+        }
+
+        return 0;
+    }
+
+
+};
+
+TEST_F(BareMetalComputeServiceTestScheduling, HostIndex) {
+    DO_TEST_WITH_FORK(do_HostIndex_test);
+}
+
+void BareMetalComputeServiceTestScheduling::do_HostIndex_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto **argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("one_task_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create a Compute Service (not on one of its compute hosts, which get turned off)
+    ASSERT_NO_THROW(cs = simulation->add(
+            new wrench::BareMetalComputeService("Host3",
+                                                (std::vector<std::string>){"Host1", "Host2"}, "",
+                                                {}, {})));
+    std::set<std::shared_ptr<wrench::ComputeService>> compute_services;
+    compute_services.insert(cs);
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new HostIndexTestWMS(
+                    this, compute_services, {}, "Host3")));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
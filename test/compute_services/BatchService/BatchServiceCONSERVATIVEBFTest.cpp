@@ -15,6 +15,7 @@
 #include <wrench/services/compute/batch/BatchComputeService.h>
 #include <wrench/services/compute/batch/BatchComputeServiceMessage.h>
 #include "wrench/workflow/job/PilotJob.h"
+#include "services/compute/batch/batch_schedulers/homegrown/conservative_bf/NodeAvailabilityTimeLine.h"
 
 #include "../../include/TestWithFork.h"
 #include "../../include/UniqueTmpPathPrefix.h"
@@ -33,6 +34,7 @@ public:
     void do_LargeCONSERVATIVE_BF_test(int seed);
     void do_SimpleCONSERVATIVE_BFQueueWaitTimePrediction_test();
     void do_BatschedBroken_test();
+    void do_SubSecondCONSERVATIVE_BF_test();
     int seed;
 
 protected:
@@ -750,3 +752,211 @@ void BatchServiceCONSERVATIVE_BFTest::do_BatschedBroken_test() {
     free(argv[0]);
     free(argv);
 }
+
+
+/**********************************************************************/
+/**  SUB-SECOND CONSERVATIVE_BF TEST                                 **/
+/**********************************************************************/
+
+class SubSecondCONSERVATIVE_BFTestWMS : public wrench::WMS {
+
+public:
+    SubSecondCONSERVATIVE_BFTestWMS(BatchServiceCONSERVATIVE_BFTest *test,
+                                    const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                    std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, {}, {}, nullptr, hostname,
+                        "test") {
+        this->test = test;
+    }
+
+private:
+
+    BatchServiceCONSERVATIVE_BFTest *test;
+
+    int main() {
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        // Create 2 30-sec tasks
+        wrench::WorkflowTask *tasks[2];
+        wrench::StandardJob *jobs[2];
+        for (int i=0; i < 2; i++) {
+            tasks[i] = this->getWorkflow()->addTask("task" + std::to_string(i), 30, 1, 1, 1.0, 0);
+            jobs[i] = job_manager->createStandardJob(tasks[i], {});
+        }
+
+        std::map<std::string, std::string> two_hosts_1min, four_hosts_1min;
+
+        two_hosts_1min["-N"] = "2";
+        two_hosts_1min["-t"] = "1";
+        two_hosts_1min["-c"] = "10";
+
+        four_hosts_1min["-N"] = "4";
+        four_hosts_1min["-t"] = "1";
+        four_hosts_1min["-c"] = "10";
+
+        // Submit the jobs at a non-integral date, so that the schedule is
+        //   job #0: [0.5, 60.5) on 2 hosts
+        //   job #1: [60.5, 120.5) on 4 hosts
+        wrench::Simulation::sleep(0.5);
+        try {
+            job_manager->submitJob(jobs[0], this->test->compute_service, two_hosts_1min);
+            job_manager->submitJob(jobs[1], this->test->compute_service, four_hosts_1min);
+        } catch (wrench::WorkflowExecutionException &e) {
+            throw std::runtime_error(
+                    "Unexpected exception while submitting job"
+            );
+        }
+
+        wrench::Simulation::sleep(0.25);
+
+        // Get Predictions for sub-second and non-integral durations
+        std::set<std::tuple<std::string,unsigned long,unsigned long, double>> set_of_jobs = {
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job1",  2, 10, 60},
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job2",  2, 10, 60.25},
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job3",  3, 10, 0.25},
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job4",  4, 10, 30.25},
+        };
+
+        std::map<std::string, double> expectations;
+        // job1 fits on the 2 hosts left idle by job #0, but only if started in the past
+        expectations.insert(std::make_pair("job1", 120.5));
+        expectations.insert(std::make_pair("job2", 120.5));
+        expectations.insert(std::make_pair("job3", 120.5));
+        expectations.insert(std::make_pair("job4", 120.5));
+
+        std::map<std::string,double> jobs_estimated_start_times =
+                (*(this->getAvailableComputeServices<wrench::BatchComputeService>().begin()))->getStartTimeEstimates(set_of_jobs);
+
+        for (auto job : set_of_jobs) {
+            std::string id = std::get<0>(job);
+            double estimated = jobs_estimated_start_times[id];
+            double expected = expectations[id];
+            if (std::abs(estimated - expected) > 0.01) {
+                throw std::runtime_error("invalid prediction for job '" + id + "': got " +
+                                         std::to_string(estimated) + " but expected is " + std::to_string(expected));
+            }
+        }
+
+        // Wait for the jobs to complete: job #1 should be moved up to the
+        // (non-integral) completion date of job #0
+        for (int i=0; i < 2; i++) {
+            std::shared_ptr<wrench::WorkflowExecutionEvent> event;
+            try {
+                event = this->getWorkflow()->waitForNextExecutionEvent();
+            } catch (wrench::WorkflowExecutionException &e) {
+                throw std::runtime_error("Error while getting and execution event: " + e.getCause()->toString());
+            }
+            if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+            }
+        }
+
+        double expected_start_dates[2] = {0.5, 30.5};
+        for (int i=0; i < 2; i++) {
+            if (std::abs(tasks[i]->getStartDate() - expected_start_dates[i]) > EPSILON) {
+                throw std::runtime_error("Unexpected start date for task " + tasks[i]->getID() + ": " +
+                                         std::to_string(tasks[i]->getStartDate()) + " (expected: " +
+                                         std::to_string(expected_start_dates[i]) + ")");
+            }
+        }
+
+        return 0;
+    }
+};
+
+#ifdef ENABLE_BATSCHED
+TEST_F(BatchServiceCONSERVATIVE_BFTest, DISABLED_SubSecondCONSERVATIVE_BFTest)
+#else
+TEST_F(BatchServiceCONSERVATIVE_BFTest, SubSecondCONSERVATIVE_BFTest)
+#endif
+{
+    DO_TEST_WITH_FORK(do_SubSecondCONSERVATIVE_BF_test);
+}
+
+
+void BatchServiceCONSERVATIVE_BFTest::do_SubSecondCONSERVATIVE_BF_test() {
+
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("batch_service_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "Host1";
+
+    // Create a Batch Service with a conservative_bf scheduling algorithm
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::BatchComputeService(hostname, {"Host1", "Host2", "Host3", "Host4"}, "",
+                                            {{wrench::BatchComputeServiceProperty::BATCH_SCHEDULING_ALGORITHM, "conservative_bf"},
+                                             {wrench::BatchComputeServiceProperty::BATCH_RJMS_PADDING_DELAY,   "0"}})));
+
+    simulation->add(new wrench::FileRegistryService(hostname));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new SubSecondCONSERVATIVE_BFTestWMS(
+                    this,  {compute_service}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(std::move(workflow.get())));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  NODE AVAILABILITY TIMELINE TEST                                 **/
+/**********************************************************************/
+
+// Schedules many jobs with sub-second and multi-year durations directly in a
+// node availability timeline, and checks that the schedule never over-subscribes
+// the nodes
+TEST(NodeAvailabilityTimeLineTest, ScheduleManyJobs) {
+
+    const unsigned long num_nodes = 64;
+    const unsigned long num_jobs = 2000;
+
+    wrench::NodeAvailabilityTimeLine schedule(num_nodes);
+    std::vector<std::tuple<wrench::BatchScheduleTime::ticks, wrench::BatchScheduleTime::ticks, unsigned long>> reservations;
+    std::vector<std::shared_ptr<wrench::BatchJob>> batch_jobs;
+
+    srand(42);
+    for (unsigned long i = 0; i < num_jobs; i++) {
+        unsigned long job_num_nodes = 1 + rand() % num_nodes;
+        // Mostly sub-second durations, with a few very long (multi-year) ones
+        double duration_in_seconds = (i % 100 == 0) ? 3.0 * 365 * 24 * 3600 : 0.001 * (1 + rand() % 999);
+        auto batch_job = std::shared_ptr<wrench::BatchJob>(
+                new wrench::BatchJob(i + 1, 1, job_num_nodes, 1, duration_in_seconds, 0, 0));
+        batch_jobs.push_back(batch_job);
+
+        auto duration = wrench::BatchScheduleTime::fromDuration(duration_in_seconds);
+        ASSERT_GT(duration, 0);
+        auto est = schedule.findEarliestStartTime(duration, job_num_nodes);
+        ASSERT_LT(est, wrench::BatchScheduleTime::INFINITE_DATE);
+        auto end = wrench::BatchScheduleTime::add(est, duration);
+        schedule.add(est, end, batch_job);
+        reservations.push_back(std::make_tuple(est, end, job_num_nodes));
+    }
+    // Check that nodes are never over-subscribed (it suffices to check at reservation start dates)
+    for (auto const &r : reservations) {
+        unsigned long num_used_nodes = 0;
+        for (auto const &other : reservations) {
+            if ((std::get<0>(other) <= std::get<0>(r)) and (std::get<0>(r) < std::get<1>(other))) {
+                num_used_nodes += std::get<2>(other);
+            }
+        }
+        ASSERT_LE(num_used_nodes, num_nodes);
+    }
+}
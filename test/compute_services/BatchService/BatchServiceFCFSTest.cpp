@@ -31,7 +31,7 @@ public:
 
     void do_SimpleFCFS_test();
     void do_SimpleFCFSQueueWaitTimePrediction_test();
-    void do_BrokenQueueWaitTimePrediction_test();
+    void do_BestFitQueueWaitTimePrediction_test();
 
 protected:
     BatchServiceFCFSTest() {
@@ -428,15 +428,15 @@ void BatchServiceFCFSTest::do_SimpleFCFSQueueWaitTimePrediction_test() {
 
 
 /**********************************************************************/
-/**  BROKEN TEST WITH QUEUE PREDICTION                               **/
+/**  QUEUE PREDICTION WITH A NON-FIRSTFIT HOST SELECTION ALGORITHM   **/
 /**********************************************************************/
 
-class BrokenQueueWaitTimePredictionWMS : public wrench::WMS {
+class BestFitQueueWaitTimePredictionWMS : public wrench::WMS {
 
 public:
-    BrokenQueueWaitTimePredictionWMS(BatchServiceFCFSTest *test,
-                                     const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
-                                     std::string hostname) :
+    BestFitQueueWaitTimePredictionWMS(BatchServiceFCFSTest *test,
+                                      const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                      std::string hostname) :
             wrench::WMS(nullptr, nullptr,  compute_services, {}, {}, nullptr, hostname,
                         "test") {
         this->test = test;
@@ -447,52 +447,66 @@ private:
     BatchServiceFCFSTest *test;
 
     int main() {
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        // Submit a 2-host 10-core job that will run for 60 seconds (requested: 2 minutes)
+        auto task = this->getWorkflow()->addTask("task", 60, 1, 1, 1.0, 0);
+        auto job = job_manager->createStandardJob(task, {});
+        std::map<std::string, std::string> two_hosts_ten_cores = {{"-N", "2"}, {"-t", "2"}, {"-c", "10"}};
+        try {
+            job_manager->submitJob(job, this->test->compute_service, two_hosts_ten_cores);
+        } catch (wrench::WorkflowExecutionException &e) {
+            throw std::runtime_error("Unexpected exception while submitting job");
+        }
 
         // Sleep for 10 seconds
         wrench::Simulation::sleep(10);
 
         // Get Predictions
         std::set<std::tuple<std::string,unsigned long,unsigned long, double>> set_of_jobs = {
-                (std::tuple<std::string,unsigned long,unsigned long, double>){"job1", 1, 1, 400}
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job1", 1, 1, 400},
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job2", 3, 10, 400},
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job3", 5, 1, 400},
         };
 
+        // Expectations
+        std::map<std::string, double> expectations;
+        expectations.insert(std::make_pair("job1", 10));
+        expectations.insert(std::make_pair("job2", 120));
+        expectations.insert(std::make_pair("job3", -1));
 
-        try {
-            std::map<std::string,double> jobs_estimated_start_times =
-                    (*(this->getAvailableComputeServices<wrench::BatchComputeService>().begin()))->getStartTimeEstimates(set_of_jobs);
-            throw std::runtime_error("Should not have been able to get prediction for BESTFIT algorithm");
-        } catch (wrench::WorkflowExecutionException &e) {
-            auto cause = std::dynamic_pointer_cast<wrench::FunctionalityNotAvailable>(e.getCause());
-            if (not cause) {
-                throw std::runtime_error("Got expected exception, but unexpected failure cause: " +
-                                         e.getCause()->toString() + "(Expected: FunctionalityNotAvailable)");
-            }
-            if (cause->getService() != this->test->compute_service) {
-                throw std::runtime_error("Got expected exception and cause type, but compute service is wrong");
-            }
-            if (cause->getFunctionalityName() != "start time estimates") {
-                throw std::runtime_error("Got expected exception and cause type, but functionality name is wrong (" +
-                                         cause->getFunctionalityName() + ")");
-            }
-            WRENCH_INFO("toString: %s", cause->toString().c_str());  // for coverage
+        std::map<std::string,double> jobs_estimated_start_times =
+                (*(this->getAvailableComputeServices<wrench::BatchComputeService>().begin()))->getStartTimeEstimates(set_of_jobs);
 
+        for (auto const &j : set_of_jobs) {
+            std::string id = std::get<0>(j);
+            double estimated = jobs_estimated_start_times[id];
+            double expected = expectations[id];
+            if (std::abs(estimated - expected) > 1.0) {
+                throw std::runtime_error("invalid prediction for job '" + id + "': got " +
+                                         std::to_string(estimated) + " but expected is " + std::to_string(expected));
+            }
         }
 
+        // Wait for the job completion
+        this->waitForAndProcessNextEvent();
+
         return 0;
     }
 };
 
 #ifdef ENABLE_BATSCHED
-TEST_F(BatchServiceFCFSTest, DISABLED_BrokenQueueWaitTimePrediction)
+TEST_F(BatchServiceFCFSTest, DISABLED_BestFitQueueWaitTimePrediction)
 #else
-TEST_F(BatchServiceFCFSTest, BrokenQueueWaitTimePrediction)
+TEST_F(BatchServiceFCFSTest, BestFitQueueWaitTimePrediction)
 #endif
 {
-    DO_TEST_WITH_FORK(do_BrokenQueueWaitTimePrediction_test);
+    DO_TEST_WITH_FORK(do_BestFitQueueWaitTimePrediction_test);
 }
 
 
-void BatchServiceFCFSTest::do_BrokenQueueWaitTimePrediction_test() {
+void BatchServiceFCFSTest::do_BestFitQueueWaitTimePrediction_test() {
 
 
     // Create and initialize a simulation
@@ -513,14 +527,15 @@ void BatchServiceFCFSTest::do_BrokenQueueWaitTimePrediction_test() {
     ASSERT_NO_THROW(compute_service = simulation->add(
             new wrench::BatchComputeService(hostname, {"Host1", "Host2", "Host3", "Host4"}, "",
                                             {{wrench::BatchComputeServiceProperty::BATCH_SCHEDULING_ALGORITHM, "fcfs"},
-                                             {wrench::BatchComputeServiceProperty::HOST_SELECTION_ALGORITHM, "BESTFIT"}})));
+                                             {wrench::BatchComputeServiceProperty::HOST_SELECTION_ALGORITHM, "BESTFIT"},
+                                             {wrench::BatchComputeServiceProperty::BATCH_RJMS_PADDING_DELAY,   "0"}})));
 
     simulation->add(new wrench::FileRegistryService(hostname));
 
     // Create a WMS
     std::shared_ptr<wrench::WMS> wms = nullptr;;
     ASSERT_NO_THROW(wms = simulation->add(
-            new BrokenQueueWaitTimePredictionWMS(
+            new BestFitQueueWaitTimePredictionWMS(
                     this,  {compute_service}, hostname)));
 
     ASSERT_NO_THROW(wms->addWorkflow(std::move(workflow.get())));
@@ -166,11 +166,7 @@ private:
     }
 };
 
-#ifdef ENABLE_BATSCHED
 TEST_F(BatchServiceOutputCSVFileTest, SimpleOutputCSVFileTest)
-#else
-TEST_F(BatchServiceOutputCSVFileTest, DISABLED_SimpleOutputCSVFileTest)
-#endif
 {
   DO_TEST_WITH_FORK(do_SimpleOutputCSVFile_test);
 }
@@ -203,6 +199,7 @@ void BatchServiceOutputCSVFileTest::do_SimpleOutputCSVFile_test() {
 
   // Create a Batch Service
   std::string output_csv_file = UNIQUE_TMP_PATH_PREFIX + "batch_log.csv";
+  std::string output_binary_file = UNIQUE_TMP_PATH_PREFIX + "batch_log.bin";
 
   // Bogus output file
   ASSERT_THROW(compute_service = simulation->add(
@@ -210,10 +207,17 @@ void BatchServiceOutputCSVFileTest::do_SimpleOutputCSVFile_test() {
                                    {{wrench::BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG, "/bogus"},
                                     {wrench::BatchComputeServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE, trace_file_path}})), std::invalid_argument);
 
-  // OK output file
+  // Bogus binary output file
+  ASSERT_THROW(compute_service = simulation->add(
+          new wrench::BatchComputeService(hostname, {"Host1", "Host2", "Host3", "Host4"}, "",
+                                   {{wrench::BatchComputeServiceProperty::OUTPUT_BINARY_JOB_LOG, "/bogus"},
+                                    {wrench::BatchComputeServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE, trace_file_path}})), std::invalid_argument);
+
+  // OK output files
   ASSERT_NO_THROW(compute_service = simulation->add(
           new wrench::BatchComputeService(hostname, {"Host1", "Host2", "Host3", "Host4"}, "",
                                    {{wrench::BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG, output_csv_file},
+                                    {wrench::BatchComputeServiceProperty::OUTPUT_BINARY_JOB_LOG, output_binary_file},
                                     {wrench::BatchComputeServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE, trace_file_path}})));
 
   // Create a WMS
@@ -243,6 +247,25 @@ void BatchServiceOutputCSVFileTest::do_SimpleOutputCSVFile_test() {
   ASSERT_EQ(green_count, 2);
   ASSERT_EQ(red_count, 8);
 
+  // Check the binary file size (16-byte header, 56-byte records)
+  std::ifstream binary_infile(output_binary_file, std::ios_base::binary | std::ios_base::ate);
+  ASSERT_EQ((bool)binary_infile, true);
+  ASSERT_EQ((unsigned long)binary_infile.tellg(), 16 + 10 * 56);
+
+  // Check the in-memory job log
+  auto &job_log = std::dynamic_pointer_cast<wrench::BatchComputeService>(compute_service)->getJobLog();
+  ASSERT_EQ(job_log.getNumJobs(), 10);
+  ASSERT_EQ(job_log.getNumStartedJobs(), 10);
+  for (unsigned long i=0; i < job_log.getNumJobs(); i++) {
+    ASSERT_EQ(job_log.getStatus(i), wrench::BatchJobLog::COMPLETED);
+    ASSERT_GE(job_log.getWaitTime(i), 0);
+    ASSERT_EQ(job_log.getAllocatedNodes(i).size(), job_log.getNumNodes(i));
+  }
+  ASSERT_GE(job_log.getAverageBoundedSlowdown(), 1.0);
+  ASSERT_GE(job_log.getMaxBoundedSlowdown(), job_log.getAverageBoundedSlowdown());
+  ASSERT_GT(job_log.getUtilization(), 0.0);
+  ASSERT_LE(job_log.getUtilization(), 1.0);
+
   delete simulation;
 
   free(argv[0]);
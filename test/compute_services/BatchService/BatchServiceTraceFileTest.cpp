@@ -40,6 +40,9 @@ public:
     void do_WorkloadTraceFileDifferentTimeOriginSWF_test();
     void do_BatchTraceFileReplayTestWithFailedJob_test();
     void do_WorkloadTraceFileTestJSON_test();
+    void do_WorkloadTraceFileParallelLoadSWF_test();
+    void do_WorkloadTraceFileBackgroundJobs_test();
+    void do_BackgroundJobTimeOutAndDrop_test();
 
 protected:
     BatchServiceTest() {
@@ -389,13 +392,24 @@ void BatchServiceTest::do_WorkloadTraceFileTestSWFBatchServiceShutdown_test() {
     fclose(trace_file);
 
 
-    // Create a Batch Service with a the valid trace file
+    // Create a Batch Service with an invalid number of trace file loading threads
+    ASSERT_THROW(compute_service = simulation->add(
+            new wrench::BatchComputeService(hostname,
+                                            {"Host1", "Host2", "Host3", "Host4"}, "",
+                                            {
+                                                    {wrench::BatchComputeServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE, trace_file_path},
+                                                    {wrench::BatchComputeServiceProperty::WORKLOAD_TRACE_FILE_LOADING_THREADS, "bogus"}
+                                            }
+            )), std::invalid_argument);
+
+    // Create a Batch Service with a the valid trace file (loaded with two threads)
     ASSERT_NO_THROW(compute_service = simulation->add(
             new wrench::BatchComputeService(hostname,
                                             {"Host1", "Host2", "Host3", "Host4"}, "",
                                             {
                                                     {wrench::BatchComputeServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE, trace_file_path},
-                                                    {wrench::BatchComputeServiceProperty::USE_REAL_RUNTIMES_AS_REQUESTED_RUNTIMES_IN_WORKLOAD_TRACE_FILE, "true"}
+                                                    {wrench::BatchComputeServiceProperty::USE_REAL_RUNTIMES_AS_REQUESTED_RUNTIMES_IN_WORKLOAD_TRACE_FILE, "true"},
+                                                    {wrench::BatchComputeServiceProperty::WORKLOAD_TRACE_FILE_LOADING_THREADS, "2"}
                                             }
             )));
 
@@ -1698,3 +1712,319 @@ void BatchServiceTest::do_WorkloadTraceFileTestJSON_test() {
     free(argv[0]);
     free(argv);
 }
+
+
+/**********************************************************************/
+/**  WORKLOAD TRACE FILE PARALLEL LOAD TEST (SWF)                    **/
+/**********************************************************************/
+
+TEST_F(BatchServiceTest, WorkloadTraceFileParallelLoadSWFTest) {
+    DO_TEST_WITH_FORK(do_WorkloadTraceFileParallelLoadSWF_test);
+}
+
+void BatchServiceTest::do_WorkloadTraceFileParallelLoadSWF_test() {
+
+    std::string trace_file_path = UNIQUE_TMP_PATH_PREFIX + "parallel_swf_trace.swf";
+    FILE *trace_file;
+
+    /** Create a trace file large enough to be split into several chunks **/
+    trace_file = fopen(trace_file_path.c_str(), "w");
+    fprintf(trace_file, "; A comment\n");
+    for (int i = 0; i < 50000; i++) {
+        if (i % 1000 == 7) {
+            fprintf(trace_file, "; Another comment\n");
+        }
+        // Every 100th job has a requested time smaller than its run time (fixed when loaded)
+        fprintf(trace_file, "%d %d 0 %d 4 -1 -1 %d %d %d 1 1 1 1 1 1 -1 -1\n",
+                i, 1000 + 3 * i, 100 + i % 50, 1 + i % 4, (i % 100 == 0) ? 10 : 200 + i % 60, i % 10);
+    }
+    fclose(trace_file);
+
+    std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> sequential_jobs;
+    std::vector<std::tuple<std::string, double, double, double, double, unsigned int>> parallel_jobs;
+    ASSERT_NO_THROW(sequential_jobs = wrench::TraceFileLoader::loadFromTraceFile(trace_file_path, false, 10, 1));
+    ASSERT_NO_THROW(parallel_jobs = wrench::TraceFileLoader::loadFromTraceFile(trace_file_path, false, 10, 4));
+
+    ASSERT_EQ(50000, sequential_jobs.size());
+    ASSERT_TRUE(sequential_jobs == parallel_jobs);
+    ASSERT_EQ("0", std::get<0>(sequential_jobs.at(0)));
+    ASSERT_DOUBLE_EQ(10, std::get<1>(sequential_jobs.at(0)));
+    ASSERT_DOUBLE_EQ(100, std::get<3>(sequential_jobs.at(0)));
+    ASSERT_DOUBLE_EQ(10 + 3 * 49999, std::get<1>(sequential_jobs.at(49999)));
+    ASSERT_EQ(4, std::get<5>(sequential_jobs.at(49999)));
+    ASSERT_EQ(50000, wrench::TraceFileLoader::checkTraceFile(trace_file_path, false, 10, 4));
+
+    // Reading the trace job by job should produce the same jobs
+    {
+        wrench::TraceFileReader reader(trace_file_path, false, 10);
+        std::tuple<std::string, double, double, double, double, unsigned int> job;
+        unsigned long num_jobs = 0;
+        while (reader.getNextJob(job)) {
+            ASSERT_TRUE(job == sequential_jobs.at(num_jobs));
+            num_jobs++;
+        }
+        ASSERT_EQ(50000, num_jobs);
+    }
+
+    /** Append an invalid job (and a valid one) to the file **/
+    trace_file = fopen(trace_file_path.c_str(), "a");
+    fprintf(trace_file, "50000 BOGUS 0 100 4 -1 -1 1 100 0 1 1 1 1 1 1 -1 -1\n");
+    fprintf(trace_file, "50001 200000 0 100 4 -1 -1 1 100 0 1 1 1 1 1 1 -1 -1\n");
+    fclose(trace_file);
+
+    ASSERT_THROW(wrench::TraceFileLoader::loadFromTraceFile(trace_file_path, false, 10, 1), std::invalid_argument);
+    ASSERT_THROW(wrench::TraceFileLoader::loadFromTraceFile(trace_file_path, false, 10, 4), std::invalid_argument);
+    ASSERT_THROW(wrench::TraceFileLoader::checkTraceFile(trace_file_path, false, 10, 4), std::invalid_argument);
+    ASSERT_EQ(50001, wrench::TraceFileLoader::loadFromTraceFile(trace_file_path, true, 10, 4).size());
+    ASSERT_EQ(50001, wrench::TraceFileLoader::checkTraceFile(trace_file_path, true, 10, 4));
+
+    // Non-existing files
+    ASSERT_THROW(wrench::TraceFileLoader::loadFromTraceFile("/not_there.swf", false, 0, 4), std::invalid_argument);
+    ASSERT_THROW(wrench::TraceFileReader("/not_there.swf", false, 0), std::invalid_argument);
+}
+
+/**********************************************************************/
+/**  WORKLOAD TRACE FILE BACKGROUND JOBS TEST                        **/
+/**********************************************************************/
+
+class WorkloadTraceFileBackgroundJobsTestWMS : public wrench::WMS {
+
+public:
+    WorkloadTraceFileBackgroundJobsTestWMS(BatchServiceTest *test,
+                                           const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                           std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, {}, {}, nullptr,
+                        hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    BatchServiceTest *test;
+
+    void checkNumIdleCores(unsigned long expected) {
+        unsigned long num_idle_cores = this->test->compute_service->getTotalNumIdleCores();
+        if (num_idle_cores != expected) {
+            throw std::runtime_error("Unexpected number of idle cores at time " +
+                                     std::to_string(wrench::Simulation::getCurrentSimulatedDate()) + ": " +
+                                     std::to_string(num_idle_cores) + " (expected " + std::to_string(expected) + ")");
+        }
+    }
+
+    int main() {
+
+        auto batch_service = std::dynamic_pointer_cast<wrench::BatchComputeService>(this->test->compute_service);
+
+        // The replayed jobs run back to back (on 4, 2, and 4 nodes), and
+        // give back their nodes as they complete
+        wrench::Simulation::sleep(50);
+        checkNumIdleCores(0);
+        wrench::Simulation::sleep(100);
+        checkNumIdleCores(20);
+        wrench::Simulation::sleep(250);
+        checkNumIdleCores(40);
+
+        // All jobs should have completed (no workflow events, since there is no workflow job)
+        auto const &job_log = batch_service->getJobLog();
+        if (job_log.getNumJobs() != 3) {
+            throw std::runtime_error("Unexpected number of jobs in the job log: " + std::to_string(job_log.getNumJobs()));
+        }
+        std::vector<double> expected_start_dates = {0, 100, 200};
+        std::vector<unsigned long> expected_num_nodes = {4, 2, 4};
+        double tolerance = 5;
+        for (unsigned long i = 0; i < job_log.getNumJobs(); i++) {
+            if (job_log.getStatus(i) != wrench::BatchJobLog::COMPLETED) {
+                throw std::runtime_error("Job #" + std::to_string(i) + " should have completed");
+            }
+            if (job_log.getNumNodes(i) != expected_num_nodes[i]) {
+                throw std::runtime_error("Unexpected number of nodes for job #" + std::to_string(i) + ": " +
+                                         std::to_string(job_log.getNumNodes(i)));
+            }
+            if (std::abs(job_log.getStartDate(i) - expected_start_dates[i]) > tolerance) {
+                throw std::runtime_error("Unexpected start date for job #" + std::to_string(i) + ": " +
+                                         std::to_string(job_log.getStartDate(i)));
+            }
+            if (std::abs(job_log.getEndDate(i) - job_log.getStartDate(i) - 100) > tolerance) {
+                throw std::runtime_error("Unexpected duration for job #" + std::to_string(i) + ": " +
+                                         std::to_string(job_log.getEndDate(i) - job_log.getStartDate(i)));
+            }
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(BatchServiceTest, WorkloadTraceFileBackgroundJobsTest) {
+    DO_TEST_WITH_FORK(do_WorkloadTraceFileBackgroundJobs_test);
+}
+
+void BatchServiceTest::do_WorkloadTraceFileBackgroundJobs_test() {
+
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("batch_service_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "Host1";
+
+    // Create a trace file
+    std::string trace_file_path = UNIQUE_TMP_PATH_PREFIX + "swf_trace.swf";
+    FILE *trace_file = fopen(trace_file_path.c_str(), "w");
+    fprintf(trace_file, "1 0 -1 100 -1 -1 -1 4 100 -1\n");    // job that takes the whole machine
+    fprintf(trace_file, "2 1 -1 100 -1 -1 -1 2 100 -1\n");    // job that takes half the machine
+    fprintf(trace_file, "3 2 -1 100 -1 -1 -1 100 100 -1\n");  // job that is too big (and thus takes the whole machine)
+    fclose(trace_file);
+
+    // Create a Batch Service with the trace file
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::BatchComputeService(hostname,
+                                            {"Host1", "Host2", "Host3", "Host4"}, "",
+                                            {{wrench::BatchComputeServiceProperty::BATCH_SCHEDULING_ALGORITHM, "fcfs"},
+                                             {wrench::BatchComputeServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE, trace_file_path}}
+            )));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(new WorkloadTraceFileBackgroundJobsTestWMS(
+            this, {compute_service}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(std::move(workflow.get())));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
+
+/**********************************************************************/
+/**  BACKGROUND JOB TIME OUT AND DROP TEST                           **/
+/**********************************************************************/
+
+class BackgroundJobTimeOutAndDropTestWMS : public wrench::WMS {
+
+public:
+    BackgroundJobTimeOutAndDropTestWMS(BatchServiceTest *test,
+                                       const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                       std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, {}, {}, nullptr,
+                        hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    BatchServiceTest *test;
+
+    void submitBackgroundJob(std::shared_ptr<wrench::BatchComputeService> batch_service,
+                             unsigned long job_id, unsigned long time_in_minutes, unsigned long num_nodes,
+                             double runtime) {
+        // Submitted the way the workload trace file replayer does it
+        auto batch_job = std::shared_ptr<wrench::BatchJob>(
+                new wrench::BatchJob(job_id, time_in_minutes, num_nodes, 10, runtime, 0,
+                                     wrench::Simulation::getCurrentSimulatedDate()));
+        wrench::S4U_Mailbox::putMessage(batch_service->mailbox_name,
+                                        new wrench::BatchComputeServiceJobRequestMessage("", batch_job, 1024));
+    }
+
+    int main() {
+
+        auto batch_service = std::dynamic_pointer_cast<wrench::BatchComputeService>(this->test->compute_service);
+
+        // A job that runs for longer than its requested time (1 minute, plus the 5-second padding)
+        submitBackgroundJob(batch_service, 1000001, 1, 2, 600);
+        // A job that can never run, since it asks for more nodes than the service has
+        submitBackgroundJob(batch_service, 1000002, 1, 5, 30);
+        // A job that needs the whole machine, and thus waits for the first job to time out
+        submitBackgroundJob(batch_service, 1000003, 1, 4, 30);
+
+        wrench::Simulation::sleep(30);
+        if (this->test->compute_service->getTotalNumIdleCores() != 20) {
+            throw std::runtime_error("Only the first job should be running");
+        }
+
+        wrench::Simulation::sleep(170);
+        if (this->test->compute_service->getTotalNumIdleCores() != 40) {
+            throw std::runtime_error("All nodes should be idle once the jobs are done");
+        }
+
+        // The job that can never run should have been dropped
+        auto const &job_log = batch_service->getJobLog();
+        if (job_log.getNumJobs() != 2) {
+            throw std::runtime_error("Unexpected number of jobs in the job log: " + std::to_string(job_log.getNumJobs()));
+        }
+
+        double tolerance = 5;
+        if ((job_log.getJobID(0) != 1000001) or (job_log.getStatus(0) != wrench::BatchJobLog::FAILED)) {
+            throw std::runtime_error("The first job should have failed (timed out)");
+        }
+        if (std::abs(job_log.getEndDate(0) - job_log.getStartDate(0) - 65) > tolerance) {
+            throw std::runtime_error("The first job should have been stopped at its requested time (ran for " +
+                                     std::to_string(job_log.getEndDate(0) - job_log.getStartDate(0)) + " seconds)");
+        }
+
+        if ((job_log.getJobID(1) != 1000003) or (job_log.getStatus(1) != wrench::BatchJobLog::COMPLETED)) {
+            throw std::runtime_error("The third job should have completed");
+        }
+        if (std::abs(job_log.getStartDate(1) - job_log.getEndDate(0)) > tolerance) {
+            throw std::runtime_error("The third job should have started when the first job timed out (started at " +
+                                     std::to_string(job_log.getStartDate(1)) + ")");
+        }
+        if (std::abs(job_log.getEndDate(1) - job_log.getStartDate(1) - 30) > tolerance) {
+            throw std::runtime_error("Unexpected duration for the third job: " +
+                                     std::to_string(job_log.getEndDate(1) - job_log.getStartDate(1)));
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(BatchServiceTest, BackgroundJobTimeOutAndDropTest) {
+    DO_TEST_WITH_FORK(do_BackgroundJobTimeOutAndDrop_test);
+}
+
+void BatchServiceTest::do_BackgroundJobTimeOutAndDrop_test() {
+
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("batch_service_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "Host1";
+
+    // Create a Batch Service
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::BatchComputeService(hostname,
+                                            {"Host1", "Host2", "Host3", "Host4"}, "",
+                                            {{wrench::BatchComputeServiceProperty::BATCH_SCHEDULING_ALGORITHM, "fcfs"}}
+            )));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(new BackgroundJobTimeOutAndDropTestWMS(
+            this, {compute_service}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(std::move(workflow.get())));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
@@ -39,6 +39,7 @@ public:
     void do_StandardJobTaskTest_test();
     void do_PilotJobTaskTest_test();
     void do_SimpleServiceTest_test();
+    void do_NegotiatorIntervalTest_test();
 
 protected:
     HTCondorServiceTest() {
@@ -236,6 +237,144 @@ void HTCondorServiceTest::do_StandardJobTaskTest_test() {
     free(argv);
 }
 
+/**********************************************************************/
+/**  NEGOTIATOR INTERVAL SIMULATION TEST                             **/
+/**********************************************************************/
+
+class HTCondorNegotiatorIntervalTestWMS : public wrench::WMS {
+
+public:
+    HTCondorNegotiatorIntervalTestWMS(HTCondorServiceTest *test,
+                                      const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                      const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                      std::string &hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    HTCondorServiceTest *test;
+
+    int main() {
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        // Submit two jobs one after the other
+        for (auto task : {this->test->task1, this->test->task2}) {
+            wrench::StandardJob *job = job_manager->createStandardJob(
+                    {task},
+                    {},
+                    {std::make_tuple(this->test->input_file,
+                                     wrench::FileLocation::LOCATION(this->test->storage_service),
+                                     wrench::FileLocation::SCRATCH)},
+                    {}, {});
+
+            try {
+                job_manager->submitJob(job, this->test->compute_service);
+            } catch (wrench::WorkflowExecutionException &e) {
+                throw std::runtime_error(e.what());
+            }
+
+            std::shared_ptr<wrench::WorkflowExecutionEvent> event;
+            try {
+                event = this->getWorkflow()->waitForNextExecutionEvent();
+            } catch (wrench::WorkflowExecutionException &e) {
+                throw std::runtime_error("Error while getting an execution event: " + e.getCause()->toString());
+            }
+
+            if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+            }
+        }
+
+        // The first job is dispatched right away, but the second job has to wait
+        // for the next negotiation cycle
+        if (this->test->task1->getStartDate() > 10.0) {
+            throw std::runtime_error("The first job should have started right away (started at " +
+                                     std::to_string(this->test->task1->getStartDate()) + ")");
+        }
+        if (this->test->task2->getStartDate() < 100.0) {
+            throw std::runtime_error("The second job should not have started before the next negotiation cycle (started at " +
+                                     std::to_string(this->test->task2->getStartDate()) + ")");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(HTCondorServiceTest, HTCondorNegotiatorIntervalTest) {
+    DO_TEST_WITH_FORK(do_NegotiatorIntervalTest_test);
+}
+
+void HTCondorServiceTest::do_NegotiatorIntervalTest_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = wrench::Simulation::getHostnameList()[0];
+
+    // Create a Storage Service
+    ASSERT_NO_THROW(storage_service = simulation->add(
+            new wrench::SimpleStorageService(hostname, {"/"})));
+
+    // Create list of compute services
+    std::string execution_host = wrench::Simulation::getHostnameList()[1];
+    std::set<wrench::ComputeService *> invalid_compute_services;
+    invalid_compute_services.insert(new wrench::BareMetalComputeService(
+            execution_host, {execution_host}, "/scratch"));
+    std::set<wrench::ComputeService *> compute_services;
+    compute_services.insert(new wrench::BareMetalComputeService(
+            execution_host, {execution_host}, "/scratch"));
+
+    // Create a HTCondor Service with an invalid negotiator interval
+    ASSERT_THROW(simulation->add(
+            new wrench::HTCondorComputeService(
+                    hostname, "local", std::move(invalid_compute_services),
+                    {
+                            {wrench::HTCondorComputeServiceProperty::SUPPORTS_PILOT_JOBS, "false"},
+                            {wrench::HTCondorComputeServiceProperty::NEGOTIATOR_INTERVAL, "-1"},
+                    })), std::invalid_argument);
+
+    // Create a HTCondor Service
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::HTCondorComputeService(
+                    hostname, "local", std::move(compute_services),
+                    {
+                            {wrench::HTCondorComputeServiceProperty::SUPPORTS_PILOT_JOBS, "false"},
+                            {wrench::HTCondorComputeServiceProperty::NEGOTIATOR_INTERVAL, "100"},
+                    })));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new HTCondorNegotiatorIntervalTestWMS(this, {compute_service}, {storage_service}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    // Create a file registry
+    ASSERT_NO_THROW(simulation->add(new wrench::FileRegistryService(hostname)));
+
+    // Staging the input_file on the storage service
+    ASSERT_NO_THROW(simulation->stageFile(input_file, storage_service));
+
+    // Running the simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    free(argv[0]);
+    free(argv);
+}
+
 /**********************************************************************/
 /**  PILOT JOB SUBMISSION TASK SIMULATION TEST ON ONE HOST        **/
 /**********************************************************************/
@@ -200,6 +200,70 @@ private:
         this->test->cloud_service_best_fit_ram_first->destroyVM("vm_1");
         this->test->cloud_service_best_fit_ram_first->destroyVM("vm_2");
 
+        /*************************************************/
+        /** BEST FIT RAM FIRST: AVAILABLE CAPACITY      **/
+        /*************************************************/
+        // vm_2 should go on 2Cores20RAM, which has the least available RAM after vm_1 has started,
+        // which leaves room for vm_3 on 4Cores10RAM
+        this->test->cloud_service_best_fit_ram_first->createVM(1, 15, "vm_1");
+        this->test->cloud_service_best_fit_ram_first->createVM(1, 5, "vm_2");
+        this->test->cloud_service_best_fit_ram_first->createVM(4, 10, "vm_3");
+        this->test->cloud_service_best_fit_ram_first->startVM("vm_1");
+        this->test->cloud_service_best_fit_ram_first->startVM("vm_2");
+        try {
+            this->test->cloud_service_best_fit_ram_first->startVM("vm_3");
+        } catch (wrench::WorkflowExecutionException &e) {
+            throw std::runtime_error("BestFitRAMFirst Available Capacity: Should be able to start the 3rd VM");
+        }
+
+        this->test->cloud_service_best_fit_ram_first->shutdownVM("vm_1");
+        this->test->cloud_service_best_fit_ram_first->shutdownVM("vm_2");
+        this->test->cloud_service_best_fit_ram_first->shutdownVM("vm_3");
+        this->test->cloud_service_best_fit_ram_first->destroyVM("vm_1");
+        this->test->cloud_service_best_fit_ram_first->destroyVM("vm_2");
+        this->test->cloud_service_best_fit_ram_first->destroyVM("vm_3");
+
+        /*************************************************/
+        /** FIRST FIT: BATCH CREATION                   **/
+        /*************************************************/
+        try {
+            this->test->cloud_service_first_fit->createVMs(0, 1, 1);
+            throw std::runtime_error("Should not be able to create 0 VMs");
+        } catch (std::invalid_argument &e) {
+        }
+
+        try {
+            this->test->cloud_service_first_fit->createVMs(2, 5, 1);
+            throw std::runtime_error("Should not be able to create VMs that no host can accommodate");
+        } catch (wrench::WorkflowExecutionException &e) {
+            if (not std::dynamic_pointer_cast<wrench::NotEnoughResources>(e.getCause())) {
+                throw std::runtime_error("Unexpected failure cause: " + e.getCause()->toString());
+            }
+        }
+
+        auto vm_names = this->test->cloud_service_first_fit->createVMs(6, 1, 5);
+        if (vm_names.size() != 6) {
+            throw std::runtime_error("Batch creation should have created 6 VMs");
+        }
+        // 2 VMs fit on 4Cores10RAM and 2 on 2Cores20RAM
+        for (unsigned long i = 0; i < 4; i++) {
+            this->test->cloud_service_first_fit->startVM(vm_names[i]);
+        }
+        try {
+            this->test->cloud_service_first_fit->startVM(vm_names[4]);
+            throw std::runtime_error("FirstFit Batch Creation: Starting the 5th VM should have caused a NotEnoughResources error");
+        } catch (wrench::WorkflowExecutionException &e) {
+        }
+        // Freeing resources on 4Cores10RAM makes room again
+        this->test->cloud_service_first_fit->shutdownVM(vm_names[0]);
+        this->test->cloud_service_first_fit->startVM(vm_names[4]);
+
+        for (unsigned long i = 1; i < 5; i++) {
+            this->test->cloud_service_first_fit->shutdownVM(vm_names[i]);
+        }
+        for (auto const &vm_name : vm_names) {
+            this->test->cloud_service_first_fit->destroyVM(vm_name);
+        }
 
         return 0;
     }
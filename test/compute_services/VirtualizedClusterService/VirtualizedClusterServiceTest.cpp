@@ -47,6 +47,10 @@ public:
 
     void do_VMMigrationTest_test();
 
+    void do_VMResourceAccountingTest_test();
+
+    void do_VMMigrationToNonExecutionHostTest_test();
+
     void do_NumCoresTest_test();
 
     void do_StopAllVMsTest_test();
@@ -734,6 +738,256 @@ void VirtualizedClusterServiceTest::do_VMMigrationTest_test() {
 
 
 
+/**********************************************************************/
+/**  VM RESOURCE ACCOUNTING TEST                                     **/
+/**********************************************************************/
+
+class VirtualizedClusterVMResourceAccountingTestWMS : public wrench::WMS {
+
+public:
+    VirtualizedClusterVMResourceAccountingTestWMS(VirtualizedClusterServiceTest *test,
+                                                  const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                                  const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                                  std::string &hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    VirtualizedClusterServiceTest *test;
+
+    std::shared_ptr<wrench::VirtualizedClusterComputeService> cs;
+    std::map<std::string, unsigned long> num_cores;
+    std::map<std::string, double> ram_capacities;
+
+    void checkResources(const std::string &when, const std::map<std::string, std::pair<unsigned long, double>> &used) {
+        auto num_idle_cores = this->cs->getPerHostNumIdleCores();
+        auto ram_availabilities = this->cs->getPerHostAvailableMemoryCapacity();
+        for (auto const &h : this->num_cores) {
+            unsigned long used_cores = 0;
+            double used_ram = 0;
+            if (used.find(h.first) != used.end()) {
+                used_cores = used.at(h.first).first;
+                used_ram = used.at(h.first).second;
+            }
+            if (num_idle_cores[h.first] != h.second - used_cores) {
+                throw std::runtime_error("Unexpected number of idle cores on host " + h.first + " " + when +
+                                         ": " + std::to_string(num_idle_cores[h.first]) +
+                                         " (expected " + std::to_string(h.second - used_cores) + ")");
+            }
+            if (ram_availabilities[h.first] != this->ram_capacities[h.first] - used_ram) {
+                throw std::runtime_error("Unexpected available RAM on host " + h.first + " " + when +
+                                         ": " + std::to_string(ram_availabilities[h.first]) +
+                                         " (expected " + std::to_string(this->ram_capacities[h.first] - used_ram) + ")");
+            }
+        }
+    }
+
+    int main() {
+
+        this->cs = *(this->getAvailableComputeServices<wrench::VirtualizedClusterComputeService>().begin());
+        this->num_cores = this->cs->getPerHostNumCores();
+        this->ram_capacities = this->cs->getMemoryCapacity();
+
+        try {
+            auto vm_name = this->cs->createVM(2, 10);
+            checkResources("after creating the VM", {});
+
+            auto vm_cs = this->cs->startVM(vm_name, "QuadCoreHost");
+            checkResources("after starting the VM", {{"QuadCoreHost", {2, 10}}});
+
+            wrench::Simulation::sleep(0.01);
+
+            // The VM's resources should move from the source host to the destination host
+            this->cs->migrateVM(vm_name, "DualCoreHost");
+            checkResources("after migrating the VM", {{"DualCoreHost", {2, 10}}});
+
+            // The VM's resources should be released exactly once, even though the
+            // termination of the VM's compute service is notified after the shutdown
+            this->cs->shutdownVM(vm_name);
+            checkResources("after shutting down the VM", {});
+            wrench::Simulation::sleep(1);
+            checkResources("after the VM's compute service has terminated", {});
+
+            // Same thing when only the VM's compute service is stopped
+            vm_cs = this->cs->startVM(vm_name, "DualCoreHost");
+            checkResources("after restarting the VM", {{"DualCoreHost", {2, 10}}});
+            vm_cs->stop();
+            wrench::Simulation::sleep(1);
+            checkResources("after stopping the VM's compute service", {});
+
+            // The released resources should be usable again
+            auto other_vm_name = this->cs->createVM(4, 10);
+            this->cs->startVM(other_vm_name, "QuadCoreHost");
+            checkResources("after starting another VM", {{"QuadCoreHost", {4, 10}}});
+            this->cs->shutdownVM(other_vm_name);
+            wrench::Simulation::sleep(1);
+            checkResources("after shutting down the other VM", {});
+
+        } catch (wrench::WorkflowExecutionException &e) {
+            throw std::runtime_error(e.what());
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(VirtualizedClusterServiceTest, VirtualizedClusterVMResourceAccountingTestWMS) {
+    DO_TEST_WITH_FORK(do_VMResourceAccountingTest_test);
+}
+
+void VirtualizedClusterServiceTest::do_VMResourceAccountingTest_test() {
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = wrench::Simulation::getHostnameList()[0];
+
+    // Create a Storage Service
+    ASSERT_NO_THROW(storage_service = simulation->add(
+            new wrench::SimpleStorageService(hostname, {"/"})));
+
+    // Create a Virtualized Cluster Service
+    std::vector<std::string> execution_hosts = wrench::Simulation::getHostnameList();
+
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::VirtualizedClusterComputeService(hostname, execution_hosts, "/scratch",
+                                                         {{wrench::BareMetalComputeServiceProperty::SUPPORTS_PILOT_JOBS,
+                                                                  "false"}})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new VirtualizedClusterVMResourceAccountingTestWMS(this, {compute_service}, {storage_service}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    // Running the simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    free(argv[0]);
+    free(argv);
+}
+
+
+
+/**********************************************************************/
+/**  VM MIGRATION TO NON-EXECUTION HOST TEST                         **/
+/**********************************************************************/
+
+class VirtualizedClusterVMMigrationToNonExecutionHostTestWMS : public wrench::WMS {
+
+public:
+    VirtualizedClusterVMMigrationToNonExecutionHostTestWMS(VirtualizedClusterServiceTest *test,
+                                                           const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                                           const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                                           std::string &hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    VirtualizedClusterServiceTest *test;
+
+    int main() {
+
+        auto cs = *(this->getAvailableComputeServices<wrench::VirtualizedClusterComputeService>().begin());
+
+        try {
+            auto vm_name = cs->createVM(2, 10);
+            cs->startVM(vm_name, "QuadCoreHost");
+
+            wrench::Simulation::sleep(0.01);
+
+            // DualCoreHost has enough resources, but is not an execution host of the service
+            try {
+                cs->migrateVM(vm_name, "DualCoreHost");
+                throw std::runtime_error("Should not be able to migrate a VM to a host that is not an execution host");
+            } catch (wrench::WorkflowExecutionException &e) {
+                if (not std::dynamic_pointer_cast<wrench::NotEnoughResources>(e.getCause())) {
+                    throw std::runtime_error("Got an unexpected failure cause: " + e.getCause()->toString());
+                }
+            }
+
+            // The VM's resources should still be on the source host
+            auto num_idle_cores = cs->getPerHostNumIdleCores();
+            if (num_idle_cores.find("DualCoreHost") != num_idle_cores.end()) {
+                throw std::runtime_error("A host that is not an execution host should not be reported");
+            }
+            if (num_idle_cores["QuadCoreHost"] != 2) {
+                throw std::runtime_error("Unexpected number of idle cores on QuadCoreHost after the failed migration: " +
+                                         std::to_string(num_idle_cores["QuadCoreHost"]) + " (expected 2)");
+            }
+
+            cs->shutdownVM(vm_name);
+
+        } catch (wrench::WorkflowExecutionException &e) {
+            throw std::runtime_error(e.what());
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(VirtualizedClusterServiceTest, VirtualizedClusterVMMigrationToNonExecutionHostTestWMS) {
+    DO_TEST_WITH_FORK(do_VMMigrationToNonExecutionHostTest_test);
+}
+
+void VirtualizedClusterServiceTest::do_VMMigrationToNonExecutionHostTest_test() {
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "QuadCoreHost";
+
+    // Create a Storage Service
+    ASSERT_NO_THROW(storage_service = simulation->add(
+            new wrench::SimpleStorageService(hostname, {"/"})));
+
+    // Create a Virtualized Cluster Service (DualCoreHost is not an execution host)
+    std::vector<std::string> execution_hosts = {"QuadCoreHost", "TinyHost"};
+
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::VirtualizedClusterComputeService(hostname, execution_hosts, "/scratch",
+                                                         {{wrench::BareMetalComputeServiceProperty::SUPPORTS_PILOT_JOBS,
+                                                                  "false"}})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new VirtualizedClusterVMMigrationToNonExecutionHostTestWMS(this, {compute_service}, {storage_service},
+                                                                       hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    // Running the simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    free(argv[0]);
+    free(argv);
+}
+
+
 /**********************************************************************/
 /**  NUM CORES TEST                                                  **/
 /**********************************************************************/
@@ -14,6 +14,7 @@
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
 #include "wrench/services/compute/workunit_executor/Workunit.h"
 #include "wrench/services/compute/workunit_executor/WorkunitExecutor.h"
+#include "wrench/services/compute/workunit_executor/ReadyWorkunitQueue.h"
 
 #include "../../src/wrench/helper_services/standard_job_executor/StandardJobExecutorMessage.h"
 
@@ -35,6 +36,8 @@ public:
 
     void do_WorkunitConstructor_test();
     void do_WorkunitExecutorConstructor_test();
+    void do_WorkunitExecutorManyCores_test();
+    void do_CreateWorkunits_test();
 
 
 protected:
@@ -93,6 +96,7 @@ protected:
                           "          </disk>"
                           "         <prop id=\"ram\" value=\"1024B\"/> "
                           "       </host>  "
+                          "       <host id=\"ManyCoreHost\" speed=\"1f\" core=\"64\"/> "
                           "       <link id=\"1\" bandwidth=\"5000GBps\" latency=\"0us\"/>"
                           "       <link id=\"2\" bandwidth=\"0.1MBps\" latency=\"10us\"/>"
                           "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
@@ -100,7 +104,7 @@ protected:
                           "       <route src=\"Host1\" dst=\"Host4\"> <link_ctn id=\"2\"/> </route>"
                           "   </zone> "
                           "</platform>";
-        // Create a four-host 10-core platform file
+        // Create a four-host 10-core (plus one 64-core host) platform file
         FILE *platform_file = fopen(platform_file_path.c_str(), "w");
         fprintf(platform_file, "%s", xml.c_str());
         fclose(platform_file);
@@ -471,3 +475,334 @@ void WorkunitExecutorTest::do_WorkunitExecutorConstructor_test() {
 
 
 
+
+
+/**********************************************************************/
+/**  DO WORKUNITEXECUTOR MANY CORES TEST                             **/
+/**********************************************************************/
+
+class WorkunitExecutorManyCoresTestWMS : public wrench::WMS {
+
+public:
+    WorkunitExecutorManyCoresTestWMS(WorkunitExecutorTest *test,
+                                     const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                     std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+
+private:
+
+    WorkunitExecutorTest *test;
+
+    int main() {
+
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        auto cs = *(this->getAvailableComputeServices<wrench::ComputeService>().begin());
+
+        // Run a 2-core and a 64-core task that each compute for 100 seconds, one after the other,
+        // and count the actors that are alive in the middle of each computation
+        std::vector<unsigned long> num_cores = {2, 64};
+        std::vector<unsigned long> num_new_actors;
+        for (auto const &n : num_cores) {
+            auto task = this->getWorkflow()->addTask("task_" + std::to_string(n), 100.0 * n, n, n, 1.0, 0);
+            auto job = job_manager->createStandardJob(task, {});
+
+            unsigned long num_actors_before = simgrid::s4u::Engine::get_instance()->get_actor_count();
+            job_manager->submitJob(job, cs, {});
+            wrench::Simulation::sleep(50);
+            num_new_actors.push_back(simgrid::s4u::Engine::get_instance()->get_actor_count() - num_actors_before);
+
+            auto event = this->getWorkflow()->waitForNextExecutionEvent();
+            if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+            }
+
+            // Check the computation duration
+            double duration = task->getComputationEndDate() - task->getComputationStartDate();
+            if (std::abs(duration - 100.0) > EPSILON) {
+                throw std::runtime_error("Unexpected computation duration " + std::to_string(duration) +
+                                         " for a " + std::to_string(n) + "-core task (expected 100.0)");
+            }
+        }
+
+        // The number of actors should not depend on the number of cores
+        if (num_new_actors[0] != num_new_actors[1]) {
+            throw std::runtime_error("A 2-core task uses " + std::to_string(num_new_actors[0]) +
+                                     " actors but a 64-core task uses " + std::to_string(num_new_actors[1]));
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(WorkunitExecutorTest, ManyCoresTest) {
+    DO_TEST_WITH_FORK(do_WorkunitExecutorManyCores_test);
+}
+
+void WorkunitExecutorTest::do_WorkunitExecutorManyCores_test() {
+
+    // Create and initialize a simulation
+    simulation = new wrench::Simulation();
+    int argc = 1;
+    char **argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create a Compute Service on the many-core host
+    std::shared_ptr<wrench::ComputeService> compute_service;
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::BareMetalComputeService("Host1",
+                                                {std::make_pair("ManyCoreHost", std::make_tuple(wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM))},
+                                                {})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new WorkunitExecutorManyCoresTestWMS(this, {compute_service}, "Host1")));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  DO CREATE WORKUNITS TEST                                        **/
+/**********************************************************************/
+
+class CreateWorkunitsTestWMS : public wrench::WMS {
+
+public:
+    CreateWorkunitsTestWMS(WorkunitExecutorTest *test,
+                           const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                           std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, storage_services, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+
+private:
+
+    WorkunitExecutorTest *test;
+
+    int main() {
+
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        // Create a long chain of tasks, each with an output file
+        const unsigned long num_tasks = 2000;
+        std::vector<wrench::WorkflowTask *> tasks;
+        std::map<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>> file_locations;
+        for (unsigned long i = 0; i < num_tasks; i++) {
+            auto task = this->getWorkflow()->addTask("task_" + std::to_string(i), 1.0, 1, 1, 1.0, 0);
+            auto file = this->getWorkflow()->addFile("file_" + std::to_string(i), 1.0);
+            task->addOutputFile(file);
+            file_locations[file] = wrench::FileLocation::LOCATION(this->test->storage_service1);
+            if (i > 0) {
+                this->getWorkflow()->addControlDependency(tasks[i - 1], task);
+            }
+            tasks.push_back(task);
+        }
+
+        auto input_file = this->getWorkflow()->getFileByID("input_file");
+        auto job = job_manager->createStandardJob(
+                tasks, file_locations,
+                {std::make_tuple(input_file,
+                                 wrench::FileLocation::LOCATION(this->test->storage_service1),
+                                 wrench::FileLocation::LOCATION(this->test->storage_service2))},
+                {}, {});
+
+        auto work_units = wrench::Workunit::createWorkunits(job);
+
+        if (work_units.size() != num_tasks + 1) {
+            throw std::runtime_error("Unexpected number of work units: " + std::to_string(work_units.size()));
+        }
+        for (auto const &wu : work_units) {
+            if (wu->getJob() != job) {
+                throw std::runtime_error("All work units should belong to the job");
+            }
+        }
+
+        // Check the dependencies and the (shared) file location table
+        std::shared_ptr<const std::map<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>>> shared_file_locations = nullptr;
+        std::map<wrench::WorkflowTask *, std::shared_ptr<wrench::Workunit>> task_work_units;
+        for (auto const &wu : work_units) {
+            if (wu->task == nullptr) {
+                if ((not wu->pre_file_copies.empty()) and (wu->num_pending_parents == 0) and
+                    (wu->children.size() == num_tasks)) {
+                    continue;
+                }
+                throw std::runtime_error("Unexpected non-task work unit");
+            }
+            task_work_units[wu->task] = wu;
+            if (shared_file_locations == nullptr) {
+                shared_file_locations = wu->file_locations;
+            } else if (wu->file_locations != shared_file_locations) {
+                throw std::runtime_error("Task work units should share the same file location table");
+            }
+        }
+        if (shared_file_locations->size() != num_tasks) {
+            throw std::runtime_error("Unexpected file location table size");
+        }
+        for (unsigned long i = 0; i < num_tasks; i++) {
+            auto wu = task_work_units.at(tasks[i]);
+            unsigned long expected_num_parents = (i == 0 ? 1 : 2);
+            unsigned long expected_num_children = (i == num_tasks - 1 ? 0 : 1);
+            if ((wu->num_pending_parents != expected_num_parents) or (wu->children.size() != expected_num_children)) {
+                throw std::runtime_error("Unexpected dependencies for task work unit " + std::to_string(i));
+            }
+            if ((i < num_tasks - 1) and (*(wu->children.begin()) != task_work_units.at(tasks[i + 1]))) {
+                throw std::runtime_error("Unexpected child for task work unit " + std::to_string(i));
+            }
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(WorkunitExecutorTest, CreateWorkunitsTest) {
+    DO_TEST_WITH_FORK(do_CreateWorkunits_test);
+}
+
+void WorkunitExecutorTest::do_CreateWorkunits_test() {
+
+    // Create and initialize a simulation
+    simulation = new wrench::Simulation();
+    int argc = 1;
+    char **argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "Host1";
+
+    // Create a Storage Service
+    ASSERT_NO_THROW(storage_service1 = simulation->add(
+            new wrench::SimpleStorageService(hostname, {"/disk1/"})));
+
+    // Create another Storage Service
+    ASSERT_NO_THROW(storage_service2 = simulation->add(
+            new wrench::SimpleStorageService(hostname, {"/disk2/"})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new CreateWorkunitsTestWMS(this, {storage_service1, storage_service2}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+    // Create a workflow file
+    wrench::WorkflowFile *input_file = this->workflow->addFile("input_file", 10000000.0);
+    ASSERT_NO_THROW(simulation->stageFile(input_file, storage_service1));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  READY WORKUNIT QUEUE TEST                                       **/
+/**********************************************************************/
+
+TEST_F(WorkunitExecutorTest, ReadyWorkunitQueueTest) {
+
+    auto task1 = this->workflow->addTask("task1", 100.0, 1, 1, 1.0, 0);
+    auto task2 = this->workflow->addTask("task2", 300.0, 4, 4, 1.0, 0);
+    auto task3 = this->workflow->addTask("task3", 200.0, 2, 2, 1.0, 0);
+    auto task4 = this->workflow->addTask("task4", 200.0, 1, 1, 1.0, 0);
+    this->workflow->addControlDependency(task1, task2);
+
+    auto create_workunit = [](wrench::WorkflowTask *task) {
+        return std::make_shared<wrench::Workunit>((wrench::StandardJob *) 666,
+                                                  (std::vector<std::tuple<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>, std::shared_ptr<wrench::FileLocation>>>) {},
+                                                  task,
+                                                  (std::map<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>>) {},
+                                                  (std::vector<std::tuple<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>, std::shared_ptr<wrench::FileLocation>>>) {},
+                                                  (std::vector<std::tuple<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>>>) {});
+    };
+    auto wu1 = create_workunit(task1);
+    auto wu2 = create_workunit(task2);
+    auto wu3 = create_workunit(task3);
+    auto wu4 = create_workunit(task4);
+    auto wu_no_task = create_workunit(nullptr);
+
+    auto queue_contents = [](const wrench::ReadyWorkunitQueue &queue) {
+        std::vector<std::shared_ptr<wrench::Workunit>> contents;
+        for (auto const &wu : queue) {
+            contents.push_back(wu);
+        }
+        return contents;
+    };
+
+    ASSERT_THROW(wrench::ReadyWorkunitQueue::parsePolicy("bogus"), std::invalid_argument);
+
+    // FIFO
+    wrench::ReadyWorkunitQueue fifo_queue;
+    fifo_queue.insert(wu3);
+    fifo_queue.insert(wu1);
+    fifo_queue.insert(wu_no_task);
+    fifo_queue.insert(wu2);
+    fifo_queue.insert(wu1);
+    ASSERT_EQ(4, fifo_queue.size());
+    ASSERT_EQ(queue_contents(fifo_queue), std::vector<std::shared_ptr<wrench::Workunit>>({wu_no_task, wu3, wu1, wu2}));
+    ASSERT_TRUE(fifo_queue.erase(wu1));
+    ASSERT_FALSE(fifo_queue.erase(wu1));
+    ASSERT_FALSE(fifo_queue.contains(wu1));
+    fifo_queue.insert(wu1);
+    ASSERT_EQ(queue_contents(fifo_queue), std::vector<std::shared_ptr<wrench::Workunit>>({wu_no_task, wu3, wu2, wu1}));
+
+    // Maximum flops (ties broken by decreasing task IDs)
+    wrench::ReadyWorkunitQueue max_flops_queue(wrench::ReadyWorkunitQueue::parsePolicy("maximum_flops"));
+    for (auto const &wu : {wu1, wu2, wu3, wu4, wu_no_task}) {
+        max_flops_queue.insert(wu);
+    }
+    ASSERT_EQ(queue_contents(max_flops_queue), std::vector<std::shared_ptr<wrench::Workunit>>({wu_no_task, wu2, wu4, wu3, wu1}));
+
+    // Maximum minimum cores
+    wrench::ReadyWorkunitQueue max_min_cores_queue(wrench::ReadyWorkunitQueue::parsePolicy("maximum_minimum_cores"));
+    for (auto const &wu : {wu1, wu2, wu3, wu4}) {
+        max_min_cores_queue.insert(wu);
+    }
+    ASSERT_EQ(queue_contents(max_min_cores_queue), std::vector<std::shared_ptr<wrench::Workunit>>({wu2, wu3, wu4, wu1}));
+
+    // Minimum top level
+    wrench::ReadyWorkunitQueue min_top_level_queue(wrench::ReadyWorkunitQueue::parsePolicy("minimum_top_level"));
+    for (auto const &wu : {wu2, wu1, wu4}) {
+        min_top_level_queue.insert(wu);
+    }
+    ASSERT_EQ(queue_contents(min_top_level_queue), std::vector<std::shared_ptr<wrench::Workunit>>({wu4, wu1, wu2}));
+
+    // Erasing while iterating
+    for (auto it = max_flops_queue.begin(); it != max_flops_queue.end();) {
+        if ((*it)->task and ((*it)->task->getFlops() == 200.0)) {
+            it = max_flops_queue.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    ASSERT_EQ(queue_contents(max_flops_queue), std::vector<std::shared_ptr<wrench::Workunit>>({wu_no_task, wu2, wu1}));
+    max_flops_queue.clear();
+    ASSERT_TRUE(max_flops_queue.empty());
+}
@@ -119,6 +119,23 @@ TEST_F(MessageConstructorTest, FileRegistryMessages) {
     ASSERT_NO_THROW(new wrench::FileRegistryFileLookupByProximityAnswerMessage(file, "reference_host", {{}}, 666));
     ASSERT_THROW(new wrench::FileRegistryFileLookupByProximityAnswerMessage(nullptr, "reference_host", {{}}, 666), std::invalid_argument);
     ASSERT_THROW(new wrench::FileRegistryFileLookupByProximityAnswerMessage(file, "", {{}}, 666), std::invalid_argument);
+
+    ASSERT_NO_THROW(new wrench::FileRegistryFileLookupsByProximityRequestMessage("mailbox", {file}, "reference_host",
+                                                                                 network_proximity_service, 666));
+    ASSERT_THROW(new wrench::FileRegistryFileLookupsByProximityRequestMessage("", {file}, "reference_host",
+                                                                              network_proximity_service, 666),
+                 std::invalid_argument);
+    ASSERT_THROW(new wrench::FileRegistryFileLookupsByProximityRequestMessage("mailbox", {file, nullptr}, "reference_host",
+                                                                              network_proximity_service, 666),
+                 std::invalid_argument);
+    ASSERT_THROW(new wrench::FileRegistryFileLookupsByProximityRequestMessage("mailbox", {file}, "",
+                                                                              network_proximity_service, 666),
+                 std::invalid_argument);
+    ASSERT_THROW(new wrench::FileRegistryFileLookupsByProximityRequestMessage("mailbox", {file}, "reference_host",
+                                                                              nullptr, 666),
+                 std::invalid_argument);
+
+    ASSERT_NO_THROW(new wrench::FileRegistryFileLookupsByProximityAnswerMessage({}, 666));
 }
 
 TEST_F(MessageConstructorTest, ComputeServiceMessages) {
@@ -196,6 +213,17 @@ TEST_F(MessageConstructorTest, ComputeServiceMessages) {
 
     ASSERT_NO_THROW(new wrench::ComputeServiceResourceInformationAnswerMessage({std::make_pair("something", std::map<std::string, double>({{"aa", 2.3}, {"bb", 4.5}}))}, 666));
 
+    ASSERT_NO_THROW(new wrench::ComputeServiceResourceAvailabilitySubscriptionRequestMessage("mailbox", "subscriber", 666));
+    ASSERT_THROW(new wrench::ComputeServiceResourceAvailabilitySubscriptionRequestMessage("", "subscriber", 666), std::invalid_argument);
+    ASSERT_THROW(new wrench::ComputeServiceResourceAvailabilitySubscriptionRequestMessage("mailbox", "", 666), std::invalid_argument);
+
+    ASSERT_NO_THROW(new wrench::ComputeServiceResourceAvailabilitySubscriptionAnswerMessage({{"host", 4}}, {{"host", 1024.0}}, 666));
+
+    ASSERT_NO_THROW(new wrench::ComputeServiceResourceAvailabilityUnsubscriptionRequestMessage("subscriber", 666));
+    ASSERT_THROW(new wrench::ComputeServiceResourceAvailabilityUnsubscriptionRequestMessage("", 666), std::invalid_argument);
+
+    ASSERT_NO_THROW(new wrench::ComputeServiceResourceAvailabilityUpdateMessage({{"host", -2}}, {{"host", -512.0}}, 666));
+
 //  ASSERT_NO_THROW(new wrench::ComputeServiceInformationMessage(workflow_job, "info", 666));
 }
 
@@ -214,6 +242,12 @@ TEST_F(MessageConstructorTest, CloudComputeServiceMessages) {
     ASSERT_NO_THROW(new wrench::CloudComputeServiceCreateVMRequestMessage("mailbox", 42, 10, "stuff", {}, {}, 666));
     ASSERT_THROW(
             new wrench::CloudComputeServiceCreateVMRequestMessage("", 42, 0, "stuff", {}, {}, 666), std::invalid_argument);
+    ASSERT_NO_THROW(new wrench::CloudComputeServiceCreateVMsRequestMessage("mailbox", 3, 42, 10, {}, {}, 666));
+    ASSERT_THROW(
+            new wrench::CloudComputeServiceCreateVMsRequestMessage("", 3, 42, 10, {}, {}, 666), std::invalid_argument);
+    ASSERT_THROW(
+            new wrench::CloudComputeServiceCreateVMsRequestMessage("mailbox", 0, 42, 10, {}, {}, 666), std::invalid_argument);
+    ASSERT_NO_THROW(new wrench::CloudComputeServiceCreateVMsAnswerMessage(true, {"vm1", "vm2"}, nullptr, 666));
 
     ASSERT_NO_THROW(new wrench::VirtualizedClusterComputeServiceMigrateVMRequestMessage("mailbox", "host", "host", 666));
     ASSERT_THROW(new wrench::VirtualizedClusterComputeServiceMigrateVMRequestMessage("", "host", "host", 666),
@@ -356,6 +390,16 @@ TEST_F(MessageConstructorTest, NetworkProximityMessages) {
 
     ASSERT_NO_THROW(new wrench::CoordinateLookupAnswerMessage("requested_host", true, std::make_pair(1.0,1.0), 1.0, 666));
     ASSERT_THROW(new wrench::CoordinateLookupAnswerMessage("", true, std::make_pair(1.0, 1.0), 1.0, 666), std::invalid_argument);
+
+    ASSERT_NO_THROW(new wrench::NetworkProximitySnapshotSubscriptionRequestMessage("mailbox", "subscriber_mailbox", 666));
+    ASSERT_THROW(new wrench::NetworkProximitySnapshotSubscriptionRequestMessage("", "subscriber_mailbox", 666), std::invalid_argument);
+    ASSERT_THROW(new wrench::NetworkProximitySnapshotSubscriptionRequestMessage("mailbox", "", 666), std::invalid_argument);
+
+    ASSERT_NO_THROW(new wrench::NetworkProximitySnapshotUnsubscriptionRequestMessage("subscriber_mailbox", 666));
+    ASSERT_THROW(new wrench::NetworkProximitySnapshotUnsubscriptionRequestMessage("", 666), std::invalid_argument);
+
+    ASSERT_NO_THROW(new wrench::NetworkProximitySnapshotMessage(network_proximity_service.get(), wrench::NetworkProximitySnapshot(), 666));
+    ASSERT_THROW(new wrench::NetworkProximitySnapshotMessage(nullptr, wrench::NetworkProximitySnapshot(), 666), std::invalid_argument);
 }
 
 
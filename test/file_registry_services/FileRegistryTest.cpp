@@ -28,6 +28,9 @@ public:
 
     void do_FileRegistry_Test();
     void do_lookupEntry_Test();
+    void do_BatchedOperations_Test();
+    void do_ShardedRegistry_Test();
+    void do_ManyReplicas_Test(unsigned long num_replicas);
 
 protected:
     FileRegistryTest() {
@@ -398,6 +401,48 @@ private:
       } catch (std::invalid_argument &e) {
       }
 
+      // Bulk ranked lookups, in which replicas at the same distance are all kept
+      wrench::WorkflowFile *file2 = this->getWorkflow()->addFile("file2", 100.0);
+      frs->addEntries({std::make_pair(file2, wrench::FileLocation::LOCATION(this->test->storage_service1, "/a")),
+                       std::make_pair(file2, wrench::FileLocation::LOCATION(this->test->storage_service1, "/b"))});
+
+      try {
+        frs->lookupEntries({file1, nullptr_file}, "Host3", nps);
+        throw std::runtime_error("Should not be able to lookup a nullptr file");
+      } catch (std::invalid_argument &e) {
+      }
+
+      try {
+        frs->lookupEntries({file1}, "BogusHost", nps);
+        throw std::runtime_error("Should not be able to lookup files by proximity with a bogus reference host");
+      } catch (std::invalid_argument &e) {
+      }
+
+      auto ranked_locations = frs->lookupEntries({file1, file2}, "Host3", nps);
+      if (ranked_locations.size() != 2) {
+        throw std::runtime_error("Got a wrong number of files in a bulk ranked lookup");
+      }
+      if (ranked_locations[file1].size() != 3) {
+        throw std::runtime_error("Got a wrong number of ranked locations for file1");
+      }
+      for (unsigned long i = 0; i < 3; i++) {
+        if (ranked_locations[file1][i].second->getStorageService()->getHostname() != file1_expected_locations[i]) {
+          throw std::runtime_error("Bulk ranked lookup did not return locations in ascending order of network proximity");
+        }
+        if (file1_locations_by_proximity.find(ranked_locations[file1][i].first) == file1_locations_by_proximity.end()) {
+          throw std::runtime_error("Bulk ranked lookup and single lookup disagree on distances");
+        }
+      }
+      if ((ranked_locations[file2].size() != 2) or
+          (ranked_locations[file2][0].first != ranked_locations[file2][1].first) or
+          (ranked_locations[file2][0].second->getAbsolutePathAtMountPoint() ==
+           ranked_locations[file2][1].second->getAbsolutePathAtMountPoint())) {
+        throw std::runtime_error("Bulk ranked lookup should keep all locations at the same distance");
+      }
+      if (frs->lookupEntry(file2, "Host3", nps).size() != 1) {
+        throw std::runtime_error("Single ranked lookup should collapse locations at the same distance");
+      }
+
       // shutdown service
       frs->stop();
 
@@ -489,3 +534,437 @@ void FileRegistryTest::do_lookupEntry_Test() {
   free(argv[0]);
   free(argv);
 }
+
+/**********************************************************************/
+/**   BATCHED OPERATIONS TEST                                        **/
+/**********************************************************************/
+
+class FileRegistryBatchedOperationsTestWMS : public wrench::WMS {
+
+public:
+    FileRegistryBatchedOperationsTestWMS(FileRegistryTest *test,
+                                         const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                         std::shared_ptr<wrench::FileRegistryService> file_registry_service,
+                                         std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, storage_services, {}, file_registry_service, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    FileRegistryTest *test;
+
+    int main() {
+
+      auto file1 = this->getWorkflow()->addFile("file1", 100.0);
+      auto file2 = this->getWorkflow()->addFile("file2", 100.0);
+      auto file3 = this->getWorkflow()->addFile("file3", 100.0);
+      auto frs = this->getAvailableFileRegistryService();
+
+      auto location1 = wrench::FileLocation::LOCATION(this->test->storage_service1);
+      auto location2 = wrench::FileLocation::LOCATION(this->test->storage_service2);
+
+      try {
+        frs->addEntries({std::make_pair(file1, location1), std::make_pair(nullptr, location1)});
+        throw std::runtime_error("Should not be able to add a batch that includes a nullptr file");
+      } catch (std::invalid_argument &e) {
+      }
+
+      try {
+        frs->removeEntries({std::make_pair(file1, nullptr)});
+        throw std::runtime_error("Should not be able to remove a batch that includes a nullptr location");
+      } catch (std::invalid_argument &e) {
+      }
+
+      try {
+        frs->lookupEntries({file1, nullptr});
+        throw std::runtime_error("Should not be able to lookup a batch that includes a nullptr file");
+      } catch (std::invalid_argument &e) {
+      }
+
+      // Empty batches are no-ops
+      frs->addEntries({});
+      frs->removeEntries({});
+      if (not frs->lookupEntries({}).empty()) {
+        throw std::runtime_error("Looking up an empty batch should return an empty map");
+      }
+
+      // Add entries in one batch (with a duplicate, which should be ignored)
+      double before = wrench::Simulation::getCurrentSimulatedDate();
+      frs->addEntries({std::make_pair(file1, location1),
+                       std::make_pair(file1, location2),
+                       std::make_pair(file2, location2),
+                       std::make_pair(file2, location2)});
+      double batched_duration = wrench::Simulation::getCurrentSimulatedDate() - before;
+
+      // Adding the same entries one by one should not be cheaper
+      before = wrench::Simulation::getCurrentSimulatedDate();
+      frs->addEntry(file1, location1);
+      frs->addEntry(file1, location2);
+      frs->addEntry(file2, location2);
+      frs->addEntry(file2, location2);
+      double individual_duration = wrench::Simulation::getCurrentSimulatedDate() - before;
+      if (batched_duration > individual_duration + 0.0001) {
+        throw std::runtime_error("A batched add should not take longer than individual adds (" +
+                                 std::to_string(batched_duration) + " > " + std::to_string(individual_duration) + ")");
+      }
+
+      // Lookup all files in one batch
+      auto locations = frs->lookupEntries({file1, file2, file3});
+      if (locations.size() != 3) {
+        throw std::runtime_error("Got a wrong number of files in the lookup answer");
+      }
+      if ((locations[file1].size() != 2) or (locations[file2].size() != 1) or (not locations[file3].empty())) {
+        throw std::runtime_error("Got a wrong number of locations for some file");
+      }
+      if ((*locations[file2].begin())->getStorageService() != this->test->storage_service2) {
+        throw std::runtime_error("Got the wrong location for file2");
+      }
+
+      // The batched lookup should agree with individual lookups
+      if (frs->lookupEntry(file1).size() != 2) {
+        throw std::runtime_error("Batched and individual lookups disagree for file1");
+      }
+
+      // Remove entries in one batch (one of which does not exist, which is ignored)
+      frs->removeEntries({std::make_pair(file1, location1),
+                          std::make_pair(file3, location1)});
+
+      locations = frs->lookupEntries({file1, file2});
+      if ((locations[file1].size() != 1) or
+          ((*locations[file1].begin())->getStorageService() != this->test->storage_service2)) {
+        throw std::runtime_error("Got the wrong locations for file1 after a batched removal");
+      }
+      if (locations[file2].size() != 1) {
+        throw std::runtime_error("Got the wrong locations for file2 after a batched removal");
+      }
+
+      // Shutting down the service
+      frs->stop();
+
+      try {
+        frs->addEntries({std::make_pair(file3, location1)});
+        throw std::runtime_error("Should not be able to add entries to a service that is down");
+      } catch (wrench::WorkflowExecutionException &e) {
+        if (not std::dynamic_pointer_cast<wrench::ServiceIsDown>(e.getCause())) {
+          throw std::runtime_error("Got an exception, as expected, but of the unexpected failure cause: " +
+                                   e.getCause()->toString() + " (expected: ServiceIsDown)");
+        }
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(FileRegistryTest, BatchedOperations) {
+  DO_TEST_WITH_FORK(do_BatchedOperations_Test);
+}
+
+void FileRegistryTest::do_BatchedOperations_Test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("file_registry_batched_operations_test");
+
+  simulation->init(&argc, argv);
+
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  std::string host1 = wrench::Simulation::getHostnameList()[0];
+  std::string host2 = wrench::Simulation::getHostnameList()[1];
+
+  ASSERT_NO_THROW(storage_service1 = simulation->add(
+          new wrench::SimpleStorageService(host1, {"/"})));
+
+  ASSERT_NO_THROW(storage_service2 = simulation->add(
+          new wrench::SimpleStorageService(host2, {"/"})));
+
+  std::shared_ptr<wrench::FileRegistryService> file_registry_service = nullptr;
+  ASSERT_NO_THROW(file_registry_service = simulation->add(new wrench::FileRegistryService(host2)));
+
+  std::shared_ptr<wrench::WMS> wms = nullptr;;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new FileRegistryBatchedOperationsTestWMS(
+                  this, {storage_service1, storage_service2}, file_registry_service, host1)));
+
+  ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
+
+/**********************************************************************/
+/**   SHARDED REGISTRY TEST                                          **/
+/**********************************************************************/
+
+#define NUM_SHARDED_FILES 30
+
+class FileRegistryShardedTestWMS : public wrench::WMS {
+
+public:
+    FileRegistryShardedTestWMS(FileRegistryTest *test,
+                               const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                               std::shared_ptr<wrench::FileRegistryService> file_registry_service,
+                               std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, storage_services, {}, file_registry_service, hostname, "test") {
+      this->test = test;
+    }
+
+private:
+
+    FileRegistryTest *test;
+
+    int main() {
+
+      auto frs = this->getAvailableFileRegistryService();
+      auto location1 = wrench::FileLocation::LOCATION(this->test->storage_service1);
+      auto location2 = wrench::FileLocation::LOCATION(this->test->storage_service2);
+
+      // Files that were staged before the simulation started should be found in whichever shard holds them
+      std::vector<wrench::WorkflowFile *> files;
+      for (unsigned long i = 0; i < NUM_SHARDED_FILES; i++) {
+        auto file = this->getWorkflow()->getFileByID("file_" + std::to_string(i));
+        files.push_back(file);
+        auto locations = frs->lookupEntry(file);
+        if ((locations.size() != 1) or ((*locations.begin())->getStorageService() != this->test->storage_service1)) {
+          throw std::runtime_error("Staged file " + file->getID() + " was not found in the registry");
+        }
+      }
+
+      // Single-entry operations
+      frs->addEntry(files[0], location2);
+      if (frs->lookupEntry(files[0]).size() != 2) {
+        throw std::runtime_error("Got a wrong number of locations for " + files[0]->getID());
+      }
+      frs->removeEntry(files[0], location2);
+      if (frs->lookupEntry(files[0]).size() != 1) {
+        throw std::runtime_error("Got a wrong number of locations for " + files[0]->getID());
+      }
+
+      // A batched lookup is spread over all shards, which each charge their own lookup costs
+      // concurrently (one second per file), so it should take less time than with a single shard
+      double before = wrench::Simulation::getCurrentSimulatedDate();
+      auto all_locations = frs->lookupEntries(files);
+      double duration = wrench::Simulation::getCurrentSimulatedDate() - before;
+      if (all_locations.size() != NUM_SHARDED_FILES) {
+        throw std::runtime_error("Got a wrong number of files in a batched lookup");
+      }
+      for (auto const &l : all_locations) {
+        if (l.second.size() != 1) {
+          throw std::runtime_error("Got a wrong number of locations for " + l.first->getID());
+        }
+      }
+      if ((duration < 1.0) or (duration > NUM_SHARDED_FILES - 1.0)) {
+        throw std::runtime_error("Unexpected batched lookup duration " + std::to_string(duration) +
+                                 " (lookups should have been processed concurrently by the shards)");
+      }
+
+      // Batched additions and removals over all shards
+      std::vector<std::pair<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>>> entries;
+      for (auto const &file : files) {
+        entries.push_back(std::make_pair(file, location2));
+      }
+      frs->addEntries(entries);
+      entries.clear();
+      for (auto const &file : files) {
+        entries.push_back(std::make_pair(file, location1));
+      }
+      frs->removeEntries(entries);
+
+      all_locations = frs->lookupEntries(files);
+      for (auto const &l : all_locations) {
+        if ((l.second.size() != 1) or ((*l.second.begin())->getStorageService() != this->test->storage_service2)) {
+          throw std::runtime_error("Got wrong locations for " + l.first->getID() + " after batched operations");
+        }
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(FileRegistryTest, ShardedRegistry) {
+  DO_TEST_WITH_FORK(do_ShardedRegistry_Test);
+}
+
+void FileRegistryTest::do_ShardedRegistry_Test() {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("file_registry_sharded_registry_test");
+
+  simulation->init(&argc, argv);
+
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  std::string host1 = wrench::Simulation::getHostnameList()[0];
+  std::string host2 = wrench::Simulation::getHostnameList()[1];
+
+  ASSERT_NO_THROW(storage_service1 = simulation->add(
+          new wrench::SimpleStorageService(host1, {"/"})));
+
+  ASSERT_NO_THROW(storage_service2 = simulation->add(
+          new wrench::SimpleStorageService(host2, {"/"})));
+
+  // Invalid number of shards
+  ASSERT_THROW(new wrench::FileRegistryService(host2, {{wrench::FileRegistryServiceProperty::NUM_SHARDS, "0"}}),
+               std::invalid_argument);
+
+  std::shared_ptr<wrench::FileRegistryService> file_registry_service = nullptr;
+  ASSERT_NO_THROW(file_registry_service = simulation->add(
+          new wrench::FileRegistryService(host2, {{wrench::FileRegistryServiceProperty::NUM_SHARDS,          "3"},
+                                                  {wrench::FileRegistryServiceProperty::LOOKUP_COMPUTE_COST, "1"}})));
+
+  for (unsigned long i = 0; i < NUM_SHARDED_FILES; i++) {
+    auto file = workflow->addFile("file_" + std::to_string(i), 100.0);
+    ASSERT_NO_THROW(simulation->stageFile(file, storage_service1));
+  }
+
+  std::shared_ptr<wrench::WMS> wms = nullptr;;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new FileRegistryShardedTestWMS(
+                  this, {storage_service1, storage_service2}, file_registry_service, host1)));
+
+  ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
+
+/**********************************************************************/
+/**   MANY REPLICAS TEST                                             **/
+/**********************************************************************/
+
+#define NUM_MANY_REPLICAS_FILES 100
+
+class FileRegistryManyReplicasTestWMS : public wrench::WMS {
+
+public:
+    FileRegistryManyReplicasTestWMS(FileRegistryTest *test,
+                                    unsigned long num_replicas,
+                                    const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                    std::shared_ptr<wrench::FileRegistryService> file_registry_service,
+                                    std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, storage_services, {}, file_registry_service, hostname, "test") {
+      this->test = test;
+      this->num_replicas = num_replicas;
+    }
+
+private:
+
+    FileRegistryTest *test;
+    unsigned long num_replicas;
+
+    // Register num_replicas replicas (in distinct directories) of each file, and check all lookups
+    std::vector<std::pair<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>>>
+    registerAndLookup(std::shared_ptr<wrench::FileRegistryService> frs, std::vector<wrench::WorkflowFile *> &files,
+                      std::string directory_prefix) {
+      std::vector<std::pair<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>>> entries;
+      for (auto const &file : files) {
+        for (unsigned long j = 0; j < this->num_replicas; j++) {
+          entries.push_back(std::make_pair(file, wrench::FileLocation::LOCATION(
+                  (j % 2) ? this->test->storage_service1 : this->test->storage_service2,
+                  directory_prefix + std::to_string(j))));
+        }
+      }
+      frs->addEntries(entries);
+
+      for (auto const &file : files) {
+        auto locations = frs->lookupEntry(file);
+        if (locations.size() != this->num_replicas) {
+          throw std::runtime_error("Got a wrong number of locations (" + std::to_string(locations.size()) +
+                                   " instead of " + std::to_string(this->num_replicas) + ")");
+        }
+        for (auto const &l : locations) {
+          if (l->getAbsolutePathAtMountPoint().find(directory_prefix) == std::string::npos) {
+            throw std::runtime_error("Got an unexpected location: " + l->toString());
+          }
+        }
+      }
+      return entries;
+    }
+
+    int main() {
+
+      auto frs = this->getAvailableFileRegistryService();
+
+      std::vector<wrench::WorkflowFile *> files;
+      for (unsigned long i = 0; i < NUM_MANY_REPLICAS_FILES; i++) {
+        files.push_back(this->getWorkflow()->addFile("file_" + std::to_string(i), 100.0));
+      }
+
+      // Register, then remove all entries, one replica at a time
+      auto entries = this->registerAndLookup(frs, files, "/replica_");
+      frs->removeEntries(entries);
+      for (auto const &file : files) {
+        if (not frs->lookupEntry(file).empty()) {
+          throw std::runtime_error("All entries should have been removed");
+        }
+      }
+
+      // Register replicas at other locations (which reuse the released location IDs)
+      entries = this->registerAndLookup(frs, files, "/other_replica_");
+      frs->removeEntries(entries);
+      if (not frs->lookupEntry(files[0]).empty()) {
+        throw std::runtime_error("All entries should have been removed");
+      }
+
+      return 0;
+    }
+};
+
+TEST_F(FileRegistryTest, ManyReplicas) {
+  for (unsigned long num_replicas : {1, 10, 100, 1000}) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_ManyReplicas_Test, num_replicas);
+  }
+}
+
+void FileRegistryTest::do_ManyReplicas_Test(unsigned long num_replicas) {
+
+  // Create and initialize a simulation
+  auto simulation = new wrench::Simulation();
+  int argc = 1;
+  char **argv = (char **) calloc(1, sizeof(char *));
+  argv[0] = strdup("file_registry_many_replicas_test");
+
+  simulation->init(&argc, argv);
+
+  ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+  std::string host1 = wrench::Simulation::getHostnameList()[0];
+  std::string host2 = wrench::Simulation::getHostnameList()[1];
+
+  ASSERT_NO_THROW(storage_service1 = simulation->add(
+          new wrench::SimpleStorageService(host1, {"/"})));
+
+  ASSERT_NO_THROW(storage_service2 = simulation->add(
+          new wrench::SimpleStorageService(host2, {"/"})));
+
+  std::shared_ptr<wrench::FileRegistryService> file_registry_service = nullptr;
+  ASSERT_NO_THROW(file_registry_service = simulation->add(new wrench::FileRegistryService(host1)));
+
+  std::shared_ptr<wrench::WMS> wms = nullptr;;
+  ASSERT_NO_THROW(wms = simulation->add(
+          new FileRegistryManyReplicasTestWMS(
+                  this, num_replicas, {storage_service1, storage_service2}, file_registry_service, host1)));
+
+  ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+  ASSERT_NO_THROW(simulation->launch());
+
+  delete simulation;
+
+  free(argv[0]);
+  free(argv);
+}
@@ -22,6 +22,7 @@ public:
 
 
     void do_StateChangeDetection_test();
+    void do_MultipleDetectors_test();
 
 protected:
     HostStateChangeDetectorServiceTest() {
@@ -33,8 +34,11 @@ protected:
                           "   <zone id=\"AS0\" routing=\"Full\"> "
                           "       <host id=\"Host1\" speed=\"1f\" core=\"1\"/> "
                           "       <host id=\"Host2\" speed=\"1f, 2f\" pstate=\"0\" core=\"1\"/> "
+                          "       <host id=\"Host3\" speed=\"1f\" core=\"1\"/> "
                           "       <link id=\"1\" bandwidth=\"1Bps\" latency=\"0us\"/>"
                           "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+                          "       <route src=\"Host1\" dst=\"Host3\"> <link_ctn id=\"1\"/> </route>"
+                          "       <route src=\"Host2\" dst=\"Host3\"> <link_ctn id=\"1\"/> </route>"
                           "   </zone> "
                           "</platform>";
         FILE *platform_file = fopen(platform_file_path.c_str(), "w");
@@ -114,6 +118,46 @@ private:
 
         ssd->kill(); // coverage
 
+        // A detector whose creator is already down terminates right away
+        auto frs = this->simulation->startNewService(new wrench::FileRegistryService(this->hostname));
+        frs->stop();
+        auto orphan_ssd = std::shared_ptr<wrench::HostStateChangeDetector>(
+                new wrench::HostStateChangeDetector(this->hostname, hosts, true, true, true,
+                frs, this->mailbox_name, {}));
+        orphan_ssd->simulation = this->simulation;
+        orphan_ssd->start(orphan_ssd, true, false);
+
+        wrench::Simulation::sleep(10);
+        if (orphan_ssd->isUp()) {
+            throw std::runtime_error("A detector whose creator is down should have terminated");
+        }
+
+        // A running detector terminates when its creator terminates, and no longer reports host changes
+        auto other_frs = this->simulation->startNewService(new wrench::FileRegistryService(this->hostname));
+        auto other_ssd = std::shared_ptr<wrench::HostStateChangeDetector>(
+                new wrench::HostStateChangeDetector(this->hostname, hosts, true, true, true,
+                other_frs, this->mailbox_name, {}));
+        other_ssd->simulation = this->simulation;
+        other_ssd->start(other_ssd, true, false);
+
+        wrench::Simulation::sleep(10);
+        if (not other_ssd->isUp()) {
+            throw std::runtime_error("A detector whose creator is up should be running");
+        }
+
+        other_frs->stop();
+        wrench::Simulation::sleep(10);
+        if (other_ssd->isUp()) {
+            throw std::runtime_error("A detector whose creator has terminated should have terminated");
+        }
+
+        wrench::Simulation::turnOffHost("Host2");
+        try {
+            message = wrench::S4U_Mailbox::getMessage(this->mailbox_name, 10);
+            throw std::runtime_error("Unexpected " + message->getName() + " message");
+        } catch (std::shared_ptr<wrench::NetworkError> &e) {
+            // Expected timeout
+        }
 
         return 0;
     }
@@ -150,4 +194,142 @@ void HostStateChangeDetectorServiceTest::do_StateChangeDetection_test() {
 
     free(argv[0]);
     free(argv);
-}
\ No newline at end of file
+}
+
+/**********************************************************************/
+/**  MULTIPLE DETECTORS TEST                                         **/
+/**********************************************************************/
+
+class HostStateChangeDetectorMultipleDetectorsTestWMS : public wrench::WMS {
+
+public:
+    HostStateChangeDetectorMultipleDetectorsTestWMS(HostStateChangeDetectorServiceTest *test,
+                                                    std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+
+private:
+
+    HostStateChangeDetectorServiceTest *test;
+
+    std::shared_ptr<wrench::HostStateChangeDetector> createDetector(std::vector<std::string> hosts,
+                                                                    bool notify_when_turned_on,
+                                                                    bool notify_when_turned_off,
+                                                                    std::string mailbox) {
+        auto ssd = std::shared_ptr<wrench::HostStateChangeDetector>(
+                new wrench::HostStateChangeDetector(this->hostname, hosts, notify_when_turned_on,
+                                                    notify_when_turned_off, false,
+                                                    this->getSharedPtr<wrench::WMS>(), mailbox, {}));
+        ssd->simulation = this->simulation;
+        ssd->start(ssd, true, false);
+        return ssd;
+    }
+
+    int main() {
+
+        std::string mailbox_2 = "mailbox_host2";
+        std::string mailbox_3 = "mailbox_host3";
+        std::string mailbox_on = "mailbox_on_only";
+
+        // One detector per host, a detector that monitors Host2 twice, and one that only cares about hosts turning on
+        auto ssd_2 = this->createDetector({"Host2", "Host2"}, true, true, mailbox_2);
+        auto ssd_3 = this->createDetector({"Host3"}, true, true, mailbox_3);
+        auto ssd_on = this->createDetector({"Host2", "Host3"}, true, false, mailbox_on);
+
+        wrench::Simulation::sleep(10);
+        double turn_off_date = wrench::Simulation::getCurrentSimulatedDate();
+        wrench::Simulation::turnOffHost("Host2");
+
+        // The Host2 detector is notified once, right away
+        std::shared_ptr<wrench::SimulationMessage> message;
+        try {
+            message = wrench::S4U_Mailbox::getMessage(mailbox_2, 10);
+        } catch (std::shared_ptr<wrench::NetworkError> &e) {
+            throw std::runtime_error("Did not get a message before the timeout");
+        }
+        if (not std::dynamic_pointer_cast<wrench::HostHasTurnedOffMessage>(message)) {
+            throw std::runtime_error("Did not get the expected 'host has turned off' message");
+        }
+        if (wrench::Simulation::getCurrentSimulatedDate() != turn_off_date) {
+            throw std::runtime_error("The 'host has turned off' message should arrive as soon as the host turns off");
+        }
+        if (wrench::S4U_Mailbox::hasPendingMessage(mailbox_2)) {
+            throw std::runtime_error("A detector should be notified only once per host event");
+        }
+
+        // The other detectors are not notified
+        wrench::Simulation::sleep(10);
+        if (wrench::S4U_Mailbox::hasPendingMessage(mailbox_3) or wrench::S4U_Mailbox::hasPendingMessage(mailbox_on)) {
+            throw std::runtime_error("Detectors should not be notified about hosts they don't care about");
+        }
+
+        // Turning Host3 off and then on notifies the Host3 detector twice, and the "on only" detector once
+        wrench::Simulation::turnOffHost("Host3");
+        wrench::Simulation::turnOnHost("Host3");
+
+        try {
+            message = wrench::S4U_Mailbox::getMessage(mailbox_3, 10);
+            if (not std::dynamic_pointer_cast<wrench::HostHasTurnedOffMessage>(message)) {
+                throw std::runtime_error("Did not get the expected 'host has turned off' message");
+            }
+            message = wrench::S4U_Mailbox::getMessage(mailbox_3, 10);
+            if (not std::dynamic_pointer_cast<wrench::HostHasTurnedOnMessage>(message)) {
+                throw std::runtime_error("Did not get the expected 'host has turned on' message");
+            }
+            message = wrench::S4U_Mailbox::getMessage(mailbox_on, 10);
+            if (not std::dynamic_pointer_cast<wrench::HostHasTurnedOnMessage>(message)) {
+                throw std::runtime_error("Did not get the expected 'host has turned on' message");
+            }
+        } catch (std::shared_ptr<wrench::NetworkError> &e) {
+            throw std::runtime_error("Did not get a message before the timeout");
+        }
+
+        // A killed detector is no longer notified
+        ssd_3->kill();
+        wrench::Simulation::turnOffHost("Host3");
+        wrench::Simulation::sleep(10);
+        if (wrench::S4U_Mailbox::hasPendingMessage(mailbox_3)) {
+            throw std::runtime_error("A killed detector should not send notifications");
+        }
+
+        ssd_2->kill();
+        ssd_on->kill();
+
+        return 0;
+    }
+};
+
+TEST_F(HostStateChangeDetectorServiceTest, MultipleDetectorsTest) {
+    DO_TEST_WITH_FORK(do_MultipleDetectors_test);
+}
+
+void HostStateChangeDetectorServiceTest::do_MultipleDetectors_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+
+    int argc = 1;
+    auto argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    simulation->instantiatePlatform(platform_file_path);
+
+    // Create the WMS
+    auto  wms = simulation->add(new HostStateChangeDetectorMultipleDetectorsTestWMS(this,"Host1"));
+
+    // Create a bogus workflow
+    auto workflow =  std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+    wms->addWorkflow(workflow.get());
+
+    simulation->launch();
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
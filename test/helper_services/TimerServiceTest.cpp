@@ -0,0 +1,259 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "../include/TestWithFork.h"
+#include "../include/UniqueTmpPathPrefix.h"
+#include <wrench/workflow/failure_causes/HostError.h>
+
+class TimerServiceTest : public ::testing::Test {
+
+public:
+
+    void do_TimersGoOffInOrder_Test();
+    void do_downHost_Test();
+
+protected:
+    TimerServiceTest() {
+
+        // Create the simplest workflow
+        workflow = new wrench::Workflow();
+
+        // Create a two-host platform file
+        std::string xml = "<?xml version='1.0'?>"
+                          "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                          "<platform version=\"4.1\"> "
+                          "   <zone id=\"AS0\" routing=\"Full\"> "
+                          "       <host id=\"Host1\" speed=\"1f\" core=\"10\"/> "
+                          "       <host id=\"Host2\" speed=\"1f\" core=\"10\"/> "
+                          "       <link id=\"1\" bandwidth=\"5000GBps\" latency=\"0us\"/>"
+                          "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\""
+                          "/> </route>"
+                          "   </zone> "
+                          "</platform>";
+
+        FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+        fprintf(platform_file, "%s", xml.c_str());
+        fclose(platform_file);
+
+    }
+
+    std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+    wrench::Workflow *workflow;
+
+};
+
+
+/**********************************************************************/
+/**  TIMERS GO OFF IN ORDER TEST                                     **/
+/**********************************************************************/
+
+
+class TimersGoOffInOrderTestWMS : public wrench::WMS {
+
+public:
+    TimersGoOffInOrderTestWMS(TimerServiceTest *test,
+                              std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  {}, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    TimerServiceTest *test;
+
+    int main() {
+
+        // Set timers out of order, with one that will be cancelled
+        auto timer_10 = this->setTimer(10.0, "10");
+        auto timer_5 = this->setTimer(5.0, "5");
+        auto timer_20 = this->setTimer(20.0, "20");
+        auto timer_7 = this->setTimer(7.0, "7");
+        timer_7->cancel();
+
+        if (timer_7->isPending() or (not timer_5->isPending())) {
+            throw std::runtime_error("Unexpected timer pending status");
+        }
+
+        auto timer_service = this->simulation->getTimerService(this->hostname);
+        if (timer_service->getNumPendingTimers() != 3) {
+            throw std::runtime_error("Unexpected number of pending timers (" +
+                                     std::to_string(timer_service->getNumPendingTimers()) + " instead of 3)");
+        }
+
+        // Timers should go off in date order, without the cancelled one
+        std::vector<std::pair<std::string, double>> expected = {{"5", 5.0}, {"10", 10.0}};
+        for (auto const &e : expected) {
+            auto event = this->waitForNextEvent();
+            auto timer_event = std::dynamic_pointer_cast<wrench::TimerEvent>(event);
+            if (not timer_event) {
+                throw std::runtime_error("Unexpected event: " + event->toString());
+            }
+            if (timer_event->message != e.first) {
+                throw std::runtime_error("Unexpected timer message " + timer_event->message +
+                                         " (expected " + e.first + ")");
+            }
+            if (std::abs(wrench::Simulation::getCurrentSimulatedDate() - e.second) > 0.001) {
+                throw std::runtime_error("Timer " + e.first + " went off at the wrong date (" +
+                                         std::to_string(wrench::Simulation::getCurrentSimulatedDate()) + ")");
+            }
+        }
+
+        if (timer_5->isPending() or timer_10->isPending() or (not timer_20->isPending())) {
+            throw std::runtime_error("Unexpected timer pending status");
+        }
+
+        // Cancel the last timer, which should then never go off
+        timer_20->cancel();
+        auto event = this->waitForNextEvent(100.0);
+        if (event != nullptr) {
+            throw std::runtime_error("Should not have received an event: " + event->toString());
+        }
+
+        if (timer_service->getNumPendingTimers() != 0) {
+            throw std::runtime_error("There should be no more pending timers");
+        }
+
+        // The same service is used for all timers on a host
+        if (this->simulation->getTimerService(this->hostname) != timer_service) {
+            throw std::runtime_error("There should be a single timer service per host");
+        }
+
+        // A timer in the past goes off immediately
+        double now = wrench::Simulation::getCurrentSimulatedDate();
+        this->setTimer(now - 10.0, "past");
+        event = this->waitForNextEvent();
+        auto timer_event = std::dynamic_pointer_cast<wrench::TimerEvent>(event);
+        if ((not timer_event) or (timer_event->message != "past") or
+            (wrench::Simulation::getCurrentSimulatedDate() != now)) {
+            throw std::runtime_error("A timer in the past should go off immediately");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(TimerServiceTest, TimersGoOffInOrder) {
+    DO_TEST_WITH_FORK(do_TimersGoOffInOrder_Test);
+}
+
+void TimerServiceTest::do_TimersGoOffInOrder_Test() {
+
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    char **argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("timer_service_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new TimersGoOffInOrderTestWMS(this, "Host1")));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    // Running the simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**  DOWN HOST TEST                                                  **/
+/**********************************************************************/
+
+
+class TimerServiceDownHostTestWMS : public wrench::WMS {
+
+public:
+    TimerServiceDownHostTestWMS(TimerServiceTest *test,
+                                std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  {}, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    TimerServiceTest *test;
+
+    int main() {
+
+        // Set a timer on Host2, and turn Host2 off before it goes off
+        std::string mailbox = "mailbox";
+        auto timer = this->simulation->getTimerService("Host2")->setTimer(
+                10.0, mailbox, new wrench::SimulationMessage("whatever", 0));
+        wrench::Simulation::sleep(1.0);
+        wrench::Simulation::turnOffHost("Host2");
+        wrench::Simulation::sleep(1.0);
+
+        if (timer->isPending()) {
+            throw std::runtime_error("A timer registered on a host that has failed should no longer be pending");
+        }
+
+        // No timer service can be started on a down host
+        try {
+            this->simulation->getTimerService("Host2");
+            throw std::runtime_error("Should not be able to get a timer service on a down host");
+        } catch (std::shared_ptr<wrench::HostError> &e) {}
+
+        // A new timer service is started once the host is back on
+        wrench::Simulation::turnOnHost("Host2");
+        auto timer_service = this->simulation->getTimerService("Host2");
+        if (timer_service->getNumPendingTimers() != 0) {
+            throw std::runtime_error("A restarted timer service should have no pending timers");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(TimerServiceTest, DownHost) {
+    DO_TEST_WITH_FORK(do_downHost_Test);
+}
+
+void TimerServiceTest::do_downHost_Test() {
+
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    char **argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("timer_service_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new TimerServiceDownHostTestWMS(this, "Host1")));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    // Running the simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
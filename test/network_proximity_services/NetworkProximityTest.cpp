@@ -33,6 +33,8 @@ public:
 
     void do_VivaldiConverge_Test();
 
+    void do_AnalyticalNetworkProximity_Test();
+
     void do_ValidateProperties_Test();
 
 protected:
@@ -504,6 +506,7 @@ private:
 
         std::shared_ptr<wrench::NetworkProximityService> alltoall_service;
         std::shared_ptr<wrench::NetworkProximityService> vivaldi_service;
+        std::shared_ptr<wrench::NetworkProximityService> vivaldi_3d_height_service;
 
         for (auto  &nps : network_proximity_services) {
             std::string type = nps->getNetworkProximityServiceType();
@@ -513,7 +516,12 @@ private:
             }
 
             if (boost::iequals(type, "vivaldi")) {
-                vivaldi_service = nps;
+                if (nps->getPropertyValueAsString(
+                        wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_DIMENSIONS) == "3") {
+                    vivaldi_3d_height_service = nps;
+                } else {
+                    vivaldi_service = nps;
+                }
             }
         }
 
@@ -533,6 +541,16 @@ private:
             throw std::runtime_error("Vivaldi algorithm did not converge");
         }
 
+        // Same checks with 3-D coordinates with a height component
+        double vivaldi_3d_height_proximity = vivaldi_3d_height_service->getHostPairDistance(hosts_to_compute_proximity).first;
+        if (std::abs(vivaldi_3d_height_proximity - alltoall_proximity) > epsilon) {
+            throw std::runtime_error("Vivaldi algorithm (3-D with height) did not converge");
+        }
+        std::pair<double,double> coordinates_3d = vivaldi_3d_height_service->getHostCoordinate("Host3").first;
+        if (coordinates_3d.first == 0 && coordinates_3d.second == 0) {
+            throw std::runtime_error("Vivaldi algorithm (3-D with height) did not update the coordinates of host: Host3");
+        }
+
         std::string target_host = "Host3";
         std::pair<double,double> coordinates = vivaldi_service->getHostCoordinate(target_host).first;
 
@@ -631,6 +649,14 @@ void NetworkProximityTest::do_VivaldiConverge_Test() {
             new wrench::NetworkProximityService(network_proximity_db_hostname, hosts_in_network,
                                                 {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "VIVALDI"},
                                                  {wrench::NetworkProximityServiceProperty::NETWORK_DAEMON_COMMUNICATION_COVERAGE, "1.0"}})));
+
+    std::shared_ptr<wrench::NetworkProximityService> vivaldi_3d_height_network_service = nullptr;
+    ASSERT_NO_THROW(vivaldi_3d_height_network_service = simulation->add(
+            new wrench::NetworkProximityService(network_proximity_db_hostname, hosts_in_network,
+                                                {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "VIVALDI"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_DAEMON_COMMUNICATION_COVERAGE, "0.5"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_DIMENSIONS, "3"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_HEIGHT, "true"}})));
     // Create a WMS
     std::shared_ptr<wrench::WMS> wms = nullptr;;
     ASSERT_NO_THROW(wms = simulation->add(
@@ -638,7 +664,7 @@ void NetworkProximityTest::do_VivaldiConverge_Test() {
                     this,
                     (std::set<std::shared_ptr<wrench::ComputeService>>){compute_service},
                     (std::set<std::shared_ptr<wrench::StorageService>>){storage_service1},
-                    (std::set<std::shared_ptr<wrench::NetworkProximityService>>){alltoall_network_service, vivaldi_network_service},
+                    (std::set<std::shared_ptr<wrench::NetworkProximityService>>){alltoall_network_service, vivaldi_network_service, vivaldi_3d_height_network_service},
                     hostname)));
 
     ASSERT_NO_THROW(wms->addWorkflow(workflow.get()));
@@ -652,6 +678,150 @@ void NetworkProximityTest::do_VivaldiConverge_Test() {
     free(argv);
 }
 
+/**********************************************************************/
+/**  ANALYTICAL NETWORK PROXIMITY TEST                               **/
+/**********************************************************************/
+
+class AnalyticalNetworkProximityWMS : public wrench::WMS {
+public:
+    AnalyticalNetworkProximityWMS(NetworkProximityTest *test,
+                                  std::set<std::shared_ptr<wrench::ComputeService>> compute_services,
+                                  std::set<std::shared_ptr<wrench::StorageService>> storage_services,
+                                  std::set<std::shared_ptr<wrench::NetworkProximityService>> network_proximity_services,
+                                  std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services,
+                        network_proximity_services, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+    NetworkProximityTest *test;
+
+    int main() {
+
+        std::shared_ptr<wrench::NetworkProximityService> analytical_service;
+        std::shared_ptr<wrench::NetworkProximityService> noisy_analytical_service;
+
+        for (auto &nps : this->getAvailableNetworkProximityServices()) {
+            if (nps->getPropertyValueAsDouble(
+                    wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_ANALYTICAL_NOISE) > 0) {
+                noisy_analytical_service = nps;
+            } else {
+                analytical_service = nps;
+            }
+        }
+
+        // Estimates are available right away: the route from Host3 to Host4 has a 1000us latency
+        // and a 1000GBps bandwidth, and the default message size is 1024 bytes
+        double expected_proximity = 0.001 + 1024.0 / 1000000000000.0;
+        double request_date = wrench::Simulation::getCurrentSimulatedDate();
+        auto answer = analytical_service->getHostPairDistance(std::make_pair("Host3", "Host4"));
+        double answer_date = wrench::Simulation::getCurrentSimulatedDate();
+        if (std::abs(answer.first - expected_proximity) > 0.0000001) {
+            throw std::runtime_error("Unexpected analytical proximity value " + std::to_string(answer.first) +
+                                     " (expected " + std::to_string(expected_proximity) + ")");
+        }
+        if ((answer.second < request_date) or (answer.second > answer_date)) {
+            throw std::runtime_error("Unexpected analytical proximity timestamp " + std::to_string(answer.second) +
+                                     " (expected between " + std::to_string(request_date) + " and " +
+                                     std::to_string(answer_date) + ")");
+        }
+
+        // Unknown hosts
+        answer = analytical_service->getHostPairDistance(std::make_pair("Host3", "BogusHost"));
+        if (answer.first != wrench::NetworkProximityService::NOT_AVAILABLE) {
+            throw std::runtime_error("Should get a NOT_AVAILABLE proximity value for an unknown host");
+        }
+
+        // Noisy estimates are within bounds, and stable
+        double noisy_proximity = noisy_analytical_service->getHostPairDistance(std::make_pair("Host3", "Host4")).first;
+        if ((noisy_proximity < 0.5 * expected_proximity) or (noisy_proximity > 1.5 * expected_proximity)) {
+            throw std::runtime_error("Noisy analytical proximity value out of bounds");
+        }
+        wrench::Simulation::sleep(100);
+        if (noisy_analytical_service->getHostPairDistance(std::make_pair("Host3", "Host4")).first != noisy_proximity) {
+            throw std::runtime_error("Noisy analytical proximity value should not change over time");
+        }
+
+        // Landmark coordinates
+        std::pair<double,double> coordinates = analytical_service->getHostCoordinate("Host3").first;
+        if (coordinates.first == 0 && coordinates.second == 0) {
+            throw std::runtime_error("Analytical coordinates of host Host3 should not be at the origin");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(NetworkProximityTest, AnalyticalNetworkProximityTest) {
+    DO_TEST_WITH_FORK(do_AnalyticalNetworkProximity_Test);
+}
+
+void NetworkProximityTest::do_AnalyticalNetworkProximity_Test() {
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    char **argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = wrench::Simulation::getHostnameList()[0];
+
+    // Create a Storage Service
+    ASSERT_NO_THROW(storage_service1 = simulation->add(
+            new wrench::SimpleStorageService(hostname, {"/"})));
+
+    // Create a file registry service
+    simulation->add(new wrench::FileRegistryService(hostname));
+
+    // Staging the input_file on the storage service
+    ASSERT_NO_THROW(simulation->stageFile(input_file, storage_service1));
+
+    std::string network_proximity_db_hostname = wrench::Simulation::getHostnameList()[1];
+    std::vector<std::string> hosts_in_network = wrench::Simulation::getHostnameList();
+
+    std::shared_ptr<wrench::NetworkProximityService> analytical_network_service = nullptr;
+    std::shared_ptr<wrench::NetworkProximityService> noisy_analytical_network_service = nullptr;
+
+    ASSERT_THROW(simulation->add(
+            new wrench::NetworkProximityService(network_proximity_db_hostname, hosts_in_network,
+                                                {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "ANALYTICAL"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_ANALYTICAL_NOISE, "1.0"}})),
+                 std::invalid_argument);
+
+    ASSERT_NO_THROW(analytical_network_service = simulation->add(
+            new wrench::NetworkProximityService(network_proximity_db_hostname, hosts_in_network,
+                                                {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "ANALYTICAL"}})));
+
+    ASSERT_NO_THROW(noisy_analytical_network_service = simulation->add(
+            new wrench::NetworkProximityService(network_proximity_db_hostname, hosts_in_network,
+                                                {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "ANALYTICAL"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_ANALYTICAL_NOISE, "0.5"}})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new AnalyticalNetworkProximityWMS(
+                    this, {},
+                    (std::set<std::shared_ptr<wrench::StorageService>>){storage_service1},
+                    (std::set<std::shared_ptr<wrench::NetworkProximityService>>){analytical_network_service, noisy_analytical_network_service},
+                    hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    free(argv[0]);
+    free(argv);
+}
+
 /**********************************************************************/
 /**  VALIDATE PROPERTIES TEST                                        **/
 /**********************************************************************/
@@ -742,6 +912,24 @@ void NetworkProximityTest::do_ValidateProperties_Test() {
                                                  {wrench::NetworkProximityServiceProperty::NETWORK_DAEMON_COMMUNICATION_COVERAGE, "-1.1"}})),
                  std::invalid_argument);
 
+    ASSERT_THROW(nps = simulation->add(
+            new wrench::NetworkProximityService(network_proximity_db_hostname, hosts_in_network,
+                                                {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "VIVALDI"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_DIMENSIONS, "0"}})),
+                 std::invalid_argument);
+
+    ASSERT_THROW(nps = simulation->add(
+            new wrench::NetworkProximityService(network_proximity_db_hostname, hosts_in_network,
+                                                {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "VIVALDI"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_DIMENSIONS, "two"}})),
+                 std::invalid_argument);
+
+    ASSERT_THROW(nps = simulation->add(
+            new wrench::NetworkProximityService(network_proximity_db_hostname, hosts_in_network,
+                                                {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "VIVALDI"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_VIVALDI_HEIGHT, "maybe"}})),
+                 std::invalid_argument);
+
     ASSERT_THROW(nps = simulation->add(
             new wrench::NetworkProximityService(network_proximity_db_hostname, hosts_in_network,
                                                 {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "ALLTOALL"}},
@@ -15,6 +15,7 @@
 #include "../../include/UniqueTmpPathPrefix.h"
 #include "../failure_test_util/ResourceSwitcher.h"
 #include "wrench/services/helpers/ServiceTerminationDetector.h"
+#include "wrench/services/helpers/ServiceLivenessMonitor.h"
 #include "../failure_test_util/SleeperVictim.h"
 #include "../failure_test_util/ComputerVictim.h"
 
@@ -29,6 +30,8 @@ public:
 
     void do_FailureDetectorForSleeperTest_test();
     void do_FailureDetectorForComputerTest_test();
+    void do_ServiceLivenessMonitorForSleeperTest_test();
+    void do_ServiceLivenessMonitorCreatorExitTest_test();
 
 protected:
 
@@ -318,3 +321,241 @@ void FailureDetectorHostFailuresTest::do_FailureDetectorForComputerTest_test() {
     free(argv[0]);
     free(argv);
 }
+
+
+/**********************************************************************/
+/**          SERVICE LIVENESS MONITOR FOR SLEEPER TEST               **/
+/**********************************************************************/
+
+class ServiceLivenessMonitorForSleeperTestWMS : public wrench::WMS {
+
+public:
+    ServiceLivenessMonitorForSleeperTestWMS(FailureDetectorHostFailuresTest *test,
+                                            std::string &hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    FailureDetectorHostFailuresTest *test;
+
+    int main() override {
+
+        // Starting the (single) liveness monitor
+        auto monitor = std::shared_ptr<wrench::ServiceLivenessMonitor>(
+                new wrench::ServiceLivenessMonitor("StableHost", this->getSharedPtr<wrench::Service>(), this->mailbox_name, true, true));
+        monitor->simulation = this->simulation;
+        monitor->start(monitor, true, false); // Daemonized, no auto-restart
+
+        // Starting a victim on the FailedHost, which should fail at time 50
+        auto victim1 = std::shared_ptr<wrench::SleeperVictim>(new wrench::SleeperVictim("FailedHost", 200, new wrench::ServiceTTLExpiredMessage(1), this->mailbox_name));
+        victim1->simulation = this->simulation;
+        victim1->start(victim1, true, false); // Daemonized, no auto-restart
+        monitor->monitor(victim1);
+
+        // Starting its nemesis!
+        auto murderer = std::shared_ptr<wrench::ResourceSwitcher>(new wrench::ResourceSwitcher("StableHost", 50, "FailedHost",
+                wrench::ResourceSwitcher::Action::TURN_OFF, wrench::ResourceSwitcher::ResourceType::HOST));
+        murderer->simulation = this->simulation;
+        murderer->start(murderer, true, false); // Daemonized, no auto-restart
+
+        // Starting a victim on the FailedHostTrace, which should fail at time 100
+        auto victim2 = std::shared_ptr<wrench::SleeperVictim>(new wrench::SleeperVictim("FailedHostTrace", 200, new wrench::ServiceTTLExpiredMessage(1), this->mailbox_name));
+        victim2->simulation = this->simulation;
+        victim2->start(victim2, true, false); // Daemonized, no auto-restart
+        monitor->monitor(victim2);
+
+        // Starting a victim on the StableHost, which should terminate cleanly at time 150 (after sending me a message)
+        auto victim3 = std::shared_ptr<wrench::SleeperVictim>(new wrench::SleeperVictim("StableHost", 150, new wrench::ServiceTTLExpiredMessage(1), this->mailbox_name));
+        victim3->simulation = this->simulation;
+        victim3->start(victim3, true, false); // Daemonized, no auto-restart
+        monitor->monitor(victim3);
+
+        // Waiting for the messages, in order
+        std::vector<std::string> expected_messages = {"crash", "crash", "ttl", "termination"};
+        std::vector<std::shared_ptr<wrench::Service>> expected_services = {victim1, victim2, nullptr, victim3};
+        for (unsigned long i = 0; i < expected_messages.size(); i++) {
+            std::shared_ptr<wrench::SimulationMessage> message;
+            try {
+                message = wrench::S4U_Mailbox::getMessage(this->mailbox_name);
+            } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+                throw std::runtime_error("Network error while getting a message!" + cause->toString());
+            }
+
+            std::shared_ptr<wrench::Service> service = nullptr;
+            if (auto real_msg = std::dynamic_pointer_cast<wrench::ServiceHasCrashedMessage>(message)) {
+                if (expected_messages[i] != "crash") {
+                    throw std::runtime_error("Unexpected " + message->getName() + " message");
+                }
+                service = real_msg->service;
+            } else if (auto real_msg = std::dynamic_pointer_cast<wrench::ServiceHasTerminatedMessage>(message)) {
+                if (expected_messages[i] != "termination") {
+                    throw std::runtime_error("Unexpected " + message->getName() + " message");
+                }
+                service = real_msg->service;
+            } else if (std::dynamic_pointer_cast<wrench::ServiceTTLExpiredMessage>(message)) {
+                if (expected_messages[i] != "ttl") {
+                    throw std::runtime_error("Unexpected " + message->getName() + " message");
+                }
+            } else {
+                throw std::runtime_error("Unexpected " + message->getName() + " message");
+            }
+            if (service != expected_services[i]) {
+                throw std::runtime_error("Got a notification, but not for the right service!");
+            }
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(FailureDetectorHostFailuresTest, ServiceLivenessMonitorForSleeperTest) {
+    DO_TEST_WITH_FORK(do_ServiceLivenessMonitorForSleeperTest_test);
+}
+
+void FailureDetectorHostFailuresTest::do_ServiceLivenessMonitorForSleeperTest_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("failure_test");
+
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "StableHost";
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new ServiceLivenessMonitorForSleeperTestWMS(this, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    free(argv[0]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**          SERVICE LIVENESS MONITOR CREATOR EXIT TEST              **/
+/**********************************************************************/
+
+class ServiceLivenessMonitorCreatorExitTestWMS : public wrench::WMS {
+
+public:
+    ServiceLivenessMonitorCreatorExitTestWMS(FailureDetectorHostFailuresTest *test,
+                                             std::string &hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    FailureDetectorHostFailuresTest *test;
+
+    int main() override {
+
+        // Starting a creator on the StableHost, which should terminate cleanly at time 10 (after sending me a message)
+        auto creator = std::shared_ptr<wrench::SleeperVictim>(new wrench::SleeperVictim("StableHost", 10, new wrench::ServiceTTLExpiredMessage(1), this->mailbox_name));
+        creator->simulation = this->simulation;
+        creator->start(creator, true, false); // Daemonized, no auto-restart
+
+        // Starting the liveness monitor on behalf of the creator
+        auto monitor = std::shared_ptr<wrench::ServiceLivenessMonitor>(
+                new wrench::ServiceLivenessMonitor("StableHost", creator, this->mailbox_name, true, true));
+        monitor->simulation = this->simulation;
+        monitor->start(monitor, true, false); // Daemonized, no auto-restart
+
+        // Starting a victim on the StableHost, which is still monitored when the creator terminates,
+        // and which should terminate cleanly at time 50 (after sending me a message)
+        auto victim = std::shared_ptr<wrench::SleeperVictim>(new wrench::SleeperVictim("StableHost", 50, new wrench::ServiceTTLExpiredMessage(1), this->mailbox_name));
+        victim->simulation = this->simulation;
+        victim->start(victim, true, false); // Daemonized, no auto-restart
+        monitor->monitor(victim);
+
+        // Waiting for the creator's message
+        std::shared_ptr<wrench::SimulationMessage> message;
+        try {
+            message = wrench::S4U_Mailbox::getMessage(this->mailbox_name);
+        } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+            throw std::runtime_error("Network error while getting a message!" + cause->toString());
+        }
+        if (not std::dynamic_pointer_cast<wrench::ServiceTTLExpiredMessage>(message)) {
+            throw std::runtime_error("Unexpected " + message->getName() + " message");
+        }
+
+        // The monitor should terminate along with its creator, while the victim keeps running
+        wrench::Simulation::sleep(1);
+        if (monitor->isUp()) {
+            throw std::runtime_error("The monitor should have terminated along with its creator");
+        }
+        if (not victim->isUp()) {
+            throw std::runtime_error("The victim should still be running");
+        }
+
+        // Waiting for the victim's message
+        try {
+            message = wrench::S4U_Mailbox::getMessage(this->mailbox_name);
+        } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+            throw std::runtime_error("Network error while getting a message!" + cause->toString());
+        }
+        if (not std::dynamic_pointer_cast<wrench::ServiceTTLExpiredMessage>(message)) {
+            throw std::runtime_error("Unexpected " + message->getName() + " message");
+        }
+
+        // The victim's termination should not be reported, since the monitor is gone
+        try {
+            message = wrench::S4U_Mailbox::getMessage(this->mailbox_name, 10);
+            throw std::runtime_error("Unexpected " + message->getName() + " message");
+        } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+            // Expected timeout
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(FailureDetectorHostFailuresTest, ServiceLivenessMonitorCreatorExitTest) {
+    DO_TEST_WITH_FORK(do_ServiceLivenessMonitorCreatorExitTest_test);
+}
+
+void FailureDetectorHostFailuresTest::do_ServiceLivenessMonitorCreatorExitTest_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("failure_test");
+
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "StableHost";
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new ServiceLivenessMonitorCreatorExitTestWMS(this, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    free(argv[0]);
+    free(argv);
+}
@@ -76,6 +76,26 @@ private:
 
     int main() {
 
+        // Coverage
+        try {
+            wrench::S4U_Simulation::turnOffLink("bogus");
+            throw std::runtime_error("Should not be able to call turnOffLink on a bogus link");
+        } catch (std::invalid_argument &e) {
+        }
+        try {
+            wrench::S4U_Simulation::turnOnLink("bogus");
+            throw std::runtime_error("Should not be able to call turnOnLink on a bogus link");
+        } catch (std::invalid_argument &e) {
+        }
+        if (not wrench::S4U_Simulation::isLinkOn("link1")) {
+            throw std::runtime_error("Link link1 should be on");
+        }
+        try {
+            wrench::S4U_Simulation::isLinkOn("bogus");
+            throw std::runtime_error("Should not be able to call isLinkOn on a bogus link");
+        } catch (std::invalid_argument &e) {
+        }
+
         // Create an Alarm service that will go of in 10 seconds
         std::string mailbox = this->getWorkflow()->getCallbackMailbox();
         wrench::Alarm::createAndStartAlarm(this->simulation, 10,"Host2", mailbox,
@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2017-2020. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+// Compile out everything below WARN in this whole file (whatever the build's minimum log level)
+#undef WRENCH_MIN_LOG_LEVEL
+#define WRENCH_MIN_LOG_LEVEL WRENCH_LOG_LEVEL_WARN
+
+#include <gtest/gtest.h>
+#include <wrench-dev.h>
+
+#include "../include/TestWithFork.h"
+
+WRENCH_LOG_CATEGORY(simulation_compile_time_log_level_test, "Log category for Simulation Compile-Time Log Level Test");
+
+
+class SimulationCompileTimeLogLevelTest : public ::testing::Test {
+
+public:
+    void do_CompileTimeLogLevel_test();
+};
+
+
+/**********************************************************************/
+/**          COMPILE-TIME LOG LEVEL TEST                             **/
+/**********************************************************************/
+
+TEST_F(SimulationCompileTimeLogLevelTest, CompileTimeLogLevel) {
+    DO_TEST_WITH_FORK(do_CompileTimeLogLevel_test);
+}
+
+void SimulationCompileTimeLogLevelTest::do_CompileTimeLogLevel_test() {
+
+    // Enable all logging at runtime, so that only the compile-time level matters
+    xbt_log_control_set("simulation_compile_time_log_level_test.thresh:debug");
+
+    int num_evaluations = 0;
+    WRENCH_DEBUG("Should not be evaluated: %d", ++num_evaluations);
+    WRENCH_INFO("Should not be evaluated: %d", ++num_evaluations);
+    ASSERT_EQ(0, num_evaluations);
+
+    WRENCH_WARN("Should be evaluated: %d", ++num_evaluations);
+    ASSERT_EQ(1, num_evaluations);
+}
@@ -1,8 +1,10 @@
 #include <algorithm>
 #include <vector>
+#include <fstream>
 
 #include <gtest/gtest.h>
 #include <wrench-dev.h>
+#include <nlohmann/json.hpp>
 
 #include "../../include/TestWithFork.h"
 #include "../../include/UniqueTmpPathPrefix.h"
@@ -19,6 +21,7 @@ public:
 
     void do_EnergyMeterSingleMeasurementPeriod_test();
     void do_EnergyMeterMultipleMeasurementPeriod_test();
+    void do_EventDrivenEnergyMeter_test();
 
 protected:
 
@@ -48,6 +51,7 @@ protected:
     }
 
     std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+    std::string energy_consumption_data_file_path = UNIQUE_TMP_PATH_PREFIX + "energy_consumption.json";
 
 };
 
@@ -548,3 +552,143 @@ void SimulationTimestampEnergyTest::do_EnergyMeterMultipleMeasurementPeriod_test
     free(argv[1]);
     free(argv);
 }
+
+/**********************************************************************/
+/**            EVENT-DRIVEN ENERGY METER TEST                        **/
+/**********************************************************************/
+
+/**
+ * Testing that an event-driven EnergyMeter records SimulationTimestampEnergyConsumption
+ * timestamps only when the power consumption of a host may change, and that periodic
+ * measurements can be reconstructed exactly at dump time.
+ */
+
+class EventDrivenEnergyMeterTestWMS : public wrench::WMS {
+public:
+    EventDrivenEnergyMeterTestWMS(SimulationTimestampEnergyTest *test,
+                                  std::string &hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+    SimulationTimestampEnergyTest *test;
+
+    int main() {
+        try {
+            auto fail_em1 = this->createEventDrivenEnergyMeter(std::vector<std::string>());
+            throw std::runtime_error("createEventDrivenEnergyMeter should have thrown invalid argument if given an empty hostname list");
+        } catch (std::invalid_argument &e) { }
+
+        try {
+            auto fail_em2 = this->createEventDrivenEnergyMeter({"bogus"});
+            throw std::runtime_error("createEventDrivenEnergyMeter requires that hosts exist");
+        } catch (std::invalid_argument &e) { }
+
+        auto em = this->createEventDrivenEnergyMeter(wrench::Simulation::getHostnameList());
+
+        const double MEGAFLOP = 1000.0 * 1000.0;
+        wrench::S4U_Simulation::compute(100.0 * 100.0 * MEGAFLOP); // compute for 100 seconds
+
+        wrench::Simulation::sleep(1.0);
+
+        em->stop();
+
+        // Sleep 1 second to avoid having the power meters dying right when
+        // The WMS is dying to, i.e., right when the simulation is terminating.
+        wrench::Simulation::sleep(1.0);
+
+        return 0;
+    }
+};
+
+TEST_F(SimulationTimestampEnergyTest, EventDrivenEnergyMeterTest) {
+    DO_TEST_WITH_FORK(do_EventDrivenEnergyMeter_test);
+}
+
+void SimulationTimestampEnergyTest::do_EventDrivenEnergyMeter_test() {
+    auto simulation = new wrench::Simulation();
+    int argc = 2;
+    auto argv = (char **)calloc(argc, sizeof(char *));
+    argv[0] = strdup("event_driven_energy_meter_test");
+    argv[1] = strdup("--activate-energy");
+
+    EXPECT_NO_THROW(simulation->init(&argc, argv));
+
+    EXPECT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    std::string host = wrench::Simulation::getHostnameList()[0];
+
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    EXPECT_NO_THROW(wms = simulation->add(
+            new EventDrivenEnergyMeterTestWMS(
+                    this, host
+            )
+    ));
+
+    EXPECT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+    EXPECT_NO_THROW(simulation->launch());
+
+    auto energy_consumption_timestamps = simulation->getOutput().getTrace<wrench::SimulationTimestampEnergyConsumption>();
+
+    // host1 computes from time 0 to time 100, and is idle until the meter is stopped at time 101:
+    // measurements are only recorded at times 0, 100 and 101
+    std::vector<std::pair<double, double>> host1_expected_timestamps = {
+            {0,    0},
+            {100,  20000},
+            {101,  20100}
+    };
+    // host2 is idle: measurements are only recorded at times 0 and 101
+    std::vector<std::pair<double, double>> host2_expected_timestamps = {
+            {0,    0},
+            {101,  10100}
+    };
+
+    std::map<std::string, std::vector<std::pair<double, double>>> expected_timestamps = {
+            {"host1", host1_expected_timestamps},
+            {"host2", host2_expected_timestamps}
+    };
+
+    for (auto const &expected : expected_timestamps) {
+        std::vector<wrench::SimulationTimestamp<wrench::SimulationTimestampEnergyConsumption> *> host_timestamps;
+        std::copy_if(
+                energy_consumption_timestamps.begin(),
+                energy_consumption_timestamps.end(),
+                std::back_inserter(host_timestamps),
+                [&expected](wrench::SimulationTimestamp<wrench::SimulationTimestampEnergyConsumption> *ts) -> bool {
+                    return (ts->getContent()->getHostname() == expected.first);
+                });
+
+        ASSERT_EQ(expected.second.size(), host_timestamps.size());
+        for (size_t i = 0; i < host_timestamps.size(); ++i) {
+            ASSERT_DOUBLE_EQ(expected.second[i].first, host_timestamps[i]->getDate());
+            ASSERT_DOUBLE_EQ(expected.second[i].second, host_timestamps[i]->getContent()->getConsumption());
+        }
+    }
+
+    // Reconstruct 10-second periodic measurements, which should be identical to
+    // those recorded by a periodic energy meter (see EnergyMeterSingleMeasurementPeriodTest)
+    EXPECT_THROW(simulation->getOutput().dumpHostEnergyConsumptionJSON(this->energy_consumption_data_file_path, true, -1.0),
+                 std::invalid_argument);
+    EXPECT_NO_THROW(simulation->getOutput().dumpHostEnergyConsumptionJSON(this->energy_consumption_data_file_path, true, 10.0));
+
+    std::ifstream json_file(this->energy_consumption_data_file_path);
+    nlohmann::json result_json;
+    json_file >> result_json;
+
+    for (auto const &host_json : result_json["energy_consumption"]) {
+        double joules_per_second = (host_json["hostname"].get<std::string>() == "host1" ? 200.0 : 100.0);
+        auto trace = host_json["consumed_energy_trace"];
+        ASSERT_EQ(11, trace.size());
+        for (size_t i = 0; i < trace.size(); ++i) {
+            ASSERT_DOUBLE_EQ(10.0 * i, trace[i]["time"].get<double>());
+            ASSERT_DOUBLE_EQ(10.0 * i * joules_per_second, trace[i]["joules"].get<double>());
+        }
+    }
+
+    delete simulation;
+    free(argv[0]);
+    free(argv[1]);
+    free(argv);
+}
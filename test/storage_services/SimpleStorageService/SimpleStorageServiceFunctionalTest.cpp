@@ -44,6 +44,8 @@ public:
 
     void do_FileWrite_test();
 
+    void do_ConcurrentFileReadsAndWrites_test();
+
 
 protected:
     SimpleStorageServiceFunctionalTest() {
@@ -1700,3 +1702,165 @@ void SimpleStorageServiceFunctionalTest::do_FileWrite_test() {
     free(argv);
 }
 
+
+
+/**********************************************************************/
+/**  CONCURRENT FILE READS AND WRITES TEST                           **/
+/**********************************************************************/
+
+class ConcurrentFileReadsAndWritesTestWMS : public wrench::WMS {
+
+public:
+    ConcurrentFileReadsAndWritesTestWMS(SimpleStorageServiceFunctionalTest *test,
+                                        const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                        std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, storage_services, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    SimpleStorageServiceFunctionalTest *test;
+
+    int main() {
+
+        auto location = wrench::FileLocation::LOCATION(this->test->storage_service_1000, "/disk1000");
+        std::map<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>> locations = {
+                {this->test->file_1,   location},
+                {this->test->file_10,  location},
+                {this->test->file_100, location}
+        };
+
+        // Record events, and the maximum number of operations in progress
+        std::vector<std::pair<std::string, wrench::StorageService::FileOperationEvent>> events;
+        unsigned long num_in_progress = 0;
+        unsigned long max_num_in_progress = 0;
+        auto callback = [&events, &num_in_progress, &max_num_in_progress](
+                wrench::WorkflowFile *f, std::shared_ptr<wrench::FileLocation> l,
+                wrench::StorageService::FileOperationEvent event) {
+            events.push_back(std::make_pair(f->getID(), event));
+            if (event == wrench::StorageService::FILE_OPERATION_STARTED) {
+                max_num_in_progress = std::max<unsigned long>(max_num_in_progress, ++num_in_progress);
+            } else {
+                num_in_progress--;
+            }
+        };
+
+        // Invalid concurrency
+        try {
+            wrench::StorageService::writeFiles(locations, 0);
+            throw std::runtime_error("Should not be able to write files with a concurrency of 0");
+        } catch (std::invalid_argument &e) {
+        }
+
+        // Write all files concurrently
+        wrench::StorageService::writeFiles(locations, 3, callback);
+        if ((events.size() != 6) or (max_num_in_progress != 3)) {
+            throw std::runtime_error("Unexpected write events (" + std::to_string(events.size()) + " events, " +
+                                     std::to_string(max_num_in_progress) + " concurrent writes)");
+        }
+        // Writes are started in file ID order
+        if ((events[0].first != "file_1") or (events[1].first != "file_10") or (events[2].first != "file_100")) {
+            throw std::runtime_error("Writes should be started in file ID order");
+        }
+        for (auto const &l : locations) {
+            if (not wrench::StorageService::lookupFile(l.first, l.second)) {
+                throw std::runtime_error("File " + l.first->getID() + " should have been written");
+            }
+        }
+
+        // Read all files, two at a time
+        events.clear();
+        max_num_in_progress = 0;
+        wrench::StorageService::readFiles(locations, 2, callback);
+        if ((events.size() != 6) or (max_num_in_progress != 2)) {
+            throw std::runtime_error("Unexpected read events (" + std::to_string(events.size()) + " events, " +
+                                     std::to_string(max_num_in_progress) + " concurrent reads)");
+        }
+        for (auto const &e : events) {
+            if (e.second == wrench::StorageService::FILE_OPERATION_FAILED) {
+                throw std::runtime_error("No read should have failed");
+            }
+        }
+
+        // A failed read, along with successful ones
+        events.clear();
+        locations[this->test->file_500] = location;
+        try {
+            wrench::StorageService::readFiles(locations, 4, callback);
+            throw std::runtime_error("Should not be able to read a file that is not there");
+        } catch (wrench::WorkflowExecutionException &e) {
+            if (not std::dynamic_pointer_cast<wrench::FileNotFound>(e.getCause())) {
+                throw std::runtime_error("Got an expected exception but unexpected cause type: " +
+                                         e.getCause()->toString() + " (expected: FileNotFound)");
+            }
+        }
+        if ((events.size() != 8) or (num_in_progress != 0)) {
+            throw std::runtime_error("All started reads should have completed or failed");
+        }
+
+        // Reading files from two disks concurrently takes less time than reading them one at a time
+        std::map<wrench::WorkflowFile *, std::shared_ptr<wrench::FileLocation>> two_disk_locations = {
+                {this->test->file_100, location},
+                {this->test->file_500, wrench::FileLocation::LOCATION(this->test->storage_service_510, "/disk510")}
+        };
+        wrench::StorageService::writeFile(this->test->file_500, two_disk_locations[this->test->file_500]);
+        double start_date = wrench::Simulation::getCurrentSimulatedDate();
+        wrench::StorageService::readFiles(two_disk_locations, 1);
+        double sequential_elapsed = wrench::Simulation::getCurrentSimulatedDate() - start_date;
+        start_date = wrench::Simulation::getCurrentSimulatedDate();
+        wrench::StorageService::readFiles(two_disk_locations, 2);
+        double concurrent_elapsed = wrench::Simulation::getCurrentSimulatedDate() - start_date;
+        if (concurrent_elapsed >= sequential_elapsed) {
+            throw std::runtime_error("Concurrent reads should take less time than sequential ones (" +
+                                     std::to_string(concurrent_elapsed) + " vs. " +
+                                     std::to_string(sequential_elapsed) + ")");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(SimpleStorageServiceFunctionalTest, ConcurrentFileReadsAndWrites) {
+    DO_TEST_WITH_FORK(do_ConcurrentFileReadsAndWrites_test);
+}
+
+void SimpleStorageServiceFunctionalTest::do_ConcurrentFileReadsAndWrites_test() {
+
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    char **argv = (char **) calloc(1, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = wrench::Simulation::getHostnameList()[0];
+
+    // Create Storage Services (on two different disks)
+    ASSERT_NO_THROW(storage_service_1000 = simulation->add(
+            new wrench::SimpleStorageService(hostname, {"/disk1000"})));
+    ASSERT_NO_THROW(storage_service_510 = simulation->add(
+            new wrench::SimpleStorageService(hostname, {"/disk510"})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new ConcurrentFileReadsAndWritesTestWMS(
+                    this, {
+                            storage_service_1000, storage_service_510
+                    }, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    // Running a "run a single task" simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    free(argv[0]);
+    free(argv);
+}
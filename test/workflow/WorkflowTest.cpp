@@ -167,6 +167,47 @@ TEST_F(WorkflowTest, ControlDependency) {
     workflow->removeControlDependency(t1,t4);  // nope (nothing)
 }
 
+TEST_F(WorkflowTest, NotCompletedParentCounts) {
+    ASSERT_EQ(0, t1->getNumberOfNotCompletedParents());
+    ASSERT_EQ(1, t2->getNumberOfNotCompletedParents());
+    ASSERT_EQ(2, t4->getNumberOfNotCompletedParents());
+    ASSERT_EQ(2, t4->getNumberOfVisiblyNotCompletedParents(false));
+
+    // Internal completion
+    t2->setInternalState(wrench::WorkflowTask::InternalState::TASK_COMPLETED);
+    ASSERT_EQ(1, t4->getNumberOfNotCompletedParents());
+    ASSERT_EQ(2, t4->getNumberOfVisiblyNotCompletedParents(false));
+    ASSERT_EQ(2, t4->getNumberOfVisiblyNotCompletedParents(true));
+
+    // Upcoming visible completion
+    t2->setUpcomingState(wrench::WorkflowTask::State::COMPLETED);
+    ASSERT_EQ(2, t4->getNumberOfVisiblyNotCompletedParents(false));
+    ASSERT_EQ(1, t4->getNumberOfVisiblyNotCompletedParents(true));
+
+    // Visible completion
+    t2->setState(wrench::WorkflowTask::State::COMPLETED);
+    ASSERT_EQ(1, t4->getNumberOfVisiblyNotCompletedParents(false));
+
+    // Going back
+    t2->setInternalState(wrench::WorkflowTask::InternalState::TASK_READY);
+    ASSERT_EQ(2, t4->getNumberOfNotCompletedParents());
+
+    // Removing the last not visibly completed parent makes the task ready
+    auto t5 = workflow->addTask("task-test-05", 1, 1, 1, 1.0, 0);
+    workflow->addControlDependency(t2, t5);
+    workflow->addControlDependency(t3, t5);
+    ASSERT_EQ(1, t5->getNumberOfVisiblyNotCompletedParents(false));
+    ASSERT_EQ(wrench::WorkflowTask::State::NOT_READY, t5->getState());
+    workflow->removeControlDependency(t3, t5);
+    ASSERT_EQ(0, t5->getNumberOfVisiblyNotCompletedParents(false));
+    ASSERT_EQ(wrench::WorkflowTask::State::READY, t5->getState());
+
+    // Removing a task updates its children
+    workflow->removeTask(t1);
+    ASSERT_EQ(0, t3->getNumberOfNotCompletedParents());
+    ASSERT_EQ(0, t3->getNumberOfVisiblyNotCompletedParents(true));
+}
+
 TEST_F(WorkflowTest, WorkflowTaskThrow) {
     // testing invalid task creation
     ASSERT_THROW(workflow->addTask("task-error", -100, 1, 1, 1.0, 0), std::invalid_argument);